@@ -44,6 +44,8 @@ static clock_handler_t clockInterfaceHandler =
         at32uc3l0256_InitDfllExternalOscillator,
     .clock_DelayMs = at32uc3l0256_DelayMs,
     .clock_DelayUs = at32uc3l0256_DelayUs,
+    .clock_GetCycleCount = at32uc3l0256_GetCycleCount,
+    .clock_CycleCountToUs = at32uc3l0256_CycleCountToUs,
 };
 
 /*----------------------------------------------------------------------------*/
@@ -0,0 +1,75 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : flash_config.c
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : HAL config layer
+*
+* This file is the C source file for the flash config file.
+*
+* HAL config files define handlers for high level code to access hardware
+* specific code abstracted out w/ HAL contracts. Bridges contracts and
+* hardware specific code by creating an instance of a contract w/ members
+* filled w/ hardware specific code that adheres to the contract.
+*
+* Step 2 for hardware abstraction.
+*-----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdint.h>
+#include "HAL/HAL_contracts/flash_contract.h"
+#include "HAL/HAL_configs/flash_config.h"
+#include "HAL/at32uc3l0256/flash_at32uc3l0256.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                               Debug Switches                               */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+/* static instance of flash interface */
+static flash_handler_t flashInterfaceHandler =
+{
+    .flash_GetStoreGeometry = at32uc3l0256_GetFlashStoreGeometry,
+    .flash_ReadStore = at32uc3l0256_ReadFlashStore,
+    .flash_EraseStorePage = at32uc3l0256_EraseFlashStorePage,
+    .flash_WriteStore = at32uc3l0256_WriteFlashStore,
+};
+
+/*----------------------------------------------------------------------------*/
+/*                    Private (Static) Function Prototype                     */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+/**
+* Returns static instance of flash interface handler defined in this file.
+*
+* \param[out] p_flashHandler Handler to link to this file's handler instance.
+* \retval None
+*/
+void config_GetFlashHandler(flash_handler_t** p_flashHandler)
+{
+    *p_flashHandler = &flashInterfaceHandler;
+}
+
+/*----------------------------------------------------------------------------*/
+/*                           Local Shared Functions                           */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                         Private (Static) Functions                         */
+/*----------------------------------------------------------------------------*/
+/* None */
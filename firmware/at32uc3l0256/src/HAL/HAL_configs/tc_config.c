@@ -41,6 +41,10 @@ static tc_handler_t tcInterfaceHandler =
 {
     .tc_Init = at32uc3l0256_InitTc,
     .tc_GetTimerCounterCount = at32uc3l0256_GetTimerCounterCount,
+    .tc_GetTickRateHz = at32uc3l0256_GetTickRateHz,
+    .tc_SetTickHandler = at32uc3l0256_SetTickHandler,
+    .tc_GetTickStats = at32uc3l0256_GetTickStats,
+    .tc_ClearTickStats = at32uc3l0256_ClearTickStats,
 };
 
 /*----------------------------------------------------------------------------*/
@@ -34,6 +34,9 @@ typedef struct
     clock_status_t (*clock_InitDfllExternalOscillator)(void);
     clock_status_t (*clock_DelayMs)(const uint32_t delayTime);
     clock_status_t (*clock_DelayUs)(const uint32_t delayTime);
+    clock_status_t (*clock_GetCycleCount)(uint32_t* p_cycleCount);
+    clock_status_t (*clock_CycleCountToUs)(const uint32_t cycleCount,
+        uint32_t* p_timeUs);
 } clock_handler_t;
 
 /*----------------------------------------------------------------------------*/
@@ -0,0 +1,56 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : flash_contract.h
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : HAL contract layer
+*
+* This file contains the contract to abstract a flash storage interface.
+*
+* The storage is a region of flash reserved for data, addressed by byte
+* offset from its start and erased a page at a time.
+*
+* Contracts define features of interfaces so high level code can use abstract
+* handlers instead of hardware specific code. HAL config files use these
+* contracts to link to hardware specific code.
+*
+* Step 1 for hardware abstraction.
+*-----------------------------------------------------------------------------*/
+
+#ifndef FLASH_CONTRACT_H_
+#define FLASH_CONTRACT_H_
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+/* flash status enumeration */
+typedef enum
+{
+    FLASH_SUCCESS = 0u,
+    FLASH_ERROR,
+    FLASH_WRITE_ERROR
+} flash_status_t;
+
+/* flash interface contract- used to create handlers */
+typedef struct
+{
+    flash_status_t (*flash_GetStoreGeometry)(
+        uint32_t* p_pageSize, uint32_t* p_pageCount);
+    flash_status_t (*flash_ReadStore)(
+        const uint32_t offset, void* p_dest, const uint32_t size);
+    flash_status_t (*flash_EraseStorePage)(const uint32_t page);
+    flash_status_t (*flash_WriteStore)(
+        const uint32_t offset, const void* p_src, const uint32_t size);
+} flash_handler_t;
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+#endif /* FLASH_CONTRACT_H_ */
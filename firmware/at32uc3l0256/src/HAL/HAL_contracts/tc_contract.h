@@ -27,11 +27,30 @@ typedef enum
     TC_ERROR
 } tc_status_t;
 
+/* function run by the TC interrupt every tick */
+typedef void (*tc_tick_handler_t)(void);
+
+/* timing of the ticks since the stats were cleared, in counter clocks */
+typedef struct
+{
+    uint32_t counterClockHz;    /* counter clocks per second */
+    uint32_t tickCount;         /* ticks measured */
+    uint32_t overrunCount;      /* handlers still running at the next tick */
+    uint16_t periodCounts;      /* tick period */
+    uint16_t minLatencyCounts;  /* tick to handler start, shortest */
+    uint16_t maxLatencyCounts;  /* tick to handler start, longest */
+    uint16_t maxRunCounts;      /* handler run time, longest */
+} tc_tick_stats_t;
+
 /* TC interface contract- used to create handlers */
 typedef struct
 {
     tc_status_t (*tc_Init)(void);
     tc_status_t (*tc_GetTimerCounterCount)(uint32_t* p_timerCounterCount);
+    tc_status_t (*tc_GetTickRateHz)(uint32_t* p_tickRateHz);
+    tc_status_t (*tc_SetTickHandler)(tc_tick_handler_t handler);
+    tc_status_t (*tc_GetTickStats)(tc_tick_stats_t* p_tickStats);
+    tc_status_t (*tc_ClearTickStats)(void);
 } tc_handler_t;
 
 /*----------------------------------------------------------------------------*/
@@ -153,6 +153,49 @@ clock_status_t at32uc3l0256_DelayUs(const uint32_t delayTime)
     return clockStatus;
 }
 
+/**
+* CPU cycle counter for AT32UC3L0256 MCU.
+*
+* The COUNT system register counts every CPU clock and wraps, so only the
+* difference of two readings taken less than a wrap apart means anything.
+*
+* \param[out] p_cycleCount CPU cycles counted
+* \retval CLOCK_SUCCESS Success
+* \retval CLOCK_ERROR Failure: Failed to read cycle counter
+*/
+clock_status_t at32uc3l0256_GetCycleCount(uint32_t* p_cycleCount)
+{
+    clock_status_t clockStatus = CLOCK_ERROR;
+    
+    *p_cycleCount = (uint32_t)Get_system_register(AVR32_COUNT);
+    
+    clockStatus = CLOCK_SUCCESS;
+    
+    /* return status */
+    return clockStatus;
+}
+
+/**
+* CPU cycles to microseconds for AT32UC3L0256 MCU.
+*
+* \param[in] cycleCount CPU cycles
+* \param[out] p_timeUs Time in microseconds
+* \retval CLOCK_SUCCESS Success
+* \retval CLOCK_ERROR Failure: Failed to convert cycles
+*/
+clock_status_t at32uc3l0256_CycleCountToUs(const uint32_t cycleCount,
+    uint32_t* p_timeUs)
+{
+    clock_status_t clockStatus = CLOCK_ERROR;
+    
+    *p_timeUs = (uint32_t)cpu_cy_2_us(cycleCount, sysclk_get_cpu_hz());
+    
+    clockStatus = CLOCK_SUCCESS;
+    
+    /* return status */
+    return clockStatus;
+}
+
 /*----------------------------------------------------------------------------*/
 /*                           Local Shared Functions                           */
 /*----------------------------------------------------------------------------*/
@@ -59,5 +59,8 @@ clock_status_t at32uc3l0256_InitDfll(void);
 clock_status_t at32uc3l0256_InitDfllExternalOscillator(void);
 clock_status_t at32uc3l0256_DelayMs(const uint32_t delayTime);
 clock_status_t at32uc3l0256_DelayUs(const uint32_t delayTime);
+clock_status_t at32uc3l0256_GetCycleCount(uint32_t* p_cycleCount);
+clock_status_t at32uc3l0256_CycleCountToUs(const uint32_t cycleCount,
+    uint32_t* p_timeUs);
 
 #endif /* CLOCK_AT32UC3L0256_H_ */
\ No newline at end of file
@@ -0,0 +1,183 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : flash_at32uc3l0256.c
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : hardware specific layer
+*
+* This file is the source file for hardware specific flash code.
+*
+* Step 3 for hardware abstraction.
+*
+* (if applicable)
+* Target Hardware    : AT32UC3L0256
+* IDE                : Atmel Studio 7.4.2542
+* SDK                : ASF 3.52.0
+*-----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <asf.h>
+#include <stdint.h>
+#include <string.h>
+#include "HAL/HAL_contracts/flash_contract.h"
+#include "HAL/at32uc3l0256/flash_at32uc3l0256.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                               Debug Switches                               */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+/* from the linker, the startup code copies _data_lma to _data.._edata */
+extern uint8_t _data[];
+extern uint8_t _edata[];
+extern const uint8_t _data_lma[];
+
+/*----------------------------------------------------------------------------*/
+/*                    Private (Static) Function Prototype                     */
+/*----------------------------------------------------------------------------*/
+static volatile uint8_t* at32uc3l0256_FlashStoreAddress(const uint32_t offset);
+static bool at32uc3l0256_FlashStoreIsFree(void);
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+/**
+* Size of the flash storage region for AT32UC3L0256 MCU.
+*
+* \param[out] p_pageSize Bytes per erase page
+* \param[out] p_pageCount Pages in the storage region
+* \retval FLASH_SUCCESS Success
+* \retval FLASH_ERROR Failure: The firmware image reaches into the region
+*/
+flash_status_t at32uc3l0256_GetFlashStoreGeometry(
+    uint32_t* p_pageSize, uint32_t* p_pageCount)
+{
+    if (!at32uc3l0256_FlashStoreIsFree())
+        return FLASH_ERROR;
+    
+    *p_pageSize = AVR32_FLASHCDW_PAGE_SIZE;
+    *p_pageCount = MM_FLASH_STORE_PAGE_COUNT;
+    
+    /* return status */
+    return FLASH_SUCCESS;
+}
+
+/**
+* Read from the flash storage region for AT32UC3L0256 MCU.
+*
+* \param[in] offset Byte offset into the storage region
+* \param[out] p_dest Buffer to read into
+* \param[in] size Bytes to read
+* \retval FLASH_SUCCESS Success
+* \retval FLASH_ERROR Failure: Read past the end of the region
+*/
+flash_status_t at32uc3l0256_ReadFlashStore(
+    const uint32_t offset, void* p_dest, const uint32_t size)
+{
+    if ((offset + size) > MM_FLASH_STORE_SIZE)
+        return FLASH_ERROR;
+    
+    /* flash is memory mapped */
+    memcpy(p_dest, (const void*)at32uc3l0256_FlashStoreAddress(offset), size);
+    
+    /* return status */
+    return FLASH_SUCCESS;
+}
+
+/**
+* Erase one page of the flash storage region for AT32UC3L0256 MCU.
+*
+* \param[in] page Page of the storage region, 0 is the first
+* \retval FLASH_SUCCESS Success
+* \retval FLASH_ERROR Failure: Page outside the region, or the region
+*                     overlaps the firmware image
+* \retval FLASH_WRITE_ERROR Failure: Page did not erase
+*/
+flash_status_t at32uc3l0256_EraseFlashStorePage(const uint32_t page)
+{
+    int flashPage = 0;
+    
+    if ((page >= MM_FLASH_STORE_PAGE_COUNT)
+        || !at32uc3l0256_FlashStoreIsFree())
+        return FLASH_ERROR;
+    
+    flashPage = (int)(flashcdw_get_page_count() - MM_FLASH_STORE_PAGE_COUNT
+        + page);
+    if (!flashcdw_erase_page(flashPage, true))
+        return FLASH_WRITE_ERROR;
+    
+    /* return status */
+    return FLASH_SUCCESS;
+}
+
+/**
+* Write to erased flash in the storage region for AT32UC3L0256 MCU.
+*
+* \param[in] offset Byte offset into the storage region
+* \param[in] p_src Data to write
+* \param[in] size Bytes to write
+* \retval FLASH_SUCCESS Success
+* \retval FLASH_ERROR Failure: Write past the end of the region, or the
+*                     region overlaps the firmware image
+* \retval FLASH_WRITE_ERROR Failure: Flash controller reported an error
+*/
+flash_status_t at32uc3l0256_WriteFlashStore(
+    const uint32_t offset, const void* p_src, const uint32_t size)
+{
+    if (((offset + size) > MM_FLASH_STORE_SIZE)
+        || !at32uc3l0256_FlashStoreIsFree())
+        return FLASH_ERROR;
+    
+    flashcdw_memcpy(at32uc3l0256_FlashStoreAddress(offset), p_src, size, false);
+    if (flashcdw_is_lock_error() || flashcdw_is_programming_error())
+        return FLASH_WRITE_ERROR;
+    
+    /* return status */
+    return FLASH_SUCCESS;
+}
+
+/*----------------------------------------------------------------------------*/
+/*                           Local Shared Functions                           */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                         Private (Static) Functions                         */
+/*----------------------------------------------------------------------------*/
+/**
+* Mapped address of a byte of the flash storage region.
+*
+* \param[in] offset Byte offset into the storage region
+* \retval Address in the flash array
+*/
+static volatile uint8_t* at32uc3l0256_FlashStoreAddress(const uint32_t offset)
+{
+    return (volatile uint8_t*)(AVR32_FLASH + flashcdw_get_flash_size()
+        - MM_FLASH_STORE_SIZE + offset);
+}
+
+/**
+* Whether the firmware image ends below the flash storage region. The
+* initialized data is the last thing the linker loads into flash, so its
+* load address plus its size is where the image ends.
+*
+* \param None
+* \retval true The region holds no code or data of the image
+* \retval false The image reaches into the region
+*/
+static bool at32uc3l0256_FlashStoreIsFree(void)
+{
+    uint32_t imageEnd = (uint32_t)_data_lma + (uint32_t)(_edata - _data);
+    
+    return imageEnd <= (uint32_t)at32uc3l0256_FlashStoreAddress(0u);
+}
@@ -0,0 +1,47 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : flash_at32uc3l0256.h
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : hardware specific layer
+*
+* This file is the header file for hardware specific flash code.
+*
+* Step 3 for hardware abstraction.
+*
+* The storage region is the last MM_FLASH_STORE_PAGE_COUNT pages of the
+* internal flash. The firmware is linked from the bottom of flash by the
+* toolchain's default linker script, which still maps the whole part, so
+* nothing at link time keeps the image out of the top pages. Instead the
+* region is checked against the end of the image the linker reports, the
+* initialized data loaded after the code, and refused if they overlap, so
+* an image grown that far fails to store instead of erasing itself.
+*-----------------------------------------------------------------------------*/
+
+#ifndef FLASH_AT32UC3L0256_H_
+#define FLASH_AT32UC3L0256_H_
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+#define MM_FLASH_STORE_PAGE_COUNT    (16u)   /* pages reserved for storage */
+#define MM_FLASH_STORE_SIZE \
+    (MM_FLASH_STORE_PAGE_COUNT * AVR32_FLASHCDW_PAGE_SIZE)
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+flash_status_t at32uc3l0256_GetFlashStoreGeometry(
+    uint32_t* p_pageSize, uint32_t* p_pageCount);
+flash_status_t at32uc3l0256_ReadFlashStore(
+    const uint32_t offset, void* p_dest, const uint32_t size);
+flash_status_t at32uc3l0256_EraseFlashStorePage(const uint32_t page);
+flash_status_t at32uc3l0256_WriteFlashStore(
+    const uint32_t offset, const void* p_src, const uint32_t size);
+
+#endif /* FLASH_AT32UC3L0256_H_ */
@@ -7,6 +7,12 @@
 *
 * This file is the header file for hardware specific TC code.
 *
+* The TC interrupt runs the tick handler, the micromouse control loop, at a
+* fixed MM_TIMER_COUNTER_TICK_HZ. The counter restarts at every RC compare,
+* so its value when the interrupt starts is how late the handler started,
+* and its value when the handler returns is how long it ran. The spread of
+* the latency is the jitter of the control period.
+*
 * Step 3 for hardware abstraction.
 *
 * (if applicable)
@@ -28,7 +34,9 @@
 /*----------------------------------------------------------------------------*/
 /*                                Definitions                                 */
 /*----------------------------------------------------------------------------*/
-/* None */
+#if (MM_TIMER_COUNTER_RC > 0xFFFFu)
+#error "MM_TIMER_COUNTER_TICK_HZ too slow for the 16 bit RC compare"
+#endif
 
 /*----------------------------------------------------------------------------*/
 /*                               Debug Switches                               */
@@ -38,7 +46,15 @@
 /*----------------------------------------------------------------------------*/
 /*                              Global Variables                              */
 /*----------------------------------------------------------------------------*/
-/* None */
+/* run every tick, see at32uc3l0256_SetTickHandler() */
+static volatile tc_tick_handler_t tickHandler = NULL;
+/* tick timing since the last clear */
+static volatile tc_tick_stats_t tickStats =
+{
+    .counterClockHz = MM_TIMER_COUNTER_CLOCK_HZ,
+    .periodCounts = MM_TIMER_COUNTER_RC,
+    .minLatencyCounts = UINT16_MAX,
+};
 
 /*----------------------------------------------------------------------------*/
 /*                    Private (Static) Function Prototype                     */
@@ -57,10 +73,52 @@
 __attribute__((__interrupt__))
 static void tc_irq(void)
 {
+    uint16_t startCounts = 0u;
+    uint16_t endCounts = 0u;
+    uint16_t runCounts = 0u;
+    
+    /* the counter restarted at the RC compare, so it reads the latency */
+    startCounts = (uint16_t)tc_read_tc(
+        MM_TIMER_COUNTER_BASE_ADDRESS, MM_TIMER_COUNTER_CHANNEL);
+    
     /* Clear the interrupt flag. This is a side effect of reading the TC SR */
     tc_read_sr(MM_TIMER_COUNTER_BASE_ADDRESS, MM_TIMER_COUNTER_CHANNEL);
     
     g_mm_TimerCounterCount++;
+    
+    if (tickHandler != NULL)
+    {
+        tickHandler();
+    }
+    
+    endCounts = (uint16_t)tc_read_tc(
+        MM_TIMER_COUNTER_BASE_ADDRESS, MM_TIMER_COUNTER_CHANNEL);
+    
+    /* a counter that restarted while the handler ran is an overrun */
+    if (endCounts < startCounts)
+    {
+        runCounts = (uint16_t)((MM_TIMER_COUNTER_RC - startCounts) + endCounts);
+        tickStats.overrunCount++;
+    }
+    else
+    {
+        runCounts = (uint16_t)(endCounts - startCounts);
+    }
+    
+    /* update tick stats */
+    if (startCounts < tickStats.minLatencyCounts)
+    {
+        tickStats.minLatencyCounts = startCounts;
+    }
+    if (startCounts > tickStats.maxLatencyCounts)
+    {
+        tickStats.maxLatencyCounts = startCounts;
+    }
+    if (runCounts > tickStats.maxRunCounts)
+    {
+        tickStats.maxRunCounts = runCounts;
+    }
+    tickStats.tickCount++;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -117,13 +175,13 @@ tc_status_t at32uc3l0256_InitTc(void)
     else
     {
         /* Set the compare triggers */
-        /* We configure it to count every 1 milliseconds */
-        /* We want: (1 / (fPBA / 8)) * RC = 1 ms; RC = (fPBA / 8) / 1000 */
-        /* to get an interrupt every 10 ms */
+        /* We configure it to count every tick */
+        /* We want: (1 / (fPBA / 8)) * RC = 1 tick; */
+        /* RC = (fPBA / 8) / MM_TIMER_COUNTER_TICK_HZ */
         if (tc_write_rc(
             MM_TIMER_COUNTER_BASE_ADDRESS, 
             MM_TIMER_COUNTER_CHANNEL, 
-            MM_PBA_CLK_FREQ_HZ / 8 / 1000 * 4) == TC_INVALID_ARGUMENT)
+            MM_TIMER_COUNTER_RC) == TC_INVALID_ARGUMENT)
             tcStatus = TC_ERROR;
         else
         {
@@ -175,6 +233,95 @@ tc_status_t at32uc3l0256_GetTimerCounterCount(uint32_t* p_timerCounterCount)
     return tcStatus;
 }
 
+/**
+* Tick rate of the timer counter for AT32UC3L0256 MCU.
+*
+* \param[out] p_tickRateHz Ticks per second
+* \retval TC_SUCCESS Success
+* \retval TC_ERROR Failure: Failed to read tick rate
+*/
+tc_status_t at32uc3l0256_GetTickRateHz(uint32_t* p_tickRateHz)
+{
+    tc_status_t tcStatus = TC_ERROR;
+    
+    *p_tickRateHz = MM_TIMER_COUNTER_TICK_HZ;
+    
+    tcStatus = TC_SUCCESS;
+    
+    /* return status */
+    return tcStatus;
+}
+
+/**
+* Set the function the timer counter interrupt runs every tick for
+* AT32UC3L0256 MCU.
+*
+* The handler runs in the interrupt, so it has to return well within a tick.
+*
+* \param[in] handler Function to run, NULL for none
+* \retval TC_SUCCESS Success
+* \retval TC_ERROR Failure: Failed to set tick handler
+*/
+tc_status_t at32uc3l0256_SetTickHandler(tc_tick_handler_t handler)
+{
+    tc_status_t tcStatus = TC_ERROR;
+    
+    tickHandler = handler;
+    
+    tcStatus = TC_SUCCESS;
+    
+    /* return status */
+    return tcStatus;
+}
+
+/**
+* Access function for tick timing for AT32UC3L0256 MCU.
+*
+* \param[out] p_tickStats Tick timing since the stats were last cleared
+* \retval TC_SUCCESS Success
+* \retval TC_ERROR Failure: Failed to read tick stats
+*/
+tc_status_t at32uc3l0256_GetTickStats(tc_tick_stats_t* p_tickStats)
+{
+    tc_status_t tcStatus = TC_ERROR;
+    irqflags_t flags = cpu_irq_save();
+    
+    /* copied w/ interrupts off so a tick can not tear it */
+    *p_tickStats = tickStats;
+    
+    cpu_irq_restore(flags);
+    
+    tcStatus = TC_SUCCESS;
+    
+    /* return status */
+    return tcStatus;
+}
+
+/**
+* Clear tick timing for AT32UC3L0256 MCU.
+*
+* \retval TC_SUCCESS Success
+* \retval TC_ERROR Failure: Failed to clear tick stats
+*/
+tc_status_t at32uc3l0256_ClearTickStats(void)
+{
+    tc_status_t tcStatus = TC_ERROR;
+    irqflags_t flags = cpu_irq_save();
+    
+    tickStats.tickCount = 0u;
+    tickStats.overrunCount = 0u;
+    tickStats.minLatencyCounts = UINT16_MAX;
+    tickStats.maxLatencyCounts = 0u;
+    tickStats.maxRunCounts = 0u;
+    
+    cpu_irq_restore(flags);
+    
+    tcStatus = TC_SUCCESS;
+    
+    /* return status */
+    return tcStatus;
+}
+
 /*----------------------------------------------------------------------------*/
 /*                           Local Shared Functions                           */
 /*----------------------------------------------------------------------------*/
@@ -30,6 +30,21 @@
 
 /* clock settings */
 #define MM_PBA_CLK_FREQ_HZ               MM_PBA_FREQ_HZ
+/* internal source clock 3 is fPBA / 8 */
+#define MM_TIMER_COUNTER_CLOCK_HZ        (MM_PBA_CLK_FREQ_HZ / 8u)
+
+/* tick rate, the control loop runs once a tick, 1 kHz or more */
+#ifndef MM_TIMER_COUNTER_TICK_HZ
+#define MM_TIMER_COUNTER_TICK_HZ         (1000u)
+#endif
+
+/* RC compare value, counter clocks per tick, 16 bits wide */
+#define MM_TIMER_COUNTER_RC \
+    (MM_TIMER_COUNTER_CLOCK_HZ / MM_TIMER_COUNTER_TICK_HZ)
+
+#if (MM_TIMER_COUNTER_TICK_HZ < 1000u)
+#error "MM_TIMER_COUNTER_TICK_HZ below the 1 kHz control rate"
+#endif
 
 /*----------------------------------------------------------------------------*/
 /*                              Global Variables                              */
@@ -42,5 +57,9 @@ volatile uint32_t g_mm_TimerCounterCount;
 /*----------------------------------------------------------------------------*/
 tc_status_t at32uc3l0256_InitTc(void);
 tc_status_t at32uc3l0256_GetTimerCounterCount(uint32_t* p_timerCounterCount);
+tc_status_t at32uc3l0256_GetTickRateHz(uint32_t* p_tickRateHz);
+tc_status_t at32uc3l0256_SetTickHandler(tc_tick_handler_t handler);
+tc_status_t at32uc3l0256_GetTickStats(tc_tick_stats_t* p_tickStats);
+tc_status_t at32uc3l0256_ClearTickStats(void);
 
 #endif /* TC_AT32UC3L0256_H_ */
\ No newline at end of file
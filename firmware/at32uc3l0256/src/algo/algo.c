@@ -1,28 +1,126 @@
 #include <asf.h>
 #include "algo.h"
+#include "mazemap_algo.h"
+#include "floodfill_algo.h"
+#include "speedrun_algo.h"
+#include "explore_algo.h"
+#include "frontier_algo.h"
+#include "wallinfer_algo.h"
+#include "mazestore_algo.h"
+#include "strategy_algo.h"
+#include "wallbelief_algo.h"
+#include "costmodel_algo.h"
+#include "prune_algo.h"
+#include "arena_algo.h"
+#include "mouse_hardware_interface/timer_mhi.h"
 #include "mouse_hardware_interface/usart_mhi.h"
 #include "mouse_control_interface/walldetection_mci.h"
 #include "mouse_control_interface/movement_mci.h"
+#include "mouse_control_interface/time_mci.h"
 #include "mouse_hardware_interface/clock_mhi.h"
 
-MazeCell     mazeDiscovered [MAZE_LENGTH * MAZE_LENGTH] = {{FALSE, FALSE, FALSE, FALSE}};
-unsigned int mazeFlood      [MAZE_LENGTH * MAZE_LENGTH] = {UINT_MAX};
-bool         mazeVisited    [MAZE_LENGTH * MAZE_LENGTH] = {FALSE};
-char         moveStack      [STACK_SIZE];
+// 1 = only re-flood the cells cut off by new walls, 0 = re-flood everything
+#define ALGO_INCREMENTAL_FLOOD_ENABLE (1)
+// 1 = explore until the shortest route is proven, 0 = stop at the goal
+#define ALGO_EXPLORE_UNTIL_PROVEN_ENABLE (1)
+// 1 = back out of dead ends straight to the nearest frontier cell,
+// 0 = retrace moveStack one cell at a time
+#define ALGO_FRONTIER_BACKTRACK_ENABLE (1)
+// 1 = fill in the walls the maze rules settle after every cell
+#define ALGO_WALL_INFERENCE_ENABLE (1)
+// 1 = keep the maze map in flash so a reset mid run does not lose it
+#define ALGO_MAZE_STORE_ENABLE (1)
+// new cells visited between saves, a save takes a few flash page writes
+#define ALGO_MAZE_STORE_INTERVAL (16)
+// 1 = read the side walls of the next cell and update the strategy while the
+// mouse drives into it, only its front wall is left for when it gets there
+#define ALGO_PIPELINED_PLANNING_ENABLE (1)
+// 1 = choose the move out of a cell read before while driving into it, and
+// take a turn there as an arc at the exploring speed w/o stopping, needs
+// ALGO_PIPELINED_PLANNING_ENABLE
+#define ALGO_SEARCH_TURNS_ENABLE (1)
+// 1 = print how long planning took in every cell
+#define ALGO_PLAN_TRACE_ENABLE (0)
+// 1 = plan speed runs w/ the primitive times learned on the mouse, see
+// costmodel_algo.h, 0 = w/ the motion model only
+#define ALGO_LEARNED_COSTS_ENABLE (1)
+// 1 = leave dead ends out of the flood and the cells to explore, see
+// prune_algo.h
+#define ALGO_DEAD_END_PRUNING_ENABLE (1)
+
+// maps, moves and routes are in the planner arena, see arena_algo.h
+uint16_t* const mazeFlood     = algoArena.mazeFlood;
+char*     const moveStack     = algoArena.moveStack;
 unsigned int stackTop        = 0;
-unsigned int curDir          = NORTH;
-unsigned int x = 0, y = 0;
+unsigned int curDir          = ALGO_MAZE_START_HEADING;
+unsigned int x = ALGO_MAZE_START_X, y = ALGO_MAZE_START_Y;
+uint8_t*  const strategyMoves = algoArena.strategyMoves;
+const algo_strategy_t* activeStrategy = NULL;
+bool         mazeExplored    = FALSE;
+unsigned int cellsSinceSave  = 0;
+unsigned int aheadX, aheadY, aheadDir;      // cell the move under way ends in
+bool         frontWallPending = FALSE;      // read all but its front wall
+bool         frontAssumedOpen = FALSE;      // strategy updated for it open
+bool         wallOpened       = FALSE;      // a reading took a known wall away
+bool         searchTurnPending = FALSE;     // move under way turns off
+unsigned int searchTurnDir;                 // into the cell this side
+bool         aheadChosen      = FALSE;      // moves chosen for the ahead cell
+unsigned int aheadMoveCount;                // in strategyMoves
+// planning time while driving and while standing in a cell, since the
+// strategy started
+uint32_t     planHiddenUs     = 0;
+uint32_t     planExposedUs    = 0;
+unsigned int planCells        = 0;          // cells read
+unsigned int planCellsHidden  = 0;          // read while driving into them
+// speed run moves queued for the control loop, a ring oldest first, to add
+// each one's time to the cost model as it finishes
+uint8_t*  const runMoveTypes  = algoArena.runMoveTypes;
+uint8_t*  const runMoveCounts = algoArena.runMoveCounts;
+unsigned int runMovesQueued, runMovesFinished;
+uint32_t     runMovesDoneBase;              // mci_GetMovesDone() at the start
+uint32_t     runStopsBase;                  // mci_GetMotionQueueStops() too
+uint32_t     runMoveStartCount;             // cycle count the last move finished, or the start
+unsigned int runProfile       = 0;          // speed profile the moves run at
+// where the drive back goes, the start cell alone; a constant, so it is set
+// up once instead of on the stack, read-only data is copied to RAM as well
+const algo_maze_row_t startCells[ALGO_MAZE_HEIGHT] = {
+	[ALGO_MAZE_START_Y] = ALGO_MAZE_ROW_BIT(ALGO_MAZE_START_X),
+};
+
+void readWalls(void);
+bool readWall(unsigned int dir, bool (*check)(void));
 
-MazeCell detectWalls();
+void printSpeedRun(uint32_t planMs);
+void runPrims(const algo_prim_list_t* prims);
+void queueRunMove(unsigned int type, unsigned int count);
+bool pushRunMove(unsigned int type, unsigned int count);
+void finishRunMoves(void);
+bool runStopped(void);
+bool exploreDone(void);
+void startStrategy(void);
+void driveMoves(const uint8_t* moves, unsigned int moveCount);
+void updateCell(unsigned int cellX, unsigned int cellY);
+void planAhead(unsigned int dir);
+void senseAhead(void);
+void turnAhead(void);
+void stepCell(unsigned int dir, unsigned int* cellX, unsigned int* cellY);
+void finishCell(void);
+void printPlanTimes(void);
+void turnTo(unsigned int dir);
+bool readsWall(bool (*check)(void));
 
-void floodFill       (MazeCell* srcMazeCells, unsigned int* destFlood);
-void floodFillRecurse(MazeCell* srcMazeCells, unsigned int x, unsigned int y, unsigned int cost, unsigned int* destFlood);
+void floodInit(const algo_maze_map_t* map);
+void floodWallUpdate(const algo_maze_map_t* map, unsigned int x, unsigned int y, bool inferred);
+bool floodChooseMoves(const algo_maze_map_t* map, unsigned int x, unsigned int y, unsigned int heading,
+	uint8_t* moves, unsigned int* moveCount);
+bool floodIsDone(const algo_maze_map_t* map, unsigned int x, unsigned int y, unsigned int heading);
 
-unsigned int mazeIdx   (unsigned int x, unsigned int y);
-unsigned int mirrorY   (unsigned int y);
+static inline unsigned int mazeIdx(unsigned int x, unsigned int y);
+static inline unsigned int mirrorY(unsigned int y);
 bool         isInRange (unsigned int x, unsigned int y);
 bool         isGoal    (unsigned int x, unsigned int y);
 bool         isExplored(unsigned int x, unsigned int y);
+bool         isWorthVisiting(unsigned int x, unsigned int y);
 
 char pop (char* stack, unsigned int* top);
 void push(char* stack, unsigned int* top, char data);
@@ -37,38 +135,426 @@ void moveSouth(void);
 void moveEast(void);
 void moveWest(void);
 
-bool checkNorthWall(void);
-bool checkSouthWall(void);
-bool checkEastWall(void);
-bool checkWestWall(void);
+unsigned int leftOf (unsigned int dir);
+unsigned int rightOf(unsigned int dir);
+unsigned int backOf (unsigned int dir);
 
 bool checkFrontWall(void);
 bool checkBackWall(void);
 bool checkLeftWall(void);
 bool checkRightWall(void);
 
+// head for the goal along the flood map, see traverseCell() for the rest
+const algo_strategy_t floodFillStrategy = {
+	.p_name = "flood fill",
+	.algo_StrategyInit = floodInit,
+	.algo_StrategyWallUpdate = floodWallUpdate,
+	.algo_StrategyChooseMoves = floodChooseMoves,
+	.algo_StrategyIsDone = floodIsDone,
+};
+
+// one exploring step w/ the selected strategy, see strategy_algo.h: read the
+// walls of a new cell, then drive wherever the strategy says, returns TRUE
+// once exploring is done
 bool traverseCell()
 {
-	MazeCell thisCell;
+	unsigned int moveCount;
+	uint32_t startCount;
+	uint32_t planUs;
+	bool newWalls = FALSE;
+	bool chosen;
 
-	if(isGoal(x,y))
-		return TRUE;
+	if(activeStrategy != algo_StrategyGetSelected())
+		startStrategy();
+
+	// the strategy counted on the front wall of a cell read ahead being open
+	if(!frontWallPending && activeStrategy->algo_StrategyIsDone(&algoArena.mazeMap, x, y, curDir))
+		return exploreDone();
+
+	startCount = mhi_GetCycleCount();
+	if(!algo_MazeMapIsVisited(&algoArena.mazeMap, x, y)){
+		readWalls();
+		algo_MazeMapSetVisited(&algoArena.mazeMap, x, y);
+		updateCell(x, y);
+		planCells++;
+		newWalls = TRUE;
+	}
+#if ALGO_PIPELINED_PLANNING_ENABLE
+	else if(frontWallPending){
+		finishCell();
+		newWalls = TRUE;
+	}
+#endif
+	planUs = mhi_CycleCountToUs(mhi_GetCycleCount() - startCount);
+
+#if ALGO_MAZE_STORE_ENABLE
+	if(newWalls && ++cellsSinceSave >= ALGO_MAZE_STORE_INTERVAL)
+		saveMaze();
+#endif
+	if(newWalls && activeStrategy->algo_StrategyIsDone(&algoArena.mazeMap, x, y, curDir)){
+		planExposedUs += planUs;
+		return exploreDone();
+	}
+
+#if ALGO_SEARCH_TURNS_ENABLE
+	// turnAhead() chose them on the way in, choosing again would step the
+	// strategy twice
+	if(aheadChosen){
+		aheadChosen = FALSE;
+		moveCount = aheadMoveCount;
+		chosen = TRUE;
+	}
+	else
+#endif
+	{
+		startCount = mhi_GetCycleCount();
+		chosen = activeStrategy->algo_StrategyChooseMoves(&algoArena.mazeMap, x, y, curDir, strategyMoves, &moveCount)
+			&& moveCount != 0;
+		planUs += mhi_CycleCountToUs(mhi_GetCycleCount() - startCount);
+	}
+	planExposedUs += planUs;
+#if ALGO_PLAN_TRACE_ENABLE
+	mhi_PrintString("Plan us, exposed: ");
+	mhi_PrintInt(planUs);
+	mhi_PrintString("\n\r");
+#endif
+	if(!chosen)
+		return exploreDone();
+	driveMoves(strategyMoves, moveCount);
+
+	return FALSE;
+}
+
+// exploring is over, keep the finished map so the next boot can go straight
+// to speed runs
+bool exploreDone(void)
+{
+	mazeExplored = TRUE;
+	printPlanTimes();
+#if ALGO_MAZE_STORE_ENABLE
+	saveMaze();
+#endif
+	return TRUE;
+}
+
+// start the selected strategy on the maze map as it is
+void startStrategy(void)
+{
+	activeStrategy = algo_StrategyGetSelected();
+	activeStrategy->algo_StrategyInit(&algoArena.mazeMap);
+	frontWallPending = FALSE;
+	searchTurnPending = FALSE;
+	aheadChosen = FALSE;
+	planHiddenUs = 0;
+	planExposedUs = 0;
+	planCells = 0;
+	planCellsHidden = 0;
+}
+
+// drive cell moves from the current cell, one square at a time for a single
+// move, or w/ the straights merged for a route
+void driveMoves(const uint8_t* moves, unsigned int moveCount)
+{
+	unsigned int i;
+
+	if(moveCount == 1){
+#if ALGO_PIPELINED_PLANNING_ENABLE
+		planAhead(moves[0]);
+#endif
+		switch(moves[0]){
+			case NORTH:
+				moveNorth();
+				break;
+			case SOUTH:
+				moveSouth();
+				break;
+			case EAST:
+				moveEast();
+				break;
+			case WEST:
+				moveWest();
+				break;
+		}
+#if ALGO_SEARCH_TURNS_ENABLE
+		// the move went on into the cell at the side of the one it was for
+		if(searchTurnPending){
+			searchTurnPending = FALSE;
+			stepCell(searchTurnDir, &x, &y);
+			curDir = searchTurnDir;
+		}
+#endif
+		return;
+	}
+
+	// algoArena.speedRunPrims is free until planSpeedRun() fills it
+	if(!algo_PrimCompilePath(curDir, moves, moveCount, &algoArena.speedRunPrims)){
+		mhi_PrintString("ERROR: Route does not fit the primitive list!\n\r");
+		exit(1);
+	}
+	runPrims(&algoArena.speedRunPrims);
+	algoArena.speedRunPrims.count = 0;
+
+	for(i = 0; i < moveCount; i++){
+		switch(moves[i]){
+			case NORTH:
+				y++;
+				break;
+			case SOUTH:
+				y--;
+				break;
+			case EAST:
+				x++;
+				break;
+			case WEST:
+				x--;
+				break;
+		}
+		curDir = moves[i];
+	}
+}
+
+// fill in the walls the maze rules settle after reading a cell, then bring
+// the strategy up to date, all the way if a reading took a wall away
+void updateCell(unsigned int cellX, unsigned int cellY)
+{
+	unsigned int inferred = 0;
+
+#if ALGO_WALL_INFERENCE_ENABLE
+	inferred = algo_WallInferAround(&algoArena.mazeMap, cellX, cellY);
+#endif
+	activeStrategy->algo_StrategyWallUpdate(&algoArena.mazeMap, cellX, cellY, inferred != 0 || wallOpened);
+	wallOpened = FALSE;
+}
+
+// have the square move about to drive in dir read the next cell on the way,
+// if it has not been read yet
+void planAhead(unsigned int dir)
+{
+	aheadX = x;
+	aheadY = y;
+	aheadDir = dir;
+	stepCell(dir, &aheadX, &aheadY);
+
+	if(!algo_MazeMapIsVisited(&algoArena.mazeMap, aheadX, aheadY))
+		mci_SetMoveMidpointTask(senseAhead);
+#if ALGO_SEARCH_TURNS_ENABLE
+	else
+		mci_SetMoveMidpointTask(turnAhead);
+#endif
+}
+
+// the cell next to cellX, cellY in dir
+void stepCell(unsigned int dir, unsigned int* cellX, unsigned int* cellY)
+{
+	switch(dir){
+		case NORTH:
+			(*cellY)++;
+			break;
+		case SOUTH:
+			(*cellY)--;
+			break;
+		case EAST:
+			(*cellX)++;
+			break;
+		case WEST:
+			(*cellX)--;
+			break;
+	}
+}
+
+#if ALGO_SEARCH_TURNS_ENABLE
+// midpoint task of the move into a cell read before: nothing is left to
+// read there, so choose the move out of it now, and if that turns off to a
+// side have the move take it as an arc instead of stopping to turn in
+// place; driveMoves() is past reading strategyMoves by now, so they can be
+// chosen into
+void turnAhead(void)
+{
+	uint32_t startCount;
+	unsigned int moveCount;
+	unsigned int dir;
+
+	startCount = mhi_GetCycleCount();
+	if(!activeStrategy->algo_StrategyIsDone(&algoArena.mazeMap, aheadX, aheadY, aheadDir)
+		&& activeStrategy->algo_StrategyChooseMoves(&algoArena.mazeMap, aheadX, aheadY, aheadDir,
+		strategyMoves, &moveCount) && moveCount != 0){
+		dir = strategyMoves[0];
+		if(moveCount == 1 && (dir == leftOf(aheadDir) || dir == rightOf(aheadDir))
+			&& algo_MazeMapIsWallKnown(&algoArena.mazeMap, aheadX, aheadY, dir)
+			&& !algo_MazeMapHasWall(&algoArena.mazeMap, aheadX, aheadY, dir)){
+			mci_SetMoveSearchTurn(dir == leftOf(aheadDir) ? MCI_SEARCH_TURN_LEFT : MCI_SEARCH_TURN_RIGHT);
+			searchTurnPending = TRUE;
+			searchTurnDir = dir;
+		}
+		else{
+			aheadChosen = TRUE;
+			aheadMoveCount = moveCount;
+		}
+	}
+	planHiddenUs += mhi_CycleCountToUs(mhi_GetCycleCount() - startCount);
+}
+#endif
+
+// midpoint task of the move into the next cell: the latched side walls count
+// as one reading each, the back wall is the gap the mouse drives through,
+// and the front wall is left for when the mouse gets there
+void senseAhead(void)
+{
+	uint32_t startCount;
+	unsigned int inferred = 0;
+	bool wasWall;
+
+	startCount = mhi_GetCycleCount();
+	wasWall = algo_MazeMapHasKnownWall(&algoArena.mazeMap, aheadX, aheadY, leftOf(aheadDir));
+	algo_WallBeliefAdd(&algoArena.mazeMap, aheadX, aheadY, leftOf(aheadDir), checkLeftWall());
+	wallOpened |= wasWall && !algo_MazeMapHasKnownWall(&algoArena.mazeMap, aheadX, aheadY, leftOf(aheadDir));
+	wasWall = algo_MazeMapHasKnownWall(&algoArena.mazeMap, aheadX, aheadY, rightOf(aheadDir));
+	algo_WallBeliefAdd(&algoArena.mazeMap, aheadX, aheadY, rightOf(aheadDir), checkRightWall());
+	wallOpened |= wasWall && !algo_MazeMapHasKnownWall(&algoArena.mazeMap, aheadX, aheadY, rightOf(aheadDir));
+	algo_WallBeliefSetCertain(&algoArena.mazeMap, aheadX, aheadY, backOf(aheadDir), FALSE);
+	algo_MazeMapSetVisited(&algoArena.mazeMap, aheadX, aheadY);
+#if ALGO_WALL_INFERENCE_ENABLE
+	inferred = algo_WallInferAround(&algoArena.mazeMap, aheadX, aheadY);
+#endif
 
-	if(!mazeVisited[mazeIdx(x, y)]){
-		thisCell = mazeDiscovered[mazeIdx(x, y)] = detectWalls();
-		mazeVisited[mazeIdx(x, y)] = TRUE;
-		floodFill(mazeDiscovered, mazeFlood);
+	// update for an open front wall, the likely case, then forget it again
+	// until it is read, inference must not count on it
+	frontWallPending = TRUE;
+	frontAssumedOpen = !algo_MazeMapIsWallKnown(&algoArena.mazeMap, aheadX, aheadY, aheadDir)
+		&& algo_WallBeliefGetEvidence(aheadX, aheadY, aheadDir) == 0;
+	if(frontAssumedOpen)
+		algo_MazeMapSetWall(&algoArena.mazeMap, aheadX, aheadY, aheadDir, FALSE);
+	activeStrategy->algo_StrategyWallUpdate(&algoArena.mazeMap, aheadX, aheadY, inferred != 0 || wallOpened);
+	wallOpened = FALSE;
+	if(frontAssumedOpen)
+		algo_MazeMapGuessWall(&algoArena.mazeMap, aheadX, aheadY, aheadDir, FALSE);
+
+	planCells++;
+	planCellsHidden++;
+	planHiddenUs += mhi_CycleCountToUs(mhi_GetCycleCount() - startCount);
+}
+
+// read what senseAhead() left: the front wall, and side walls the reading on
+// the way in did not commit, the strategy was updated for an open front wall
+// already, so it only has to catch up if the walls turn out otherwise
+void finishCell(void)
+{
+	unsigned int inferred = 0;
+	bool changed;
+
+	frontWallPending = FALSE;
+	mci_SetLeftWallUpdateAvailable();
+	mci_SetRightWallUpdateAvailable();
+	readWall(curDir, checkFrontWall);
+	changed = !frontAssumedOpen || !algo_MazeMapIsWallKnown(&algoArena.mazeMap, x, y, curDir)
+		|| algo_MazeMapHasWall(&algoArena.mazeMap, x, y, curDir);
+	changed |= readWall(leftOf(curDir), checkLeftWall);
+	changed |= readWall(rightOf(curDir), checkRightWall);
+#if ALGO_WALL_INFERENCE_ENABLE
+	inferred = algo_WallInferAround(&algoArena.mazeMap, x, y);
+#endif
+	if(changed || inferred != 0)
+		activeStrategy->algo_StrategyWallUpdate(&algoArena.mazeMap, x, y, inferred != 0 || wallOpened);
+	wallOpened = FALSE;
+}
+
+// print how much planning the moves hid and how much the mouse waited for
+void printPlanTimes(void)
+{
+	mhi_PrintString("Plan cells: ");
+	mhi_PrintInt(planCells);
+	mhi_PrintString(", read driving: ");
+	mhi_PrintInt(planCellsHidden);
+	mhi_PrintString(", us hidden: ");
+	mhi_PrintInt(planHiddenUs);
+	mhi_PrintString(", us exposed: ");
+	mhi_PrintInt(planExposedUs);
+	if(planCells != 0){
+		mhi_PrintString(", exposed us/cell: ");
+		mhi_PrintInt(planExposedUs / planCells);
+	}
+#if ALGO_DEAD_END_PRUNING_ENABLE
+	mhi_PrintString(", pruned: ");
+	mhi_PrintInt(algo_PruneGetCount());
+#endif
+	mhi_PrintString("\n\r");
+}
+
+const algo_strategy_t* getFloodFillStrategy(void)
+{
+	return &floodFillStrategy;
+}
+
+// flood fill strategy: flood the map as it is, blank or restored from flash
+void floodInit(const algo_maze_map_t* map)
+{
+	stackTop = 0;
+#if ALGO_DEAD_END_PRUNING_ENABLE
+	algo_PruneClear();
+	algo_PruneUpdate(map);
+	algo_FloodFillWithin(map, mazeFlood, algo_PruneGetKeptCells());
+#else
+	algo_FloodFill(map, mazeFlood);
+#endif
+#if ALGO_EXPLORE_UNTIL_PROVEN_ENABLE
+	algo_ExploreUpdate(map, mazeFlood);
+#endif
+}
+
+// flood fill strategy: bring the flood map up to date w/ the new walls
+void floodWallUpdate(const algo_maze_map_t* map, unsigned int x, unsigned int y, bool inferred)
+{
+#if ALGO_DEAD_END_PRUNING_ENABLE
+	// a wall taken away can give a dead end its way out back
+	if(wallOpened)
+		algo_PruneClear();
+#if ALGO_INCREMENTAL_FLOOD_ENABLE
+	// inferred walls can be anywhere, the update only covers this cell: update
+	// w/in the cells kept so far, then take out the ones the new walls prune,
+	// no route of the others runs through them
+	if(!inferred){
+		algo_FloodUpdateWithin(map, mazeFlood, x, y, algo_PruneGetKeptCells());
+		if(algo_PruneUpdate(map) != 0)
+			algo_FloodClearCells(mazeFlood, algo_PruneGetNewCells());
 	}
 	else
-		thisCell = mazeDiscovered[mazeIdx(x, y)];
+#endif
+	{
+		algo_PruneUpdate(map);
+		algo_FloodFillWithin(map, mazeFlood, algo_PruneGetKeptCells());
+	}
+#else
+#if ALGO_INCREMENTAL_FLOOD_ENABLE
+	// inferred walls can be anywhere, the update only covers this cell
+	if(!inferred)
+		algo_FloodUpdate(map, mazeFlood, x, y);
+	else
+#endif
+		algo_FloodFill(map, mazeFlood);
+#endif
+#if ALGO_EXPLORE_UNTIL_PROVEN_ENABLE
+	algo_ExploreUpdate(map, mazeFlood);
+#endif
+}
 
+// flood fill strategy: the open unvisited neighbor closest to the goal, or
+// back out of a dead end when there is none
+bool floodChooseMoves(const algo_maze_map_t* map, unsigned int x, unsigned int y, unsigned int heading,
+	uint8_t* moves, unsigned int* moveCount)
+{
+	MazeCell thisCell;
 	unsigned int cost = UINT_MAX;
 	char nextDir;
 	bool foundUnvisitedCell = FALSE;
 
+	// neighbors may have filled in walls of this cell since it was visited
+	algo_MazeMapGetCellWalls(map, x, y, &thisCell);
+
+	// only through walls known to be open, a wall read once or twice may not
+	// be there
 	//north
 	if(isInRange(x, y+1))
-		if(!thisCell.northWall && !isExplored(x, y+1))
+		if(!thisCell.northWall && algo_MazeMapIsWallKnown(map, x, y, NORTH) && !isExplored(x, y+1) && isWorthVisiting(x, y+1))
 			if(mazeFlood[mazeIdx(x, y+1)] < cost){
 				nextDir = NORTH;
 				cost = mazeFlood[mazeIdx(x, y+1)];
@@ -77,7 +563,7 @@ bool traverseCell()
 
 	//east
 	if(isInRange(x+1, y))
-		if(!thisCell.eastWall && !isExplored(x+1, y))
+		if(!thisCell.eastWall && algo_MazeMapIsWallKnown(map, x, y, EAST) && !isExplored(x+1, y) && isWorthVisiting(x+1, y))
 			if(mazeFlood[mazeIdx(x+1, y)] < cost){
 				nextDir = EAST;
 				cost = mazeFlood[mazeIdx(x+1, y)];
@@ -86,7 +572,7 @@ bool traverseCell()
 
 	//south
 	if(isInRange(x, y-1))
-		if(!thisCell.southWall && !isExplored(x, y-1))
+		if(!thisCell.southWall && algo_MazeMapIsWallKnown(map, x, y, SOUTH) && !isExplored(x, y-1) && isWorthVisiting(x, y-1))
 			if(mazeFlood[mazeIdx(x, y-1)] < cost){
 				nextDir = SOUTH;
 				cost = mazeFlood[mazeIdx(x, y-1)];
@@ -95,7 +581,7 @@ bool traverseCell()
 
 	//west
 	if(isInRange(x-1, y))
-		if(!thisCell.westWall && !isExplored(x-1, y))
+		if(!thisCell.westWall && algo_MazeMapIsWallKnown(map, x, y, WEST) && !isExplored(x-1, y) && isWorthVisiting(x-1, y))
 			if(mazeFlood[mazeIdx(x-1, y)] < cost){
 				nextDir = WEST;
 				cost = mazeFlood[mazeIdx(x-1, y)];
@@ -103,112 +589,449 @@ bool traverseCell()
 			}
 
 	if(foundUnvisitedCell){
-		switch(nextDir){
-			case NORTH:
-				moveNorth();
-				push(moveStack, &stackTop, NORTH);
-				break;
-			case SOUTH:
-				moveSouth();
-				push(moveStack, &stackTop, SOUTH);
-				break;
-			case EAST:
-				moveEast();
-				push(moveStack, &stackTop, EAST);
-				break;
-			case WEST:
-				moveWest();
-				push(moveStack, &stackTop, WEST);
-				break;
-		}
+		moves[0] = nextDir;
+		*moveCount = 1;
+#if !ALGO_FRONTIER_BACKTRACK_ENABLE
+		push(moveStack, &stackTop, nextDir);
+#endif
+		return TRUE;
 	}
-	else{
-		char poppedMove = pop(moveStack, &stackTop);
-		switch(poppedMove){
-			case NORTH:
-				moveSouth();
+
+#if ALGO_FRONTIER_BACKTRACK_ENABLE
+	// nothing left to reach w/ walls known to be open
+	const algo_maze_row_t* allowed = NULL;
+#if ALGO_EXPLORE_UNTIL_PROVEN_ENABLE
+	allowed = algo_ExploreGetWorthCells();
+#elif ALGO_DEAD_END_PRUNING_ENABLE
+	allowed = algo_PruneGetKeptCells();
+#endif
+	return algo_FrontierPlan(map, allowed, x, y, heading, moves, moveCount);
+#else
+	// back at the start w/ nothing left worth visiting
+	if(stackTop == 0)
+		return FALSE;
+
+	switch(pop(moveStack, &stackTop)){
+		case NORTH:
+			moves[0] = SOUTH;
+			break;
+		case SOUTH:
+			moves[0] = NORTH;
+			break;
+		case EAST:
+			moves[0] = WEST;
+			break;
+		case WEST:
+			moves[0] = EAST;
+			break;
+	}
+	*moveCount = 1;
+	return TRUE;
+#endif
+}
+
+// flood fill strategy: done once the shortest route is proven, or in the
+// goal when not exploring for proof
+bool floodIsDone(const algo_maze_map_t* map, unsigned int x, unsigned int y, unsigned int heading)
+{
+#if ALGO_EXPLORE_UNTIL_PROVEN_ENABLE
+	return algo_ExploreIsRouteProven();
+#else
+	return isGoal(x,y);
+#endif
+}
+
+// save the maze map to flash and print how long it took, does nothing if
+// it has not changed since the last save
+bool saveMaze(void)
+{
+	uint32_t startCount;
+	uint32_t saveMs;
+	bool saved;
+
+	startCount = mhi_GetTimerCount();
+	saved = algo_MazeStoreSave(&algoArena.mazeMap, mazeExplored ? ALGO_MAZESTORE_FLAG_EXPLORED : 0);
+	saveMs = mhi_TimerCountToMs(mhi_GetTimerCount() - startCount);
+	cellsSinceSave = 0;
+
+	if(!saved){
+		mhi_PrintString("Maze save: flash error\n\r");
+		return FALSE;
+	}
+
+	mhi_PrintString("Maze saved, ms: ");
+	mhi_PrintInt(saveMs);
+	mhi_PrintString("\n\r");
+	return TRUE;
+}
+
+// restore the maze map saved in flash, call once at boot w/ the mouse back
+// at the start, returns FALSE if there is none
+bool restoreMaze(void)
+{
+	uint16_t flags;
+	uint32_t startCount;
+	uint32_t restoreMs;
+
+	startCount = mhi_GetTimerCount();
+	algo_WallBeliefClear();
+	if(!algo_MazeStoreRestore(&algoArena.mazeMap, &flags)){
+		mhi_PrintString("Maze restore: none saved\n\r");
+		return FALSE;
+	}
+	restoreMs = mhi_TimerCountToMs(mhi_GetTimerCount() - startCount);
+
+	// a reset puts the mouse back at the start
+	x = ALGO_MAZE_START_X;
+	y = ALGO_MAZE_START_Y;
+	curDir = ALGO_MAZE_START_HEADING;
+	cellsSinceSave = 0;
+	mazeExplored = (flags & ALGO_MAZESTORE_FLAG_EXPLORED) != 0;
+	startStrategy();
+
+	mhi_PrintString("Maze restored, explored: ");
+	mhi_PrintInt(mazeExplored);
+	mhi_PrintString(", restore ms: ");
+	mhi_PrintInt(restoreMs);
+	mhi_PrintString("\n\r");
+	return TRUE;
+}
+
+// erase the saved maze map and start over w/ a blank one, for a new maze
+bool forgetMaze(void)
+{
+	algo_MazeMapClear(&algoArena.mazeMap);
+	algo_WallBeliefClear();
+	x = ALGO_MAZE_START_X;
+	y = ALGO_MAZE_START_Y;
+	curDir = ALGO_MAZE_START_HEADING;
+	cellsSinceSave = 0;
+	mazeExplored = FALSE;
+	startStrategy();
+
+	return algo_MazeStoreErase();
+}
+
+// plan the fastest route over the walls found so far into speedRunRoute,
+// compile it into speedRunPrims, or plan it w/ diagonals straight into
+// speedRunPrims, w/ the times learned at the speed profile it is going to
+// run at, and print the estimated times and how long planning took
+bool planSpeedRun(unsigned int profile)
+{
+	algo_speedrun_model_t model;
+	uint32_t startCount;
+	uint32_t planMs;
+	bool found;
+
+	algo_SpeedRunGetDefaultModel(&model);
+#if ALGO_LEARNED_COSTS_ENABLE
+	model.p_costs = algo_CostModelGetTable(profile);
+#else
+	(void)profile;
+#endif
+
+	startCount = mhi_GetTimerCount();
+	found = algo_SpeedRunPlan(&algoArena.mazeMap, &model, &algoArena.speedRunRoute)
+		&& algo_SpeedRunCompileRoute(&model, &algoArena.speedRunRoute, &algoArena.speedRunPrims);
+	planMs = mhi_TimerCountToMs(mhi_GetTimerCount() - startCount);
+
+	if(!found){
+		mhi_PrintString("Speed run: no known route to goal\n\r");
+		algoArena.speedRunPrims.count = 0;
+		return FALSE;
+	}
+
+	mhi_PrintString("Speed run legs: ");
+	mhi_PrintInt(algoArena.speedRunRoute.legCount);
+	printSpeedRun(planMs);
+
+#if ALGO_SPEEDRUN_DIAGONAL_ENABLE
+	// the diagonal route is never slower, it can always fall back to the legs
+	startCount = mhi_GetTimerCount();
+	found = algo_SpeedRunPlanDiagonal(&algoArena.mazeMap, &model, &algoArena.speedRunPrims);
+	planMs = mhi_TimerCountToMs(mhi_GetTimerCount() - startCount);
+
+	if(!found){
+		mhi_PrintString("Speed run: diagonal route does not fit\n\r");
+		algo_SpeedRunCompileRoute(&model, &algoArena.speedRunRoute, &algoArena.speedRunPrims);
+		return TRUE;
+	}
+
+	mhi_PrintString("Speed run diagonal");
+	printSpeedRun(planMs);
+#endif
+
+	return TRUE;
+}
+
+// drive speedRunPrims back to back, w/o stopping between cells or waiting
+// between moves, from the start to wherever in the goal the route ends
+void runSpeedRun(void)
+{
+	runPrims(&algoArena.speedRunPrims);
+
+	x = ALGO_MAZE_START_X;
+	y = ALGO_MAZE_START_Y;
+	curDir = ALGO_MAZE_START_HEADING;
+	if(!algo_PrimEndCell(&algoArena.speedRunPrims, &x, &y, &curDir))
+		mhi_PrintString("ERROR: Speed run does not end in a cell!\n\r");
+}
+
+// drive back to the start over walls known to be open and face the way runs
+// start, returns FALSE if there is no known route; the drive takes over
+// speedRunPrims, plan the speed run again after
+bool returnToStart(void)
+{
+	unsigned int moveCount;
+
+	if(!algo_FrontierPlanTo(&algoArena.mazeMap, startCells, x, y, curDir, strategyMoves, &moveCount))
+		return FALSE;
+
+	if(moveCount != 0)
+		driveMoves(strategyMoves, moveCount);
+	turnTo(ALGO_MAZE_START_HEADING);
+	return TRUE;
+}
+
+// read the walls around the mouse, returns FALSE if one the map knows reads
+// otherwise: the mouse is not where algo.c thinks it is
+bool checkPosition(void)
+{
+	mci_SetLeftWallUpdateAvailable();
+	mci_SetRightWallUpdateAvailable();
+	if(algo_MazeMapIsWallKnown(&algoArena.mazeMap, x, y, curDir)
+		&& readsWall(checkFrontWall) != algo_MazeMapHasWall(&algoArena.mazeMap, x, y, curDir))
+		return FALSE;
+	if(algo_MazeMapIsWallKnown(&algoArena.mazeMap, x, y, leftOf(curDir))
+		&& readsWall(checkLeftWall) != algo_MazeMapHasWall(&algoArena.mazeMap, x, y, leftOf(curDir)))
+		return FALSE;
+	if(algo_MazeMapIsWallKnown(&algoArena.mazeMap, x, y, rightOf(curDir))
+		&& readsWall(checkRightWall) != algo_MazeMapHasWall(&algoArena.mazeMap, x, y, rightOf(curDir)))
+		return FALSE;
+
+	return TRUE;
+}
+
+// the mouse was put back in the start cell by hand, facing the way runs
+// start, after a crash or losing its way
+void placeAtStart(void)
+{
+	x = ALGO_MAZE_START_X;
+	y = ALGO_MAZE_START_Y;
+	curDir = ALGO_MAZE_START_HEADING;
+	frontWallPending = FALSE;
+	searchTurnPending = FALSE;
+	aheadChosen = FALSE;
+	mci_SetMoveMidpointTask(NULL);
+	mci_SetMoveSearchTurn(MCI_SEARCH_TURN_NONE);
+	mci_PlaceAtStart();
+}
+
+// TRUE once exploring proved the route, or a restored map had
+bool isMazeExplored(void)
+{
+	return mazeExplored;
+}
+
+// speed profile the moves run at from now on, the cost table their times
+// go into
+void setRunProfile(unsigned int profile)
+{
+	runProfile = profile;
+}
+
+// time the model expects the planned speed run to take
+uint32_t estimateSpeedRunMs(void)
+{
+	return algoArena.speedRunPrims.estimatedTimeUs / 1000;
+}
+
+// turn in place to face dir
+void turnTo(unsigned int dir)
+{
+	if(dir == leftOf(curDir))
+		mci_TurnLeft90DegreesPID();
+	else if(dir == rightOf(curDir))
+		mci_TurnRight90DegreesPID();
+	else if(dir == backOf(curDir)){
+		mci_TurnRight90DegreesPID();
+		mci_TurnRight90DegreesPID();
+	}
+	else
+		return;
+
+	curDir = dir;
+}
+
+// most of three readings of a wall, one bad reading must not lose the mouse
+bool readsWall(bool (*check)(void))
+{
+	unsigned int walls = 0;
+	unsigned int i;
+
+	for(i = 0; i < 3; i++)
+		if(check())
+			walls++;
+
+	return walls >= 2;
+}
+
+// queue the primitives for the control loop to drive back to back, w/o
+// stopping between straights, and add the time each move took to the cost
+// model as it finishes
+void runPrims(const algo_prim_list_t* prims)
+{
+	unsigned int i;
+	unsigned int type;
+	unsigned int count;
+
+	runMovesQueued = 0;
+	runMovesFinished = 0;
+	runMovesDoneBase = mci_GetMovesDone();
+	runStopsBase = mci_GetMotionQueueStops();
+	runMoveStartCount = mhi_GetCycleCount();
+	for(i = 0; i < prims->count && !runStopped(); i++){
+		type = prims->prims[i].type;
+		count = prims->prims[i].count;
+		switch(type){
+			case ALGO_PRIM_STRAIGHT:
+			case ALGO_PRIM_DIAGONAL:
+			case ALGO_PRIM_TURN_LEFT_45:
+			case ALGO_PRIM_TURN_RIGHT_45:
+			case ALGO_PRIM_TURN_LEFT_90:
+			case ALGO_PRIM_TURN_RIGHT_90:
+			case ALGO_PRIM_TURN_180:
+				queueRunMove(type, count);
 				break;
-			case SOUTH:
-				moveNorth();
+			case ALGO_PRIM_UTURN_LEFT:
+				queueRunMove(ALGO_PRIM_TURN_LEFT_90, 0);
+				queueRunMove(ALGO_PRIM_STRAIGHT, count);
+				queueRunMove(ALGO_PRIM_TURN_LEFT_90, 0);
 				break;
-			case EAST:
-				moveWest();
+			case ALGO_PRIM_UTURN_RIGHT:
+				queueRunMove(ALGO_PRIM_TURN_RIGHT_90, 0);
+				queueRunMove(ALGO_PRIM_STRAIGHT, count);
+				queueRunMove(ALGO_PRIM_TURN_RIGHT_90, 0);
 				break;
-			case WEST:
-				moveEast();
+			case ALGO_PRIM_JOG_LEFT:
+				queueRunMove(ALGO_PRIM_TURN_LEFT_90, 0);
+				queueRunMove(ALGO_PRIM_STRAIGHT, count);
+				queueRunMove(ALGO_PRIM_TURN_RIGHT_90, 0);
+				break;
+			case ALGO_PRIM_JOG_RIGHT:
+				queueRunMove(ALGO_PRIM_TURN_RIGHT_90, 0);
+				queueRunMove(ALGO_PRIM_STRAIGHT, count);
+				queueRunMove(ALGO_PRIM_TURN_LEFT_90, 0);
 				break;
 		}
 	}
-	
-	return isGoal(x,y);
+
+	while(runMovesFinished < runMovesQueued && !runStopped())
+		finishRunMoves();
 }
 
-void floodFill(MazeCell* srcMazeCells, unsigned int* destFlood){
-	for(int i = 0; i < MAZE_LENGTH * MAZE_LENGTH; i++)
-		destFlood[i] = UINT_MAX;
+// the control queue was dropped since the run started, so the moves still
+// queued never finish
+bool runStopped(void)
+{
+	return mci_GetMotionQueueStops() != runStopsBase;
+}
 
-	if(MAZE_LENGTH % 2)
-		floodFillRecurse(srcMazeCells, MAZE_LENGTH / 2, MAZE_LENGTH / 2, 0, destFlood);
-	else{
-		floodFillRecurse(srcMazeCells, (MAZE_LENGTH / 2) - 1, (MAZE_LENGTH / 2) - 1, 0, destFlood);
-		floodFillRecurse(srcMazeCells, (MAZE_LENGTH / 2) - 1, MAZE_LENGTH / 2,       0, destFlood);
-		floodFillRecurse(srcMazeCells, MAZE_LENGTH / 2,       (MAZE_LENGTH / 2) - 1, 0, destFlood);
-		floodFillRecurse(srcMazeCells, MAZE_LENGTH / 2,       MAZE_LENGTH / 2,       0, destFlood);
+// queue one move of the speed run, a full queue only holds the planner up,
+// the control loop drives on; a stopped run queues nothing more
+void queueRunMove(unsigned int type, unsigned int count)
+{
+	while(runMovesQueued - runMovesFinished == ALGO_RUN_MOVES_AHEAD || !pushRunMove(type, count)){
+		finishRunMoves();
+		if(runStopped())
+			return;
 	}
+
+	runMoveTypes[runMovesQueued % ALGO_RUN_MOVES_AHEAD] = (uint8_t)type;
+	runMoveCounts[runMovesQueued % ALGO_RUN_MOVES_AHEAD] = (uint8_t)count;
+	runMovesQueued++;
 }
 
-void floodFillRecurse(MazeCell* srcMazeCells, unsigned int x, unsigned int y, unsigned int cost, unsigned int* destFlood){
-	MazeCell mc = srcMazeCells[mazeIdx(x, y)];
-	destFlood[mazeIdx(x, y)] = cost;
+// hand a straight, a diagonal or a turn in place to the control loop,
+// returns FALSE if its queue is full
+bool pushRunMove(unsigned int type, unsigned int count)
+{
+	switch(type){
+		case ALGO_PRIM_STRAIGHT:
+			return mci_QueueForwardNHalfSquares(count);
+		case ALGO_PRIM_DIAGONAL:
+			return mci_QueueDiagonalNHalfSteps(count);
+		case ALGO_PRIM_TURN_LEFT_45:
+			return mci_QueueTurnDegrees(-45);
+		case ALGO_PRIM_TURN_RIGHT_45:
+			return mci_QueueTurnDegrees(45);
+		case ALGO_PRIM_TURN_LEFT_90:
+			return mci_QueueTurnDegrees(-90);
+		case ALGO_PRIM_TURN_RIGHT_90:
+			return mci_QueueTurnDegrees(90);
+		case ALGO_PRIM_TURN_180:
+			return mci_QueueTurnDegrees(180);
+	}
+	return TRUE;
+}
 
-	//north
-	if(isInRange(x, y+1))
-		if(!mc.northWall)
-			if(destFlood[mazeIdx(x, y+1)] > cost+1)
-				floodFillRecurse(srcMazeCells, x, y+1, cost+1, destFlood);
-	//south
-	if(isInRange(x, y-1))
-		if(!mc.southWall)
-			if(destFlood[mazeIdx(x, y-1)] > cost+1)
-				floodFillRecurse(srcMazeCells, x, y-1, cost+1, destFlood);
-	//east
-	if(isInRange(x+1, y))
-		if(!mc.eastWall)
-			if(destFlood[mazeIdx(x+1, y)] > cost+1)
-				floodFillRecurse(srcMazeCells, x+1, y, cost+1, destFlood);
-	//west
-	if(isInRange(x-1, y))
-		if(!mc.westWall)
-			if(destFlood[mazeIdx(x-1, y)] > cost+1)
-				floodFillRecurse(srcMazeCells, x-1, y, cost+1, destFlood);
+// steer the move under way and add the moves the control loop finished
+// since the last call to the cost model, timed from one finishing to the
+// next; a move a stop cut short is not timed
+void finishRunMoves(void)
+{
+	uint32_t nowCount;
+	unsigned int type;
+
+	mci_RunMotionQueue();
+	while(runMovesFinished < runMovesQueued && !runStopped() && mci_GetMovesDone() - runMovesDoneBase > runMovesFinished){
+		nowCount = mhi_GetCycleCount();
+		type = runMoveTypes[runMovesFinished % ALGO_RUN_MOVES_AHEAD];
+		algo_CostModelAdd(runProfile, type, (type == ALGO_PRIM_STRAIGHT || type == ALGO_PRIM_DIAGONAL)
+			? runMoveCounts[runMovesFinished % ALGO_RUN_MOVES_AHEAD] : 0, mhi_CycleCountToUs(nowCount - runMoveStartCount));
+		runMoveStartCount = nowCount;
+		runMovesFinished++;
+	}
 }
 
-unsigned int mazeIdx(unsigned int x, unsigned int y){
-	return (mirrorY(y) * MAZE_LENGTH) + x;
+// finish a speed run report line w/ the primitive count and times
+void printSpeedRun(uint32_t planMs)
+{
+	mhi_PrintString(", primitives: ");
+	mhi_PrintInt(algoArena.speedRunPrims.count);
+	mhi_PrintString(", estimated ms: ");
+	mhi_PrintInt(algoArena.speedRunPrims.estimatedTimeUs / 1000);
+	mhi_PrintString(", planning ms: ");
+	mhi_PrintInt(planMs);
+	mhi_PrintString("\n\r");
 }
 
-unsigned int mirrorY(unsigned int y){
-	return (MAZE_LENGTH - 1) - y;
+static inline unsigned int mazeIdx(unsigned int x, unsigned int y){
+	return ALGO_MAZE_IDX(x, y);
+}
+
+static inline unsigned int mirrorY(unsigned int y){
+	return ALGO_MAZE_MIRROR_Y(y);
 }
 
 bool isInRange(unsigned int x, unsigned int y){
-	return x >= 0 && x < MAZE_LENGTH && y >= 0 && y < MAZE_LENGTH;
+	return x < ALGO_MAZE_WIDTH && y < ALGO_MAZE_HEIGHT;
 }
 
 bool isGoal(unsigned int x, unsigned int y){
-	if(MAZE_LENGTH % 2){
-		return ((x == (MAZE_LENGTH / 2)) && (y == (MAZE_LENGTH / 2)));
-	}
-	else{
-		return (
-		( x == ((MAZE_LENGTH / 2) - 1) || x == (MAZE_LENGTH / 2) ) &&
-		( y == ((MAZE_LENGTH / 2) - 1) || y == (MAZE_LENGTH / 2) )
-		);
-	}
+	return ALGO_MAZE_IS_GOAL(x, y);
 }
 
 bool isExplored(unsigned int x, unsigned int y){
-	return mazeVisited[mazeIdx(x, y)];
+	return algo_MazeMapIsVisited(&algoArena.mazeMap, x, y);
+}
+
+bool isWorthVisiting(unsigned int x, unsigned int y){
+#if ALGO_EXPLORE_UNTIL_PROVEN_ENABLE
+	return algo_ExploreIsWorthVisiting(x, y);
+#else
+	return TRUE;
+#endif
 }
 
 char pop(char* stack, unsigned int* top){
@@ -240,23 +1063,19 @@ void moveForward(void)
 void moveBack(void)
 {
 	mci_TurnRight90DegreesPID();
-	mhi_DelayMs(100);
 	mci_TurnRight90DegreesPID();
-	mhi_DelayMs(100);
 	moveForward();
 }
 
 void moveLeft(void)
 {
 	mci_TurnLeft90DegreesPID();
-	mhi_DelayMs(100);
 	moveForward();
 }
 
 void moveRight(void)
 {
 	mci_TurnRight90DegreesPID();
-	mhi_DelayMs(100);
 	moveForward();
 }
 
@@ -340,72 +1159,76 @@ void moveWest(void)
 	curDir = WEST;
 }
 
-MazeCell detectWalls()
+// read the walls of the cell the mouse stands in, the back wall is the way
+// it came in
+void readWalls(void)
 {
-	MazeCell cell;
-	
-	cell.northWall = checkNorthWall();
-	cell.southWall = checkSouthWall();
-	cell.eastWall  = checkEastWall();
-	cell.westWall  = checkWestWall();
-		
-	return cell;
+	mci_SetLeftWallUpdateAvailable();
+	mci_SetRightWallUpdateAvailable();
+	readWall(curDir, checkFrontWall);
+	readWall(leftOf(curDir), checkLeftWall);
+	readWall(rightOf(curDir), checkRightWall);
+	if(!algo_MazeMapIsWallKnown(&algoArena.mazeMap, x, y, backOf(curDir)))
+		algo_WallBeliefSetCertain(&algoArena.mazeMap, x, y, backOf(curDir), checkBackWall());
 }
 
-bool checkNorthWall(void)
+// read one wall of the cell the mouse stands in until the readings commit
+// it or the read limit is up, returns TRUE if the map changed
+bool readWall(unsigned int dir, bool (*check)(void))
 {
-	switch(curDir){
-		case NORTH:
-			return checkFrontWall();
-		case SOUTH:
-			return checkBackWall();
-		case EAST:
-			return checkLeftWall();
-		case WEST:
-			return checkRightWall();
-	}	
+	unsigned int reads;
+	bool changed = FALSE;
+	bool wasWall;
+
+	wasWall = algo_MazeMapHasKnownWall(&algoArena.mazeMap, x, y, dir);
+	for(reads = 0; reads < algo_WallBeliefGetConfig()->maxReads
+		&& !algo_MazeMapIsWallKnown(&algoArena.mazeMap, x, y, dir); reads++)
+		changed |= algo_WallBeliefAdd(&algoArena.mazeMap, x, y, dir, check());
+	wallOpened |= wasWall && !algo_MazeMapHasKnownWall(&algoArena.mazeMap, x, y, dir);
+
+	return changed;
 }
 
-bool checkSouthWall(void)
+unsigned int leftOf(unsigned int dir)
 {
-	switch(curDir){
+	switch(dir){
 		case NORTH:
-			return checkBackWall();
+			return WEST;
 		case SOUTH:
-			return checkFrontWall();
+			return EAST;
 		case EAST:
-			return checkRightWall();
-		case WEST:
-			return checkLeftWall();
-	}		
+			return NORTH;
+		default:
+			return SOUTH;
+	}
 }
 
-bool checkEastWall(void)
+unsigned int rightOf(unsigned int dir)
 {
-	switch(curDir){
+	switch(dir){
 		case NORTH:
-			return checkRightWall();
+			return EAST;
 		case SOUTH:
-			return checkLeftWall();
+			return WEST;
 		case EAST:
-			return checkFrontWall();
-		case WEST:
-			return checkBackWall();
-	}		
+			return SOUTH;
+		default:
+			return NORTH;
+	}
 }
 
-bool checkWestWall(void)
+unsigned int backOf(unsigned int dir)
 {
-	switch(curDir){
+	switch(dir){
 		case NORTH:
-			return checkLeftWall();
+			return SOUTH;
 		case SOUTH:
-			return checkRightWall();
+			return NORTH;
 		case EAST:
-			return checkBackWall();
-		case WEST:
-			return checkFrontWall();
-	}		
+			return WEST;
+		default:
+			return EAST;
+	}
 }
 
 bool checkFrontWall(void)
@@ -418,7 +1241,7 @@ bool checkFrontWall(void)
 
 bool checkBackWall(void)
 {
-	if(x == 0 && y == 0)
+	if(x == ALGO_MAZE_START_X && y == ALGO_MAZE_START_Y)
 		return TRUE;
 	
 	return FALSE;
@@ -1,6 +1,10 @@
+#ifndef ALGO_H_
+#define ALGO_H_
+
 #include <stdbool.h>
+#include <stdint.h>
+#include "algo/mazeconfig_algo.h"
 
-#define MAZE_LENGTH 5
 #define NORTH 0
 #define SOUTH 1
 #define EAST  2
@@ -8,7 +12,11 @@
 #define FALSE 0
 #define TRUE  1
 #define UINT_MAX   65535
-#define STACK_SIZE 1000
+// a cell is pushed the first time it is entered
+#define STACK_SIZE ALGO_MAZE_CELL_COUNT
+// speed run moves queued ahead of the one the mouse drives, the control loop
+// holds a few of them at a time
+#define ALGO_RUN_MOVES_AHEAD 16
 
 typedef struct {
 	bool northWall;
@@ -18,3 +26,16 @@ typedef struct {
 } MazeCell;
 
 bool traverseCell();
+bool planSpeedRun(unsigned int profile);
+void runSpeedRun(void);
+bool returnToStart(void);
+bool checkPosition(void);
+void placeAtStart(void);
+bool isMazeExplored(void);
+void setRunProfile(unsigned int profile);
+uint32_t estimateSpeedRunMs(void);
+bool saveMaze(void);
+bool restoreMaze(void);
+bool forgetMaze(void);
+
+#endif /* ALGO_H_ */
@@ -0,0 +1,60 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : arena_algo.c
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : algo layer
+*
+* This is the source file for the planner arena.
+*
+* The arena is zeroed w/ the rest of .bss at reset, which every module
+* expects of its members, the same as it did of its own globals.
+*
+* The algo layer defines all mouse maze solving algorithms as the second most
+* highest layer to be called directly in main.
+*-----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdint.h>
+#include "algo/mazeconfig_algo.h"
+#include "algo/arena_algo.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+/* the preprocessor can not size the arena, so an arena too big for
+   ALGO_ARENA_SIZE makes this array size negative and fails the build */
+typedef char algo_arena_exceeds_ALGO_ARENA_SIZE
+    [(sizeof(algo_arena_t) <= ALGO_ARENA_SIZE) ? 1 : -1];
+
+/*----------------------------------------------------------------------------*/
+/*                               Debug Switches                               */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+algo_arena_t algoArena;
+
+/*----------------------------------------------------------------------------*/
+/*                    Private (Static) Function Prototype                     */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                           Local Shared Functions                           */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                         Private (Static) Functions                         */
+/*----------------------------------------------------------------------------*/
+/* None */
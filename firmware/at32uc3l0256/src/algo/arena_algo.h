@@ -0,0 +1,112 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : arena_algo.h
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : algo layer
+*
+* This is the header file for the planner arena.
+*
+* Every map, flood, queue, route and primitive list the planner works on is
+* a member of the one arena below instead of a global of its own module, so
+* the planner takes a known amount of RAM, set by the maze configuration,
+* and the linker places it in one piece. Each module keeps its own names
+* for its members, see the Global Variables of each source file.
+*
+* The arena has to fit ALGO_ARENA_SIZE, see mazeconfig_algo.h, or
+* arena_algo.c does not compile. Counters, flags and constant tables such
+* as the start cell target of algo.c stay in their modules, and the only
+* arrays left on the stack are the flash chunks of the maze store and the
+* cost model. No planner function recurses.
+*
+* The firmware links w/ read-only data in the writable data section, so
+* constant tables are copied to RAM at startup too; they only keep off the
+* stack. make ramreport in test_software/c_benchmarks lists the planner
+* data, read-only data and bss of every maze configuration from the linker
+* map.
+*
+* The algo layer defines all mouse maze solving algorithms as the second most
+* highest layer to be called directly in main.
+*-----------------------------------------------------------------------------*/
+
+#ifndef ARENA_ALGO_H_
+#define ARENA_ALGO_H_
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdint.h>
+#include "algo/algo.h"
+#include "algo/mazemap_algo.h"
+#include "algo/floodfill_algo.h"
+#include "algo/primitive_algo.h"
+#include "algo/speedrun_algo.h"
+#include "algo/costmodel_algo.h"
+#include "algo/strategy_algo.h"
+#include "algo/wallinfer_algo.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+typedef struct
+{
+    /* algo.c: the map being explored, its goal flood, the moves to drive
+       next, the speed run and its moves queued for the control loop */
+    algo_maze_map_t mazeMap;
+    uint16_t mazeFlood[ALGO_MAZE_CELL_COUNT];
+    char moveStack[STACK_SIZE];
+    uint8_t strategyMoves[ALGO_STRATEGY_MAX_MOVES];
+    algo_speedrun_route_t speedRunRoute;
+    algo_prim_list_t speedRunPrims;
+    uint8_t runMoveTypes[ALGO_RUN_MOVES_AHEAD];
+    uint8_t runMoveCounts[ALGO_RUN_MOVES_AHEAD];
+
+    /* floodfill_algo.c: breadth first queue and the cells an update raised */
+    uint16_t floodQueue[ALGO_FLOOD_QUEUE_SIZE];
+    uint8_t floodMark[ALGO_FLOOD_QUEUE_SIZE];
+    uint16_t floodAffected[ALGO_FLOOD_QUEUE_SIZE];
+
+    /* explore_algo.c and frontier_algo.c: their own floods */
+    uint16_t exploreFlood[ALGO_MAZE_CELL_COUNT];
+    algo_maze_row_t exploreWorth[ALGO_MAZE_HEIGHT];
+    uint16_t frontierFlood[ALGO_MAZE_CELL_COUNT];
+    algo_maze_row_t frontierCells[ALGO_MAZE_HEIGHT];
+
+    /* prune_algo.c: cells kept and newly pruned */
+    algo_maze_row_t pruneKept[ALGO_MAZE_HEIGHT];
+    algo_maze_row_t pruneNew[ALGO_MAZE_HEIGHT];
+
+    /* wallinfer_algo.c: posts waiting to be checked */
+    uint16_t inferPostStack[ALGO_WALLINFER_POST_COUNT + 1u];
+    algo_maze_row_t inferPostQueued[ALGO_MAZE_HEIGHT];
+
+    /* wallbelief_algo.c: evidence for each north and east wall */
+    int8_t beliefNorth[ALGO_MAZE_CELL_COUNT];
+    int8_t beliefEast[ALGO_MAZE_CELL_COUNT];
+
+    /* speedrun_algo.c: search state and run times of the model planned w/ */
+    uint32_t speedRunDist[ALGO_SPEEDRUN_STATE_COUNT];
+    uint16_t speedRunPrev[ALGO_SPEEDRUN_STATE_COUNT];
+    uint16_t speedRunHeap[ALGO_SPEEDRUN_STATE_COUNT];
+    uint16_t speedRunHeapPos[ALGO_SPEEDRUN_STATE_COUNT];
+    uint32_t speedRunStraightUs[ALGO_SPEEDRUN_MAX_STRAIGHT + 1u];
+#if ALGO_SPEEDRUN_DIAGONAL_ENABLE
+    uint32_t speedRunHalfUs[(2u * ALGO_SPEEDRUN_MAX_STRAIGHT) + 1u];
+    uint32_t speedRunDiagUs[(2u * ALGO_SPEEDRUN_MAX_STRAIGHT) + 1u];
+#endif
+
+    /* costmodel_algo.c: primitive times learned so far, by speed profile */
+    algo_cost_table_t costTables[ALGO_COSTMODEL_PROFILE_COUNT];
+} algo_arena_t;
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+extern algo_arena_t algoArena;
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+#endif /* ARENA_ALGO_H_ */
@@ -0,0 +1,447 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : costmodel_algo.c
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : algo layer
+*
+* This is the source file for the learned cost model.
+*
+* An entry is the plain mean of its first ALGO_COSTMODEL_WINDOW times, then
+* an exponential average that moves 1/ALGO_COSTMODEL_WINDOW of the way to
+* every new time, so a change of gains or speed shows within a few runs.
+*
+* The tables of all speed profiles are saved as one record w/ a CRC in the
+* last pages of the flash storage region, the maze store keeps off them. A
+* record is a header, then the tables as they are in RAM, safe profile
+* first:
+*   magic, CRC, entry count, window, profile count, tables
+* The tables are written before the header, so a save cut short leaves no
+* magic or a bad CRC, and the next boot starts from empty tables.
+*
+* The algo layer defines all mouse maze solving algorithms as the second most
+* highest layer to be called directly in main.
+*-----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "algo/algo.h"
+#include "algo/primitive_algo.h"
+#include "algo/costmodel_algo.h"
+#include "algo/arena_algo.h"
+#include "shared_functions/crc_sf.h"
+#include "mouse_hardware_interface/flash_mhi.h"
+#include "mouse_hardware_interface/usart_mhi.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+#define ALGO_COSTMODEL_MAGIC        (0x4354u)   /* "CT" */
+#define ALGO_COSTMODEL_CHUNK        (32u)       /* bytes read at a time */
+
+/* first entry of each kind */
+#define ALGO_COSTMODEL_TURN_45      (0u)
+#define ALGO_COSTMODEL_TURN_90      (1u)
+#define ALGO_COSTMODEL_TURN_180     (2u)
+#define ALGO_COSTMODEL_STRAIGHT     (ALGO_COSTMODEL_TURN_COUNT)
+#define ALGO_COSTMODEL_DIAGONAL \
+    (ALGO_COSTMODEL_STRAIGHT + ALGO_COSTMODEL_MAX_COUNT)
+
+#define ALGO_COSTMODEL_NO_ENTRY     (0xFFFFu)
+
+typedef struct
+{
+    uint16_t magic;
+    uint16_t crc;               /* CRC-16 of entry count through the tables */
+    uint16_t entries;           /* ALGO_COSTMODEL_ENTRY_COUNT */
+    uint8_t window;             /* ALGO_COSTMODEL_WINDOW */
+    uint8_t profiles;           /* ALGO_COSTMODEL_PROFILE_COUNT */
+} algo_costmodel_header_t;
+
+/* header bytes covered by the CRC */
+#define ALGO_COSTMODEL_CRC_OFFSET   (offsetof(algo_costmodel_header_t, entries))
+#define ALGO_COSTMODEL_CRC_HEADER \
+    (sizeof(algo_costmodel_header_t) - ALGO_COSTMODEL_CRC_OFFSET)
+#define ALGO_COSTMODEL_TABLES_SIZE \
+    (ALGO_COSTMODEL_PROFILE_COUNT * sizeof(algo_cost_table_t))
+#define ALGO_COSTMODEL_RECORD_SIZE \
+    (sizeof(algo_costmodel_header_t) + ALGO_COSTMODEL_TABLES_SIZE)
+
+/*----------------------------------------------------------------------------*/
+/*                               Debug Switches                               */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+static algo_cost_table_t* const costTables = algoArena.costTables;
+
+/*----------------------------------------------------------------------------*/
+/*                    Private (Static) Function Prototype                     */
+/*----------------------------------------------------------------------------*/
+static unsigned int algo_CostModelGetEntry(unsigned int type,
+    unsigned int count);
+static bool algo_CostModelGetOffset(uint32_t* p_offset, uint32_t* p_page,
+    uint32_t* p_pageCount);
+static void algo_CostModelMakeHeader(algo_costmodel_header_t* p_header);
+static bool algo_CostModelFlashMatches(uint32_t offset, const void* p_data,
+    uint32_t size);
+static void algo_CostModelPrintEntry(unsigned int profile,
+    const char* p_kind, unsigned int count, unsigned int entry);
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+/**
+* Forget every time of every profile, back to the planner's motion model
+*
+* \param None
+* \retval None
+*/
+void algo_CostModelClear(void)
+{
+    memset(costTables, 0, ALGO_COSTMODEL_TABLES_SIZE);
+}
+
+/**
+* Add the time a primitive took to its running average
+*
+* \param[in] profile Speed profile it ran at
+* \param[in] type    algo_prim_type_t, combined primitives are timed as the
+*                    turns and straight they run as
+* \param[in] count   Half squares or half steps of a drive
+* \param[in] timeUs  Time it took
+* \retval None
+*/
+void algo_CostModelAdd(unsigned int profile, unsigned int type,
+    unsigned int count, uint32_t timeUs)
+{
+    unsigned int entry = algo_CostModelGetEntry(type, count);
+    algo_cost_table_t* p_costTable = NULL;
+    uint32_t weight = 0u;
+    int32_t step = 0;
+
+    if ((profile >= ALGO_COSTMODEL_PROFILE_COUNT)
+        || (entry == ALGO_COSTMODEL_NO_ENTRY))
+        return;
+
+    p_costTable = &costTables[profile];
+
+    if (p_costTable->samples[entry] < UINT16_MAX)
+        p_costTable->samples[entry]++;
+
+    weight = p_costTable->samples[entry];
+    if (weight > ALGO_COSTMODEL_WINDOW)
+        weight = ALGO_COSTMODEL_WINDOW;
+
+    step = ((int32_t)timeUs - (int32_t)p_costTable->meanUs[entry])
+        / (int32_t)weight;
+    p_costTable->meanUs[entry] =
+        (uint32_t)((int32_t)p_costTable->meanUs[entry] + step);
+}
+
+/**
+* Learned time of a primitive
+*
+* \param[in]  p_table  Table to look in
+* \param[in]  type     algo_prim_type_t
+* \param[in]  count    Half squares or half steps of a drive
+* \param[out] p_timeUs Average time, left alone if not learned yet
+* \retval TRUE if the entry has ALGO_COSTMODEL_MIN_SAMPLES times
+*/
+bool algo_CostModelGetUs(const algo_cost_table_t* p_table, unsigned int type,
+    unsigned int count, uint32_t* p_timeUs)
+{
+    unsigned int entry = algo_CostModelGetEntry(type, count);
+
+    if ((p_table == NULL) || (entry == ALGO_COSTMODEL_NO_ENTRY)
+        || (p_table->samples[entry] < ALGO_COSTMODEL_MIN_SAMPLES))
+        return FALSE;
+
+    *p_timeUs = p_table->meanUs[entry];
+    return TRUE;
+}
+
+/**
+* Table learned so far at a speed profile, for the planner's motion model
+*
+* \param[in] profile Speed profile the run is planned for
+* \retval Table, NULL for a profile w/o one
+*/
+const algo_cost_table_t* algo_CostModelGetTable(unsigned int profile)
+{
+    if (profile >= ALGO_COSTMODEL_PROFILE_COUNT)
+        return NULL;
+
+    return &costTables[profile];
+}
+
+/**
+* Save the tables to flash, does nothing if flash already holds them
+*
+* \param None
+* \retval TRUE if the tables are in flash, saved now or before
+*/
+bool algo_CostModelSave(void)
+{
+    algo_costmodel_header_t header;
+    uint32_t offset = 0u;
+    uint32_t page = 0u;
+    uint32_t pageCount = 0u;
+
+    if (!algo_CostModelGetOffset(&offset, &page, &pageCount))
+        return FALSE;
+
+    algo_CostModelMakeHeader(&header);
+    if (algo_CostModelFlashMatches(offset, &header, sizeof(header))
+        && algo_CostModelFlashMatches(offset + sizeof(header), costTables,
+            ALGO_COSTMODEL_TABLES_SIZE))
+        return TRUE;
+
+    for (; pageCount > 0u; pageCount--, page++)
+    {
+        if (!mhi_EraseFlashStorePage(page))
+            return FALSE;
+    }
+
+    /* tables first, the header makes the record valid, then read it back */
+    return mhi_WriteFlashStore(offset + sizeof(header), costTables,
+            ALGO_COSTMODEL_TABLES_SIZE)
+        && mhi_WriteFlashStore(offset, &header, sizeof(header))
+        && algo_CostModelFlashMatches(offset, &header, sizeof(header))
+        && algo_CostModelFlashMatches(offset + sizeof(header), costTables,
+            ALGO_COSTMODEL_TABLES_SIZE);
+}
+
+/**
+* Restore the tables saved in flash, call once at boot
+*
+* \param None
+* \retval TRUE if the tables were restored, they are empty if not
+*/
+bool algo_CostModelRestore(void)
+{
+    algo_costmodel_header_t header;
+    uint32_t offset = 0u;
+    uint32_t page = 0u;
+    uint32_t pageCount = 0u;
+    uint16_t crc = 0u;
+
+    if (!algo_CostModelGetOffset(&offset, &page, &pageCount)
+        || !mhi_ReadFlashStore(offset, &header, sizeof(header))
+        || (header.magic != ALGO_COSTMODEL_MAGIC)
+        || (header.entries != ALGO_COSTMODEL_ENTRY_COUNT)
+        || (header.window != ALGO_COSTMODEL_WINDOW)
+        || (header.profiles != ALGO_COSTMODEL_PROFILE_COUNT)
+        || !mhi_ReadFlashStore(offset + sizeof(header), costTables,
+            ALGO_COSTMODEL_TABLES_SIZE))
+    {
+        algo_CostModelClear();
+        return FALSE;
+    }
+
+    crc = sf_Crc16(SF_CRC16_INIT,
+        (const uint8_t*)&header + ALGO_COSTMODEL_CRC_OFFSET,
+        ALGO_COSTMODEL_CRC_HEADER);
+    crc = sf_Crc16(crc, costTables, ALGO_COSTMODEL_TABLES_SIZE);
+    if (crc != header.crc)
+    {
+        algo_CostModelClear();
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+* Pages at the end of the flash storage region the saved tables take
+*
+* \param[in] pageSize Flash page size
+* \retval Page count
+*/
+uint32_t algo_CostModelGetStorePages(uint32_t pageSize)
+{
+    if (pageSize == 0u)
+        return 0u;
+
+    return (ALGO_COSTMODEL_RECORD_SIZE + pageSize - 1u) / pageSize;
+}
+
+/**
+* Print every entry w/ a time in it over the USART as CSV:
+*   profile,kind,count,samples,mean_us
+* kind is turn (count in degrees), straight (count in half squares) or
+* diagonal (count in half steps)
+*
+* \param None
+* \retval None
+*/
+void algo_CostModelExport(void)
+{
+    unsigned int profile = 0u;
+    unsigned int count = 0u;
+
+    mhi_PrintString("profile,kind,count,samples,mean_us\n\r");
+    for (profile = 0u; profile < ALGO_COSTMODEL_PROFILE_COUNT; profile++)
+    {
+        algo_CostModelPrintEntry(profile, "turn", 45u,
+            ALGO_COSTMODEL_TURN_45);
+        algo_CostModelPrintEntry(profile, "turn", 90u,
+            ALGO_COSTMODEL_TURN_90);
+        algo_CostModelPrintEntry(profile, "turn", 180u,
+            ALGO_COSTMODEL_TURN_180);
+        for (count = 1u; count <= ALGO_COSTMODEL_MAX_COUNT; count++)
+            algo_CostModelPrintEntry(profile, "straight", count,
+                ALGO_COSTMODEL_STRAIGHT + count - 1u);
+        for (count = 1u; count <= ALGO_COSTMODEL_MAX_COUNT; count++)
+            algo_CostModelPrintEntry(profile, "diagonal", count,
+                ALGO_COSTMODEL_DIAGONAL + count - 1u);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/*                           Local Shared Functions                           */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                         Private (Static) Functions                         */
+/*----------------------------------------------------------------------------*/
+/**
+* Table entry of a primitive
+*
+* \param[in] type  algo_prim_type_t
+* \param[in] count Half squares or half steps of a drive
+* \retval Entry, ALGO_COSTMODEL_NO_ENTRY for combined primitives and drives
+*         out of range
+*/
+static unsigned int algo_CostModelGetEntry(unsigned int type,
+    unsigned int count)
+{
+    switch (type)
+    {
+        case ALGO_PRIM_TURN_LEFT_45:
+        case ALGO_PRIM_TURN_RIGHT_45:
+            return ALGO_COSTMODEL_TURN_45;
+        case ALGO_PRIM_TURN_LEFT_90:
+        case ALGO_PRIM_TURN_RIGHT_90:
+            return ALGO_COSTMODEL_TURN_90;
+        case ALGO_PRIM_TURN_180:
+            return ALGO_COSTMODEL_TURN_180;
+        case ALGO_PRIM_STRAIGHT:
+        case ALGO_PRIM_DIAGONAL:
+            if ((count == 0u) || (count > ALGO_COSTMODEL_MAX_COUNT))
+                return ALGO_COSTMODEL_NO_ENTRY;
+            return ((type == ALGO_PRIM_STRAIGHT) ? ALGO_COSTMODEL_STRAIGHT
+                : ALGO_COSTMODEL_DIAGONAL) + count - 1u;
+    }
+
+    return ALGO_COSTMODEL_NO_ENTRY;
+}
+
+/**
+* Where the record goes in the flash storage region
+*
+* \param[out] p_offset    Byte offset of the record
+* \param[out] p_page      First page of the record
+* \param[out] p_pageCount Pages of the record
+* \retval FALSE if the storage region cannot hold it and a maze map
+*/
+static bool algo_CostModelGetOffset(uint32_t* p_offset, uint32_t* p_page,
+    uint32_t* p_pageCount)
+{
+    uint32_t pageSize = 0u;
+    uint32_t pageCount = 0u;
+
+    if (!mhi_GetFlashStoreGeometry(&pageSize, &pageCount) || (pageSize == 0u))
+        return FALSE;
+
+    *p_pageCount = algo_CostModelGetStorePages(pageSize);
+    if (*p_pageCount >= pageCount)
+        return FALSE;
+
+    *p_page = pageCount - *p_pageCount;
+    *p_offset = *p_page * pageSize;
+    return TRUE;
+}
+
+/**
+* Header of a record holding the tables as they are
+*
+* \param[out] p_header Header w/ the CRC
+* \retval None
+*/
+static void algo_CostModelMakeHeader(algo_costmodel_header_t* p_header)
+{
+    p_header->magic = ALGO_COSTMODEL_MAGIC;
+    p_header->entries = ALGO_COSTMODEL_ENTRY_COUNT;
+    p_header->window = ALGO_COSTMODEL_WINDOW;
+    p_header->profiles = ALGO_COSTMODEL_PROFILE_COUNT;
+    p_header->crc = sf_Crc16(SF_CRC16_INIT,
+        (const uint8_t*)p_header + ALGO_COSTMODEL_CRC_OFFSET,
+        ALGO_COSTMODEL_CRC_HEADER);
+    p_header->crc = sf_Crc16(p_header->crc, costTables,
+        ALGO_COSTMODEL_TABLES_SIZE);
+}
+
+/**
+* Whether flash holds the given bytes
+*
+* \param[in] offset Byte offset into the storage region
+* \param[in] p_data Bytes to compare
+* \param[in] size   Number of bytes
+* \retval TRUE if they match
+*/
+static bool algo_CostModelFlashMatches(uint32_t offset, const void* p_data,
+    uint32_t size)
+{
+    uint8_t chunk[ALGO_COSTMODEL_CHUNK];
+    const uint8_t* p_byte = (const uint8_t*)p_data;
+    uint32_t part = 0u;
+
+    for (; size > 0u; size -= part)
+    {
+        part = (size > sizeof(chunk)) ? sizeof(chunk) : size;
+        if (!mhi_ReadFlashStore(offset, chunk, part)
+            || memcmp(chunk, p_byte, part) != 0)
+            return FALSE;
+        offset += part;
+        p_byte += part;
+    }
+
+    return TRUE;
+}
+
+/**
+* Print one CSV line of the export, nothing for an entry w/o times
+*
+* \param[in] profile Speed profile of the table
+* \param[in] p_kind  Kind of primitive
+* \param[in] count   Degrees, half squares or half steps
+* \param[in] entry   Table entry
+* \retval None
+*/
+static void algo_CostModelPrintEntry(unsigned int profile,
+    const char* p_kind, unsigned int count, unsigned int entry)
+{
+    const algo_cost_table_t* p_costTable = &costTables[profile];
+
+    if (p_costTable->samples[entry] == 0u)
+        return;
+
+    mhi_PrintInt(profile);
+    mhi_PrintString(",");
+    mhi_PrintString(p_kind);
+    mhi_PrintString(",");
+    mhi_PrintInt(count);
+    mhi_PrintString(",");
+    mhi_PrintInt(p_costTable->samples[entry]);
+    mhi_PrintString(",");
+    mhi_PrintInt(p_costTable->meanUs[entry]);
+    mhi_PrintString("\n\r");
+}
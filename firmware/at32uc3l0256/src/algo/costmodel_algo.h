@@ -0,0 +1,85 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : costmodel_algo.h
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : algo layer
+*
+* This is the header file for the learned cost model.
+*
+* Every primitive the mouse runs is timed, and the times are kept as running
+* averages in a table: one entry for each turn in place (45, 90 and 180
+* degrees, left and right alike) and one for each straight and diagonal
+* length. The speed run planner takes an entry over its motion model once
+* it has ALGO_COSTMODEL_MIN_SAMPLES times in it, so the plans follow the
+* gains and floor the mouse actually has.
+*
+* Each speed profile has a table of its own, a turn at the fast profile
+* takes nothing like the time it takes at the safe one. Primitives are timed
+* into the table of the profile they ran at, and a speed run is planned w/
+* the table of the profile it is going to run at.
+*
+* The tables are kept in flash, in the last pages of the storage region,
+* and can be printed over the USART as CSV for offline analysis.
+*
+* The algo layer defines all mouse maze solving algorithms as the second most
+* highest layer to be called directly in main.
+*-----------------------------------------------------------------------------*/
+
+#ifndef COSTMODEL_ALGO_H_
+#define COSTMODEL_ALGO_H_
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdint.h>
+#include "algo/algo.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+/* longest straight or diagonal in half squares or half steps */
+#define ALGO_COSTMODEL_MAX_COUNT \
+    (2u * ((ALGO_MAZE_WIDTH > ALGO_MAZE_HEIGHT) \
+        ? ALGO_MAZE_WIDTH : ALGO_MAZE_HEIGHT))
+
+/* the three turns, then the straights and diagonals by length */
+#define ALGO_COSTMODEL_TURN_COUNT   (3u)
+#define ALGO_COSTMODEL_ENTRY_COUNT \
+    (ALGO_COSTMODEL_TURN_COUNT + (2u * ALGO_COSTMODEL_MAX_COUNT))
+
+/* speed profiles w/ a table of their own, see runmanager_algo.h */
+#define ALGO_COSTMODEL_PROFILE_COUNT (4u)
+
+/* times an entry needs before the planner takes it */
+#define ALGO_COSTMODEL_MIN_SAMPLES  (2u)
+
+/* the average follows the last this many times, older ones fade out */
+#define ALGO_COSTMODEL_WINDOW       (16u)
+
+typedef struct
+{
+    uint32_t meanUs[ALGO_COSTMODEL_ENTRY_COUNT];    /* running average */
+    uint16_t samples[ALGO_COSTMODEL_ENTRY_COUNT];   /* times, saturating */
+} algo_cost_table_t;
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+void algo_CostModelClear(void);
+void algo_CostModelAdd(unsigned int profile, unsigned int type,
+    unsigned int count, uint32_t timeUs);
+bool algo_CostModelGetUs(const algo_cost_table_t* p_table, unsigned int type,
+    unsigned int count, uint32_t* p_timeUs);
+const algo_cost_table_t* algo_CostModelGetTable(unsigned int profile);
+bool algo_CostModelSave(void);
+bool algo_CostModelRestore(void);
+uint32_t algo_CostModelGetStorePages(uint32_t pageSize);
+void algo_CostModelExport(void);
+
+#endif /* COSTMODEL_ALGO_H_ */
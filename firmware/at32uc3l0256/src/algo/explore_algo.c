@@ -0,0 +1,145 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : explore_algo.c
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : algo layer
+*
+* This is the source file for the exploration stop rule.
+*
+* A cell is worth visiting when the optimistic route through it, cells from
+* the start plus cells to the goal, is shorter than the proven route. New
+* walls only make optimistic routes longer and proven routes shorter, so a
+* cell that is not worth visiting never becomes worth it again. Visiting
+* every cell worth it proves the route: the first cell of an unproven
+* shortest route that has not been visited is always one of them.
+*
+* Each update floods through the known walls from the goal and through the
+* optimistic walls from the start, reusing one scratch flood map, and keeps
+* the result as a bit per cell.
+*
+* The algo layer defines all mouse maze solving algorithms as the second most
+* highest layer to be called directly in main.
+*-----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdint.h>
+#include "algo/algo.h"
+#include "algo/mazemap_algo.h"
+#include "algo/floodfill_algo.h"
+#include "algo/explore_algo.h"
+#include "algo/arena_algo.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                               Debug Switches                               */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+/* pessimistic goal flood, then optimistic start flood */
+static uint16_t* const exploreFlood = algoArena.exploreFlood;
+
+/* cells worth visiting, a row of cells per word like the maze map */
+static algo_maze_row_t* const exploreWorth = algoArena.exploreWorth;
+static unsigned int exploreWorthCount = 0u;
+
+static bool exploreProven = FALSE;
+
+/*----------------------------------------------------------------------------*/
+/*                    Private (Static) Function Prototype                     */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+/**
+* Work out whether the route is proven and which cells are worth visiting
+*
+* \param[in] p_map       Walls discovered so far
+* \param[in] p_goalFlood Optimistic flood map to the goal, up to date w/ p_map
+* \retval None
+*/
+void algo_ExploreUpdate(const algo_maze_map_t* p_map,
+    const uint16_t* p_goalFlood)
+{
+    unsigned int startIdx = ALGO_MAZE_IDX(ALGO_MAZE_START_X, ALGO_MAZE_START_Y);
+    unsigned int proven = 0u;
+    unsigned int idx = 0u;
+    unsigned int y = 0u;
+
+    for (y = 0u; y < ALGO_MAZE_HEIGHT; y++)
+        exploreWorth[y] = 0u;
+    exploreWorthCount = 0u;
+
+    algo_FloodFillKnown(p_map, exploreFlood);
+    proven = exploreFlood[startIdx];
+
+    /* no route at all is as proven as it gets */
+    exploreProven = (proven == p_goalFlood[startIdx]);
+    if (exploreProven)
+        return;
+
+    algo_FloodFillFrom(p_map, exploreFlood, ALGO_MAZE_START_X, ALGO_MAZE_START_Y);
+    for (idx = 0u; idx < ALGO_MAZE_CELL_COUNT; idx++)
+        if ((exploreFlood[idx] != UINT_MAX) && (p_goalFlood[idx] != UINT_MAX)
+            && ((unsigned int)exploreFlood[idx] + p_goalFlood[idx] < proven))
+        {
+            exploreWorth[ALGO_MAZE_IDX_Y(idx)] |= ALGO_MAZE_ROW_BIT(ALGO_MAZE_IDX_X(idx));
+            exploreWorthCount++;
+        }
+}
+
+/**
+* Whether the walls seen so far prove the shortest route
+*
+* \param None
+* \retval TRUE once no unseen wall can make the route shorter
+*/
+bool algo_ExploreIsRouteProven(void)
+{
+    return exploreProven;
+}
+
+/**
+* Whether a cell lies on an optimistic route shorter than the proven one
+*
+* \param[in] x Cell column
+* \param[in] y Cell row
+* \retval TRUE if seeing its walls could still shorten the route
+*/
+bool algo_ExploreIsWorthVisiting(unsigned int x, unsigned int y)
+{
+    return (exploreWorth[y] & ALGO_MAZE_ROW_BIT(x)) != 0u;
+}
+
+/**
+* Cells worth visiting after the last update
+*
+* \param None
+* \retval A row of cells per word, ALGO_MAZE_HEIGHT rows
+*/
+const algo_maze_row_t* algo_ExploreGetWorthCells(void)
+{
+    return exploreWorth;
+}
+
+/**
+* Number of cells worth visiting after the last update
+*
+* \param None
+* \retval Cells
+*/
+unsigned int algo_ExploreGetWorthCount(void)
+{
+    return exploreWorthCount;
+}
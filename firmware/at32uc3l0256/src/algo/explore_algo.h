@@ -0,0 +1,52 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : explore_algo.h
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : algo layer
+*
+* This is the header file for the exploration stop rule.
+*
+* Exploring keeps two views of the maze: the optimistic flood, where walls
+* not known yet are open, guessed ones too, and the pessimistic one, where
+* they are closed. The optimistic start cost is the shortest the route
+* could still be, the pessimistic one the shortest route already proven.
+* Once they match the shortest route is known and exploring can stop; until
+* then only cells that lie on an optimistic route shorter than the proven
+* one are worth visiting.
+*
+* The algo layer defines all mouse maze solving algorithms as the second most
+* highest layer to be called directly in main.
+*-----------------------------------------------------------------------------*/
+
+#ifndef EXPLORE_ALGO_H_
+#define EXPLORE_ALGO_H_
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdint.h>
+#include "algo/algo.h"
+#include "algo/mazemap_algo.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+void algo_ExploreUpdate(const algo_maze_map_t* p_map,
+    const uint16_t* p_goalFlood);
+bool algo_ExploreIsRouteProven(void);
+bool algo_ExploreIsWorthVisiting(unsigned int x, unsigned int y);
+const algo_maze_row_t* algo_ExploreGetWorthCells(void);
+unsigned int algo_ExploreGetWorthCount(void);
+
+#endif /* EXPLORE_ALGO_H_ */
@@ -0,0 +1,651 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : floodfill_algo.c
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : algo layer
+*
+* This is the source file for the maze flood fill.
+*
+* The flood is a breadth first search seeded from the goal cells. It runs out
+* of a fixed size circular queue instead of recursing, so its stack use does
+* not grow with the maze and each cell is visited once per fill.
+*
+* Once the maze has been flooded, newly found walls can be applied w/
+* algo_FloodUpdate() instead. Walls only ever make routes longer, so the
+* update finds the cells that lost their only route through the new walls,
+* clears them, and floods back into just those cells.
+*
+* algo_FloodFillKnown() floods through known open walls only, the opposite
+* guess to algo_FloodFill(), and algo_FloodFillFrom() and
+* algo_FloodFillSeeds() flood out from one cell or a set of cells instead of
+* the goal.
+*
+* algo_FloodFillWithin() and algo_FloodUpdateWithin() keep the flood to a set
+* of cells, the rest are left unreachable, e.g. to leave out the dead ends of
+* algo/prune_algo.h. An update w/in a set stays exact as long as the set is
+* the one the map was flooded w/in.
+*
+* The algo layer defines all mouse maze solving algorithms as the second most
+* highest layer to be called directly in main.
+*-----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdint.h>
+#include "algo/algo.h"
+#include "algo/mazemap_algo.h"
+#include "algo/floodfill_algo.h"
+#include "algo/arena_algo.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+/* flood mark bits used while updating */
+#define ALGO_FLOOD_MARK_QUEUED      (0x01u)
+#define ALGO_FLOOD_MARK_AFFECTED    (0x02u)
+
+/*----------------------------------------------------------------------------*/
+/*                               Debug Switches                               */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+/* cells waiting to spread their cost to their neighbors */
+static uint16_t* const floodQueue = algoArena.floodQueue;
+static uint16_t floodQueueHead = 0u;
+static uint16_t floodQueueTail = 0u;
+static uint16_t floodQueueCount = 0u;
+
+/* update bookkeeping- marks are cleared again before an update returns */
+static uint8_t* const floodMark = algoArena.floodMark;
+static uint16_t* const floodAffected = algoArena.floodAffected;
+static uint16_t floodAffectedCount = 0u;
+
+/* cells taken off the queue by the last fill or update */
+static unsigned int floodCellsTouched = 0u;
+
+/* cells the running fill or update may enter, NULL for all of them */
+static const algo_maze_row_t* floodWithin = NULL;
+
+/*----------------------------------------------------------------------------*/
+/*                    Private (Static) Function Prototype                     */
+/*----------------------------------------------------------------------------*/
+static void algo_FloodFillRect(const algo_maze_map_t* p_map,
+    uint16_t* p_destFlood, unsigned int xMin, unsigned int yMin,
+    unsigned int xMax, unsigned int yMax, bool knownOnly);
+static void algo_FloodStart(uint16_t* p_destFlood);
+static void algo_FloodSpread(const algo_maze_map_t* p_map,
+    uint16_t* p_destFlood, bool knownOnly);
+static inline bool algo_FloodCanPass(const algo_maze_map_t* p_map,
+    unsigned int x, unsigned int y, unsigned int dir, bool knownOnly);
+static void algo_FloodPush(unsigned int x, unsigned int y, unsigned int cost,
+    uint16_t* p_destFlood);
+static uint16_t algo_FloodPop(void);
+static unsigned int algo_FloodIdx(unsigned int x, unsigned int y);
+static void algo_FloodQueueCell(unsigned int idx);
+static bool algo_FloodNeighbor(unsigned int idx, unsigned int dir,
+    unsigned int* p_neighborIdx);
+static bool algo_FloodIsOpen(const algo_maze_map_t* p_map, unsigned int idx,
+    unsigned int dir);
+static bool algo_FloodHasSupport(const algo_maze_map_t* p_map,
+    const uint16_t* p_destFlood, unsigned int idx);
+static inline bool algo_FloodIsWithin(unsigned int x, unsigned int y);
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+/**
+* Fill the flood map with the number of cells from every cell to the goal
+*
+* Walls not discovered yet are taken as open, guessed walls too.
+*
+* \param[in]  p_map          Walls discovered so far
+* \param[out] p_destFlood    Cells to the goal, UINT_MAX if unreachable
+* \retval None
+*/
+void algo_FloodFill(const algo_maze_map_t* p_map, uint16_t* p_destFlood)
+{
+    floodWithin = NULL;
+    algo_FloodFillRect(p_map, p_destFlood, ALGO_MAZE_GOAL_X_MIN,
+        ALGO_MAZE_GOAL_Y_MIN, ALGO_MAZE_GOAL_X_MAX, ALGO_MAZE_GOAL_Y_MAX, FALSE);
+}
+
+/**
+* Fill the flood map with the number of cells from every cell to the goal
+* over walls known to be open
+*
+* Walls not discovered yet are taken as closed, so every cost is the length
+* of a route the mouse has already proven.
+*
+* \param[in]  p_map          Walls discovered so far
+* \param[out] p_destFlood    Cells to the goal, UINT_MAX if unreachable
+* \retval None
+*/
+void algo_FloodFillKnown(const algo_maze_map_t* p_map, uint16_t* p_destFlood)
+{
+    floodWithin = NULL;
+    algo_FloodFillRect(p_map, p_destFlood, ALGO_MAZE_GOAL_X_MIN,
+        ALGO_MAZE_GOAL_Y_MIN, ALGO_MAZE_GOAL_X_MAX, ALGO_MAZE_GOAL_Y_MAX, TRUE);
+}
+
+/**
+* Fill the flood map with the number of cells from one cell to every cell
+*
+* Walls not discovered yet are taken as open.
+*
+* \param[in]  p_map          Walls discovered so far
+* \param[out] p_destFlood    Cells from the cell, UINT_MAX if unreachable
+* \param[in]  x              Column of the cell to flood from
+* \param[in]  y              Row of the cell to flood from
+* \retval None
+*/
+void algo_FloodFillFrom(const algo_maze_map_t* p_map, uint16_t* p_destFlood,
+    unsigned int x, unsigned int y)
+{
+    floodWithin = NULL;
+    algo_FloodFillRect(p_map, p_destFlood, x, y, x, y, FALSE);
+}
+
+/**
+* Fill the flood map with the number of cells from every cell of a set to
+* the goal, w/o leaving the set
+*
+* Walls not discovered yet are taken as open.
+*
+* \param[in]  p_map          Walls discovered so far
+* \param[out] p_destFlood    Cells to the goal, UINT_MAX if unreachable or
+*                            outside the set
+* \param[in]  p_within       Cells to flood, a row of cells per word
+* \retval None
+*/
+void algo_FloodFillWithin(const algo_maze_map_t* p_map, uint16_t* p_destFlood,
+    const algo_maze_row_t* p_within)
+{
+    floodWithin = p_within;
+    algo_FloodFillRect(p_map, p_destFlood, ALGO_MAZE_GOAL_X_MIN,
+        ALGO_MAZE_GOAL_Y_MIN, ALGO_MAZE_GOAL_X_MAX, ALGO_MAZE_GOAL_Y_MAX, FALSE);
+    floodWithin = NULL;
+}
+
+/**
+* Fill the flood map with the number of cells from every cell to the
+* nearest of a set of cells
+*
+* \param[in]  p_map          Walls discovered so far
+* \param[out] p_destFlood    Cells to the nearest seed, UINT_MAX if unreachable
+* \param[in]  p_seeds        Cells to flood from, a row of cells per word
+* \param[in]  knownOnly      TRUE to take walls not discovered yet as closed
+* \retval None
+*/
+void algo_FloodFillSeeds(const algo_maze_map_t* p_map, uint16_t* p_destFlood,
+    const algo_maze_row_t* p_seeds, bool knownOnly)
+{
+    unsigned int x = 0u;
+    unsigned int y = 0u;
+
+    floodWithin = NULL;
+    algo_FloodStart(p_destFlood);
+
+    for (y = 0u; y < ALGO_MAZE_HEIGHT; y++)
+        if (p_seeds[y] != 0u)
+            for (x = 0u; x < ALGO_MAZE_WIDTH; x++)
+                if (p_seeds[y] & ALGO_MAZE_ROW_BIT(x))
+                    algo_FloodPush(x, y, 0u, p_destFlood);
+
+    algo_FloodSpread(p_map, p_destFlood, knownOnly);
+}
+
+/**
+* Update a flooded maze after walls were added to one cell
+*
+* Only walls being added are handled- anything that opens a wall needs a
+* full algo_FloodFill().
+*
+* \param[in]     p_map          Walls discovered so far, new walls included
+* \param[in,out] p_destFlood    Flood map from before the new walls
+* \param[in]     x              Column of the cell that got new walls
+* \param[in]     y              Row of the cell that got new walls
+* \retval Number of cells the update had to look at
+*/
+unsigned int algo_FloodUpdate(const algo_maze_map_t* p_map,
+    uint16_t* p_destFlood, unsigned int x, unsigned int y)
+{
+    return algo_FloodUpdateWithin(p_map, p_destFlood, x, y, NULL);
+}
+
+/**
+* Update a map flooded w/ algo_FloodFillWithin() after walls were added to
+* one cell
+*
+* \param[in]     p_map          Walls discovered so far, new walls included
+* \param[in,out] p_destFlood    Flood map from before the new walls
+* \param[in]     x              Column of the cell that got new walls
+* \param[in]     y              Row of the cell that got new walls
+* \param[in]     p_within       Cells the map was flooded w/in, NULL for all
+* \retval Number of cells the update had to look at
+*/
+unsigned int algo_FloodUpdateWithin(const algo_maze_map_t* p_map,
+    uint16_t* p_destFlood, unsigned int x, unsigned int y,
+    const algo_maze_row_t* p_within)
+{
+    unsigned int idx = algo_FloodIdx(x, y);
+    unsigned int neighborIdx = 0u;
+    unsigned int best = 0u;
+    unsigned int dir = 0u;
+    unsigned int i = 0u;
+
+    floodQueueHead = 0u;
+    floodQueueTail = 0u;
+    floodQueueCount = 0u;
+    floodAffectedCount = 0u;
+    floodCellsTouched = 0u;
+    floodWithin = p_within;
+
+    /* the new walls can only have cut routes running through this cell */
+    algo_FloodQueueCell(idx);
+    for (dir = NORTH; dir <= WEST; dir++)
+        if (algo_FloodNeighbor(idx, dir, &neighborIdx))
+            algo_FloodQueueCell(neighborIdx);
+
+    /* find every cell left w/o a neighbor one step closer to the goal */
+    while (floodQueueCount > 0u)
+    {
+        idx = algo_FloodPop();
+        floodMark[idx] &= (uint8_t)~ALGO_FLOOD_MARK_QUEUED;
+        floodCellsTouched++;
+
+        if ((floodMark[idx] & ALGO_FLOOD_MARK_AFFECTED)
+            || (p_destFlood[idx] == 0u) || (p_destFlood[idx] == UINT_MAX)
+            || algo_FloodHasSupport(p_map, p_destFlood, idx))
+            continue;
+
+        floodMark[idx] |= ALGO_FLOOD_MARK_AFFECTED;
+        floodAffected[floodAffectedCount++] = (uint16_t)idx;
+
+        /* cells that were relying on this one need checking as well */
+        for (dir = NORTH; dir <= WEST; dir++)
+            if (algo_FloodIsOpen(p_map, idx, dir)
+                && algo_FloodNeighbor(idx, dir, &neighborIdx)
+                && (p_destFlood[neighborIdx] == p_destFlood[idx] + 1u)
+                && !(floodMark[neighborIdx] & ALGO_FLOOD_MARK_AFFECTED))
+                algo_FloodQueueCell(neighborIdx);
+    }
+
+    /* forget the old costs of every cell that lost its route */
+    for (i = 0u; i < floodAffectedCount; i++)
+        p_destFlood[floodAffected[i]] = UINT_MAX;
+
+    /* give them the best cost their unaffected neighbors can offer */
+    for (i = 0u; i < floodAffectedCount; i++)
+    {
+        idx = floodAffected[i];
+        best = UINT_MAX;
+        for (dir = NORTH; dir <= WEST; dir++)
+            if (algo_FloodIsOpen(p_map, idx, dir)
+                && algo_FloodNeighbor(idx, dir, &neighborIdx)
+                && (p_destFlood[neighborIdx] != UINT_MAX)
+                && (p_destFlood[neighborIdx] + 1u < best))
+                best = p_destFlood[neighborIdx] + 1u;
+
+        if (best != UINT_MAX)
+        {
+            p_destFlood[idx] = (uint16_t)best;
+            algo_FloodQueueCell(idx);
+        }
+    }
+
+    /* and flood on from there until nothing gets cheaper */
+    while (floodQueueCount > 0u)
+    {
+        idx = algo_FloodPop();
+        floodMark[idx] &= (uint8_t)~ALGO_FLOOD_MARK_QUEUED;
+        floodCellsTouched++;
+
+        for (dir = NORTH; dir <= WEST; dir++)
+            if (algo_FloodIsOpen(p_map, idx, dir)
+                && algo_FloodNeighbor(idx, dir, &neighborIdx)
+                && (p_destFlood[idx] + 1u < p_destFlood[neighborIdx]))
+            {
+                p_destFlood[neighborIdx] = (uint16_t)(p_destFlood[idx] + 1u);
+                algo_FloodQueueCell(neighborIdx);
+            }
+    }
+
+    for (i = 0u; i < floodAffectedCount; i++)
+        floodMark[floodAffected[i]] = 0u;
+    floodWithin = NULL;
+
+    return floodCellsTouched;
+}
+
+/**
+* Take cells out of a flood map, leaving them unreachable
+*
+* Only for cells no route of the other cells runs through, such as newly
+* pruned dead ends, the other costs are left as they are.
+*
+* \param[in,out] p_destFlood    Flood map
+* \param[in]     p_cells        Cells to take out, a row of cells per word
+* \retval None
+*/
+void algo_FloodClearCells(uint16_t* p_destFlood,
+    const algo_maze_row_t* p_cells)
+{
+    unsigned int x = 0u;
+    unsigned int y = 0u;
+
+    for (y = 0u; y < ALGO_MAZE_HEIGHT; y++)
+        if (p_cells[y] != 0u)
+            for (x = 0u; x < ALGO_MAZE_WIDTH; x++)
+                if (p_cells[y] & ALGO_MAZE_ROW_BIT(x))
+                    p_destFlood[algo_FloodIdx(x, y)] = UINT_MAX;
+}
+
+/**
+* Number of cells the last fill or update had to look at
+*
+* \param None
+* \retval Cells touched
+*/
+unsigned int algo_FloodGetCellsTouched(void)
+{
+    return floodCellsTouched;
+}
+
+/*----------------------------------------------------------------------------*/
+/*                           Local Shared Functions                           */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                         Private (Static) Functions                         */
+/*----------------------------------------------------------------------------*/
+/**
+* Flood out from every cell of a rectangle
+*
+* \param[in]  p_map          Walls discovered so far
+* \param[out] p_destFlood    Cells to the rectangle, UINT_MAX if unreachable
+* \param[in]  xMin           First column of the rectangle
+* \param[in]  yMin           First row of the rectangle
+* \param[in]  xMax           Last column of the rectangle
+* \param[in]  yMax           Last row of the rectangle
+* \param[in]  knownOnly      TRUE to take walls not discovered yet as closed
+* \retval None
+*/
+static void algo_FloodFillRect(const algo_maze_map_t* p_map,
+    uint16_t* p_destFlood, unsigned int xMin, unsigned int yMin,
+    unsigned int xMax, unsigned int yMax, bool knownOnly)
+{
+    unsigned int x = 0u;
+    unsigned int y = 0u;
+
+    algo_FloodStart(p_destFlood);
+
+    for (y = yMin; y <= yMax; y++)
+        for (x = xMin; x <= xMax; x++)
+            algo_FloodPush(x, y, 0u, p_destFlood);
+
+    algo_FloodSpread(p_map, p_destFlood, knownOnly);
+}
+
+/**
+* Clear the flood map and the queue before seeding a fill
+*
+* \param[out] p_destFlood    Flood map to fill
+* \retval None
+*/
+static void algo_FloodStart(uint16_t* p_destFlood)
+{
+    unsigned int idx = 0u;
+
+    for (idx = 0u; idx < ALGO_MAZE_CELL_COUNT; idx++)
+        p_destFlood[idx] = UINT_MAX;
+
+    floodQueueHead = 0u;
+    floodQueueTail = 0u;
+    floodQueueCount = 0u;
+    floodCellsTouched = 0u;
+}
+
+/**
+* Spread the seeded cells' costs over the maze until the queue runs dry
+*
+* \param[in]     p_map          Walls discovered so far
+* \param[in,out] p_destFlood    Flood map w/ the seeds queued at cost 0
+* \param[in]     knownOnly      TRUE to take walls not discovered yet as closed
+* \retval None
+*/
+static void algo_FloodSpread(const algo_maze_map_t* p_map,
+    uint16_t* p_destFlood, bool knownOnly)
+{
+    unsigned int idx = 0u;
+    unsigned int x = 0u;
+    unsigned int y = 0u;
+    unsigned int cost = 0u;
+
+    /* cells leave the queue in cost order, so the first cost a cell gets */
+    /* is already its lowest one */
+    while (floodQueueCount > 0u)
+    {
+        idx = algo_FloodPop();
+        floodCellsTouched++;
+        x = ALGO_MAZE_IDX_X(idx);
+        y = ALGO_MAZE_IDX_Y(idx);
+        cost = p_destFlood[idx] + 1u;
+
+        /* outer walls always read as walls, so no range checks needed */
+        if (algo_FloodCanPass(p_map, x, y, NORTH, knownOnly))
+            algo_FloodPush(x, y + 1, cost, p_destFlood);
+        if (algo_FloodCanPass(p_map, x, y, SOUTH, knownOnly))
+            algo_FloodPush(x, y - 1, cost, p_destFlood);
+        if (algo_FloodCanPass(p_map, x, y, EAST, knownOnly))
+            algo_FloodPush(x + 1, y, cost, p_destFlood);
+        if (algo_FloodCanPass(p_map, x, y, WEST, knownOnly))
+            algo_FloodPush(x - 1, y, cost, p_destFlood);
+    }
+}
+
+/**
+* Whether a fill spreads through one side of a cell
+*
+* \param[in] p_map     Walls discovered so far
+* \param[in] x         Cell column
+* \param[in] y         Cell row
+* \param[in] dir       Side of the cell (NORTH, SOUTH, EAST, WEST)
+* \param[in] knownOnly TRUE to take walls not discovered yet as closed,
+*                      FALSE to take them as open, guessed walls too
+* \retval TRUE if the fill spreads to the neighbor
+*/
+static inline bool algo_FloodCanPass(const algo_maze_map_t* p_map,
+    unsigned int x, unsigned int y, unsigned int dir, bool knownOnly)
+{
+    if (knownOnly)
+        return !algo_MazeMapHasWall(p_map, x, y, dir)
+            && algo_MazeMapIsWallKnown(p_map, x, y, dir);
+
+    return !algo_MazeMapHasKnownWall(p_map, x, y, dir);
+}
+
+/**
+* Give a cell its cost and queue it if it has not been reached yet
+*
+* \param[in]  x           Cell column
+* \param[in]  y           Cell row, 0 at the start row
+* \param[in]  cost        Cells from this cell to the goal
+* \param[out] p_destFlood Flood map being filled
+* \retval None
+*/
+static void algo_FloodPush(unsigned int x, unsigned int y, unsigned int cost,
+    uint16_t* p_destFlood)
+{
+    unsigned int idx = algo_FloodIdx(x, y);
+
+    if ((p_destFlood[idx] != UINT_MAX) || !algo_FloodIsWithin(x, y))
+        return;
+
+    p_destFlood[idx] = (uint16_t)cost;
+    floodQueue[floodQueueTail] = (uint16_t)idx;
+    floodQueueTail = (floodQueueTail + 1u) % ALGO_FLOOD_QUEUE_SIZE;
+    floodQueueCount++;
+}
+
+/**
+* Take the oldest cell off the flood queue
+*
+* \param None
+* \retval Maze index of the cell
+*/
+static uint16_t algo_FloodPop(void)
+{
+    uint16_t idx = floodQueue[floodQueueHead];
+
+    floodQueueHead = (floodQueueHead + 1u) % ALGO_FLOOD_QUEUE_SIZE;
+    floodQueueCount--;
+
+    return idx;
+}
+
+/**
+* Maze array index of a cell, rows stored from the far wall down
+*
+* \param[in] x Cell column
+* \param[in] y Cell row, 0 at the start row
+* \retval Maze array index
+*/
+static unsigned int algo_FloodIdx(unsigned int x, unsigned int y)
+{
+    return ALGO_MAZE_IDX(x, y);
+}
+
+/**
+* Queue a cell for the update unless it is already waiting
+*
+* \param[in] idx Maze index of the cell
+* \retval None
+*/
+static void algo_FloodQueueCell(unsigned int idx)
+{
+    if (floodMark[idx] & ALGO_FLOOD_MARK_QUEUED)
+        return;
+
+    floodMark[idx] |= ALGO_FLOOD_MARK_QUEUED;
+    floodQueue[floodQueueTail] = (uint16_t)idx;
+    floodQueueTail = (floodQueueTail + 1u) % ALGO_FLOOD_QUEUE_SIZE;
+    floodQueueCount++;
+}
+
+/**
+* Maze index of the neighbor on one side of a cell
+*
+* \param[in]  idx           Maze index of the cell
+* \param[in]  dir           Side to look at (NORTH, SOUTH, EAST, WEST)
+* \param[out] p_neighborIdx Maze index of the neighbor
+* \retval TRUE if the neighbor is inside the maze
+*/
+static bool algo_FloodNeighbor(unsigned int idx, unsigned int dir,
+    unsigned int* p_neighborIdx)
+{
+    unsigned int x = ALGO_MAZE_IDX_X(idx);
+    unsigned int y = ALGO_MAZE_IDX_Y(idx);
+
+    switch (dir)
+    {
+        case NORTH:
+            if (y + 1 >= ALGO_MAZE_HEIGHT)
+                return FALSE;
+            *p_neighborIdx = idx - ALGO_MAZE_WIDTH;
+            return TRUE;
+        case SOUTH:
+            if (y == 0u)
+                return FALSE;
+            *p_neighborIdx = idx + ALGO_MAZE_WIDTH;
+            return TRUE;
+        case EAST:
+            if (x + 1 >= ALGO_MAZE_WIDTH)
+                return FALSE;
+            *p_neighborIdx = idx + 1u;
+            return TRUE;
+        case WEST:
+            if (x == 0u)
+                return FALSE;
+            *p_neighborIdx = idx - 1u;
+            return TRUE;
+    }
+
+    return FALSE;
+}
+
+/**
+* Whether a cell is open to its neighbor on one side
+*
+* The neighbor has to be one the update may enter as well.
+*
+* \param[in] p_map          Walls discovered so far
+* \param[in] idx            Maze index of the cell
+* \param[in] dir            Side to check (NORTH, SOUTH, EAST, WEST)
+* \retval TRUE if no wall has been found on that side, a guessed one does
+*         not count
+*/
+static bool algo_FloodIsOpen(const algo_maze_map_t* p_map, unsigned int idx,
+    unsigned int dir)
+{
+    unsigned int x = ALGO_MAZE_IDX_X(idx);
+    unsigned int y = ALGO_MAZE_IDX_Y(idx);
+
+    if (algo_MazeMapHasKnownWall(p_map, x, y, dir))
+        return FALSE;
+
+    switch (dir)
+    {
+        case NORTH:
+            return algo_FloodIsWithin(x, y + 1u);
+        case SOUTH:
+            return algo_FloodIsWithin(x, y - 1u);
+        case EAST:
+            return algo_FloodIsWithin(x + 1u, y);
+        case WEST:
+            return algo_FloodIsWithin(x - 1u, y);
+    }
+
+    return FALSE;
+}
+
+/**
+* Whether a cell still has an unaffected neighbor one step closer to the goal
+*
+* \param[in] p_map          Walls discovered so far
+* \param[in] p_destFlood    Flood map being updated
+* \param[in] idx            Maze index of the cell
+* \retval TRUE if the cell keeps its cost
+*/
+static bool algo_FloodHasSupport(const algo_maze_map_t* p_map,
+    const uint16_t* p_destFlood, unsigned int idx)
+{
+    unsigned int neighborIdx = 0u;
+    unsigned int dir = 0u;
+
+    for (dir = NORTH; dir <= WEST; dir++)
+        if (algo_FloodIsOpen(p_map, idx, dir)
+            && algo_FloodNeighbor(idx, dir, &neighborIdx)
+            && !(floodMark[neighborIdx] & ALGO_FLOOD_MARK_AFFECTED)
+            && (p_destFlood[neighborIdx] + 1u == p_destFlood[idx]))
+            return TRUE;
+
+    return FALSE;
+}
+
+/**
+* Whether the running fill or update may enter a cell
+*
+* \param[in] x Cell column
+* \param[in] y Cell row
+* \retval TRUE if it is in the set flooded w/in, or there is no set
+*/
+static inline bool algo_FloodIsWithin(unsigned int x, unsigned int y)
+{
+    return (floodWithin == NULL) || (floodWithin[y] & ALGO_MAZE_ROW_BIT(x));
+}
@@ -0,0 +1,54 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : floodfill_algo.h
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : algo layer
+*
+* This is the header file for the maze flood fill.
+*
+* The algo layer defines all mouse maze solving algorithms as the second most
+* highest layer to be called directly in main.
+*-----------------------------------------------------------------------------*/
+
+#ifndef FLOODFILL_ALGO_H_
+#define FLOODFILL_ALGO_H_
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdint.h>
+#include "algo/mazemap_algo.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+/* every cell is queued at most once, so the queue never needs more slots */
+#define ALGO_FLOOD_QUEUE_SIZE    (ALGO_MAZE_CELL_COUNT)
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+void algo_FloodFill(const algo_maze_map_t* p_map, uint16_t* p_destFlood);
+void algo_FloodFillKnown(const algo_maze_map_t* p_map, uint16_t* p_destFlood);
+void algo_FloodFillFrom(const algo_maze_map_t* p_map, uint16_t* p_destFlood,
+    unsigned int x, unsigned int y);
+void algo_FloodFillWithin(const algo_maze_map_t* p_map, uint16_t* p_destFlood,
+    const algo_maze_row_t* p_within);
+void algo_FloodFillSeeds(const algo_maze_map_t* p_map, uint16_t* p_destFlood,
+    const algo_maze_row_t* p_seeds, bool knownOnly);
+unsigned int algo_FloodUpdate(const algo_maze_map_t* p_map,
+    uint16_t* p_destFlood, unsigned int x, unsigned int y);
+unsigned int algo_FloodUpdateWithin(const algo_maze_map_t* p_map,
+    uint16_t* p_destFlood, unsigned int x, unsigned int y,
+    const algo_maze_row_t* p_within);
+void algo_FloodClearCells(uint16_t* p_destFlood,
+    const algo_maze_row_t* p_cells);
+unsigned int algo_FloodGetCellsTouched(void);
+
+#endif /* FLOODFILL_ALGO_H_ */
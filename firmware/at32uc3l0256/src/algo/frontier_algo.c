@@ -0,0 +1,308 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : frontier_algo.c
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : algo layer
+*
+* This is the source file for frontier backtracking.
+*
+* The frontier is found a row at a time w/ the bit operations the maze map
+* is laid out for, then flooded through known open walls. Following the
+* flood downhill from the mouse gives the shortest known route to the
+* nearest frontier cell; where two moves are as short, the one that keeps
+* the heading wins, so the route merges into longer straights.
+*
+* The algo layer defines all mouse maze solving algorithms as the second most
+* highest layer to be called directly in main.
+*-----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include "algo/algo.h"
+#include "algo/mazemap_algo.h"
+#include "algo/floodfill_algo.h"
+#include "algo/frontier_algo.h"
+#include "algo/arena_algo.h"
+#include "algo/strategy_algo.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                               Debug Switches                               */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+/* cells to the nearest frontier cell */
+static uint16_t* const frontierFlood = algoArena.frontierFlood;
+static algo_maze_row_t* const frontierCells = algoArena.frontierCells;
+
+/*----------------------------------------------------------------------------*/
+/*                    Private (Static) Function Prototype                     */
+/*----------------------------------------------------------------------------*/
+static bool algo_FrontierStep(const algo_maze_map_t* p_map, unsigned int x,
+    unsigned int y, unsigned int dir, unsigned int* p_idx);
+static void algo_FrontierStrategyInit(const algo_maze_map_t* p_map);
+static void algo_FrontierStrategyWallUpdate(const algo_maze_map_t* p_map,
+    unsigned int x, unsigned int y, bool inferred);
+static bool algo_FrontierStrategyChooseMoves(const algo_maze_map_t* p_map,
+    unsigned int x, unsigned int y, unsigned int heading,
+    uint8_t* p_moves, unsigned int* p_moveCount);
+static bool algo_FrontierStrategyIsDone(const algo_maze_map_t* p_map,
+    unsigned int x, unsigned int y, unsigned int heading);
+
+/* exploration strategy handler, here after the prototypes it points to */
+static const algo_strategy_t frontierStrategy =
+{
+    .p_name = "frontier",
+    .algo_StrategyInit = algo_FrontierStrategyInit,
+    .algo_StrategyWallUpdate = algo_FrontierStrategyWallUpdate,
+    .algo_StrategyChooseMoves = algo_FrontierStrategyChooseMoves,
+    .algo_StrategyIsDone = algo_FrontierStrategyIsDone,
+};
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+/**
+* Find the unvisited cells known to be open to a visited neighbor
+*
+* \param[in]  p_map      Walls discovered so far
+* \param[in]  p_allowed  Cells that may be part of the frontier, a row of
+*                        cells per word, NULL for every cell
+* \param[out] p_frontier Frontier cells, a row of cells per word
+* \retval None
+*/
+void algo_FrontierFind(const algo_maze_map_t* p_map,
+    const algo_maze_row_t* p_allowed, algo_maze_row_t* p_frontier)
+{
+    algo_maze_row_t open = 0u;
+    algo_maze_row_t reached = 0u;
+    unsigned int y = 0u;
+
+    for (y = 0u; y < ALGO_MAZE_HEIGHT; y++)
+    {
+        /* open to the west or east neighbor in the same row */
+        open = p_map->vKnown[y] & (algo_maze_row_t)~p_map->vWalls[y];
+        reached = (algo_maze_row_t)((open & p_map->visited[y]) << 1)
+            | (open & (algo_maze_row_t)(p_map->visited[y] >> 1));
+
+        /* open to the south neighbor */
+        if (y > 0u)
+            reached |= p_map->hKnown[y - 1] & (algo_maze_row_t)~p_map->hWalls[y - 1]
+                & p_map->visited[y - 1];
+
+        /* open to the north neighbor */
+        if (y + 1 < ALGO_MAZE_HEIGHT)
+            reached |= p_map->hKnown[y] & (algo_maze_row_t)~p_map->hWalls[y]
+                & p_map->visited[y + 1];
+
+        p_frontier[y] = reached & (algo_maze_row_t)~p_map->visited[y]
+            & ALGO_MAZE_ROW_MASK;
+        if (p_allowed != NULL)
+            p_frontier[y] &= p_allowed[y];
+    }
+}
+
+/**
+* Plan the shortest known route to the nearest frontier cell
+*
+* \param[in]  p_map       Walls discovered so far
+* \param[in]  p_allowed   Cells that may be part of the frontier, a row of
+*                         cells per word, NULL for every cell
+* \param[in]  x           Column of the mouse
+* \param[in]  y           Row of the mouse
+* \param[in]  heading     Heading of the mouse
+* \param[out] p_moves     Heading of every cell move, at least
+*                         ALGO_FRONTIER_MAX_MOVES long
+* \param[out] p_moveCount Number of moves
+* \retval FALSE if no frontier cell can be reached, exploring is done
+*/
+bool algo_FrontierPlan(const algo_maze_map_t* p_map,
+    const algo_maze_row_t* p_allowed, unsigned int x, unsigned int y,
+    unsigned int heading, uint8_t* p_moves, unsigned int* p_moveCount)
+{
+    algo_FrontierFind(p_map, p_allowed, frontierCells);
+
+    return algo_FrontierPlanTo(p_map, frontierCells, x, y, heading, p_moves,
+        p_moveCount);
+}
+
+/**
+* Plan the shortest known route to the nearest of a set of cells
+*
+* \param[in]  p_map       Walls discovered so far
+* \param[in]  p_targets   Cells to head for, a row of cells per word
+* \param[in]  x           Column of the mouse
+* \param[in]  y           Row of the mouse
+* \param[in]  heading     Heading of the mouse
+* \param[out] p_moves     Heading of every cell move, at least
+*                         ALGO_FRONTIER_MAX_MOVES long
+* \param[out] p_moveCount Number of moves, 0 if the mouse is in one already
+* \retval FALSE if none of the cells can be reached
+*/
+bool algo_FrontierPlanTo(const algo_maze_map_t* p_map,
+    const algo_maze_row_t* p_targets, unsigned int x, unsigned int y,
+    unsigned int heading, uint8_t* p_moves, unsigned int* p_moveCount)
+{
+    unsigned int idx = ALGO_MAZE_IDX(x, y);
+    unsigned int nextIdx = 0u;
+    unsigned int dir = 0u;
+    unsigned int i = 0u;
+
+    *p_moveCount = 0u;
+
+    algo_FloodFillSeeds(p_map, frontierFlood, p_targets, TRUE);
+    if (frontierFlood[idx] == UINT_MAX)
+        return FALSE;
+
+    /* downhill, trying the current heading first */
+    while (frontierFlood[idx] != 0u)
+    {
+        for (i = 0u; i < 4u; i++)
+        {
+            dir = (i == 0u) ? heading : (i - 1u);
+            if ((i > 0u) && (dir == heading))
+                dir = 3u;
+            if (algo_FrontierStep(p_map, x, y, dir, &nextIdx)
+                && (frontierFlood[nextIdx] + 1u == frontierFlood[idx]))
+                break;
+        }
+
+        p_moves[(*p_moveCount)++] = (uint8_t)dir;
+        heading = dir;
+        idx = nextIdx;
+        x = ALGO_MAZE_IDX_X(idx);
+        y = ALGO_MAZE_IDX_Y(idx);
+    }
+
+    return TRUE;
+}
+
+/**
+* Exploration strategy that drives to the nearest unvisited cell until every
+* cell it can reach is visited. It maps the whole maze, where the flood fill
+* strategy stops once the shortest route is known, so it is the baseline the
+* others are measured against.
+*
+* \param None
+* \retval Strategy handler
+*/
+const algo_strategy_t* algo_FrontierGetStrategy(void)
+{
+    return &frontierStrategy;
+}
+
+/*----------------------------------------------------------------------------*/
+/*                         Private (Static) Functions                         */
+/*----------------------------------------------------------------------------*/
+/**
+* Maze index of the neighbor behind a known open wall
+*
+* \param[in]  p_map Walls discovered so far
+* \param[in]  x     Cell column
+* \param[in]  y     Cell row
+* \param[in]  dir   Side of the cell (NORTH, SOUTH, EAST, WEST)
+* \param[out] p_idx Maze index of the neighbor
+* \retval TRUE if the wall is known to be open
+*/
+static bool algo_FrontierStep(const algo_maze_map_t* p_map, unsigned int x,
+    unsigned int y, unsigned int dir, unsigned int* p_idx)
+{
+    if (algo_MazeMapHasWall(p_map, x, y, dir)
+        || !algo_MazeMapIsWallKnown(p_map, x, y, dir))
+        return FALSE;
+
+    switch (dir)
+    {
+        case NORTH:
+            *p_idx = ALGO_MAZE_IDX(x, y + 1);
+            break;
+        case SOUTH:
+            *p_idx = ALGO_MAZE_IDX(x, y - 1);
+            break;
+        case EAST:
+            *p_idx = ALGO_MAZE_IDX(x + 1, y);
+            break;
+        default:
+            *p_idx = ALGO_MAZE_IDX(x - 1, y);
+            break;
+    }
+
+    return TRUE;
+}
+
+/**
+* Frontier strategy: nothing to set up, it plans from the map each step
+*
+* \param[in]  p_map Walls discovered so far, unused
+* \retval None
+*/
+static void algo_FrontierStrategyInit(const algo_maze_map_t* p_map)
+{
+    (void)p_map;
+}
+
+/**
+* Frontier strategy: nothing to update, it plans from the map each step
+*
+* \param[in]  p_map    Walls discovered so far, unused
+* \param[in]  x        Column of the cell the walls were read in, unused
+* \param[in]  y        Row of the cell the walls were read in, unused
+* \param[in]  inferred TRUE if walls elsewhere changed as well, unused
+* \retval None
+*/
+static void algo_FrontierStrategyWallUpdate(const algo_maze_map_t* p_map,
+    unsigned int x, unsigned int y, bool inferred)
+{
+    (void)p_map;
+    (void)x;
+    (void)y;
+    (void)inferred;
+}
+
+/**
+* Frontier strategy: route to the nearest unvisited cell
+*
+* \param[in]  p_map       Walls discovered so far
+* \param[in]  x           Column of the mouse
+* \param[in]  y           Row of the mouse
+* \param[in]  heading     Heading of the mouse
+* \param[out] p_moves     Heading of every cell move
+* \param[out] p_moveCount Number of moves
+* \retval FALSE once every reachable cell is visited
+*/
+static bool algo_FrontierStrategyChooseMoves(const algo_maze_map_t* p_map,
+    unsigned int x, unsigned int y, unsigned int heading,
+    uint8_t* p_moves, unsigned int* p_moveCount)
+{
+    return algo_FrontierPlan(p_map, NULL, x, y, heading, p_moves, p_moveCount);
+}
+
+/**
+* Frontier strategy: done only when there is no cell left to visit
+*
+* \param[in]  p_map   Walls discovered so far, unused
+* \param[in]  x       Column of the mouse, unused
+* \param[in]  y       Row of the mouse, unused
+* \param[in]  heading Heading of the mouse, unused
+* \retval FALSE always, algo_FrontierStrategyChooseMoves() finds the end
+*/
+static bool algo_FrontierStrategyIsDone(const algo_maze_map_t* p_map,
+    unsigned int x, unsigned int y, unsigned int heading)
+{
+    (void)p_map;
+    (void)x;
+    (void)y;
+    (void)heading;
+    return FALSE;
+}
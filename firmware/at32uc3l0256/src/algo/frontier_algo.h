@@ -0,0 +1,58 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : frontier_algo.h
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : algo layer
+*
+* This is the header file for frontier backtracking.
+*
+* When exploring runs into a dead end the mouse does not retrace its moves
+* cell by cell. Instead it looks up the nearest frontier cell, an unvisited
+* cell known to be open to a visited one, and plans the shortest route to it
+* through walls already known to be open. The route is handed back as a list
+* of cell moves, ready to be compiled into merged motion primitives.
+*
+* Driving to the nearest frontier cell until there is none left is also an
+* exploration strategy of its own, one that maps every reachable cell.
+*
+* The algo layer defines all mouse maze solving algorithms as the second most
+* highest layer to be called directly in main.
+*-----------------------------------------------------------------------------*/
+
+#ifndef FRONTIER_ALGO_H_
+#define FRONTIER_ALGO_H_
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdint.h>
+#include "algo/algo.h"
+#include "algo/mazemap_algo.h"
+#include "algo/strategy_algo.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+/* a route never drives through a cell twice */
+#define ALGO_FRONTIER_MAX_MOVES     (ALGO_MAZE_CELL_COUNT)
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+void algo_FrontierFind(const algo_maze_map_t* p_map,
+    const algo_maze_row_t* p_allowed, algo_maze_row_t* p_frontier);
+bool algo_FrontierPlan(const algo_maze_map_t* p_map,
+    const algo_maze_row_t* p_allowed, unsigned int x, unsigned int y,
+    unsigned int heading, uint8_t* p_moves, unsigned int* p_moveCount);
+bool algo_FrontierPlanTo(const algo_maze_map_t* p_map,
+    const algo_maze_row_t* p_targets, unsigned int x, unsigned int y,
+    unsigned int heading, uint8_t* p_moves, unsigned int* p_moveCount);
+const algo_strategy_t* algo_FrontierGetStrategy(void);
+
+#endif /* FRONTIER_ALGO_H_ */
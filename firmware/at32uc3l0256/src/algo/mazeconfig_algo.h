@@ -0,0 +1,154 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : mazeconfig_algo.h
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : algo layer
+*
+* This is the header file for the compile time maze geometry.
+*
+* The maze size, goal rectangle, start pose and planner RAM budget are picked
+* w/ ALGO_MAZE_CONFIG from the presets below, or set one by one w/ -D on the
+* compiler command line. Cells are (x, y) w/ x growing east and y growing
+* north from the south west corner; goal corners are inclusive.
+*
+* Everything here is a compile time constant, so the index math below folds
+* into constants, and into shifts and masks for power of two maze widths.
+*
+* The algo layer defines all mouse maze solving algorithms as the second most
+* highest layer to be called directly in main.
+*-----------------------------------------------------------------------------*/
+
+#ifndef MAZECONFIG_ALGO_H_
+#define MAZECONFIG_ALGO_H_
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+/* maze presets */
+#define ALGO_MAZE_CONFIG_TEST_5X5         (0)   /* 5x5 test maze, centre goal */
+#define ALGO_MAZE_CONFIG_CLASSIC_16X16    (1)   /* classic 16x16 competition */
+#define ALGO_MAZE_CONFIG_HALF_32X32       (2)   /* half size 32x32 competition */
+#define ALGO_MAZE_CONFIG_TEST_8X4         (3)   /* 8x4 bench maze, corner goal */
+
+/* CHANGE ACCORDING TO MAZE: */
+#ifndef ALGO_MAZE_CONFIG
+#define ALGO_MAZE_CONFIG    ALGO_MAZE_CONFIG_TEST_5X5
+#endif
+
+#if ALGO_MAZE_CONFIG == ALGO_MAZE_CONFIG_TEST_5X5
+#define ALGO_PRESET_WIDTH       (5u)
+#define ALGO_PRESET_HEIGHT      (5u)
+#define ALGO_PRESET_GOAL_X_MIN  (2u)
+#define ALGO_PRESET_GOAL_Y_MIN  (2u)
+#define ALGO_PRESET_GOAL_X_MAX  (2u)
+#define ALGO_PRESET_GOAL_Y_MAX  (2u)
+#define ALGO_PRESET_ARENA_SIZE  (4096u)
+#elif ALGO_MAZE_CONFIG == ALGO_MAZE_CONFIG_CLASSIC_16X16
+#define ALGO_PRESET_WIDTH       (16u)
+#define ALGO_PRESET_HEIGHT      (16u)
+#define ALGO_PRESET_GOAL_X_MIN  (7u)
+#define ALGO_PRESET_GOAL_Y_MIN  (7u)
+#define ALGO_PRESET_GOAL_X_MAX  (8u)
+#define ALGO_PRESET_GOAL_Y_MAX  (8u)
+#define ALGO_PRESET_ARENA_SIZE  (24576u)
+#elif ALGO_MAZE_CONFIG == ALGO_MAZE_CONFIG_HALF_32X32
+#define ALGO_PRESET_WIDTH       (32u)
+#define ALGO_PRESET_HEIGHT      (32u)
+#define ALGO_PRESET_GOAL_X_MIN  (15u)
+#define ALGO_PRESET_GOAL_Y_MIN  (15u)
+#define ALGO_PRESET_GOAL_X_MAX  (16u)
+#define ALGO_PRESET_GOAL_Y_MAX  (16u)
+/* more than the 32 kB of SRAM, the host benchmarks only */
+#define ALGO_PRESET_ARENA_SIZE  (98304u)
+#elif ALGO_MAZE_CONFIG == ALGO_MAZE_CONFIG_TEST_8X4
+#define ALGO_PRESET_WIDTH       (8u)
+#define ALGO_PRESET_HEIGHT      (4u)
+#define ALGO_PRESET_GOAL_X_MIN  (6u)
+#define ALGO_PRESET_GOAL_Y_MIN  (2u)
+#define ALGO_PRESET_GOAL_X_MAX  (7u)
+#define ALGO_PRESET_GOAL_Y_MAX  (3u)
+#define ALGO_PRESET_ARENA_SIZE  (4096u)
+#else
+#error "unknown ALGO_MAZE_CONFIG"
+#endif
+
+/* maze size in cells */
+#ifndef ALGO_MAZE_WIDTH
+#define ALGO_MAZE_WIDTH         ALGO_PRESET_WIDTH
+#endif
+#ifndef ALGO_MAZE_HEIGHT
+#define ALGO_MAZE_HEIGHT        ALGO_PRESET_HEIGHT
+#endif
+#define ALGO_MAZE_CELL_COUNT    (ALGO_MAZE_WIDTH * ALGO_MAZE_HEIGHT)
+
+/* goal rectangle */
+#ifndef ALGO_MAZE_GOAL_X_MIN
+#define ALGO_MAZE_GOAL_X_MIN    ALGO_PRESET_GOAL_X_MIN
+#endif
+#ifndef ALGO_MAZE_GOAL_Y_MIN
+#define ALGO_MAZE_GOAL_Y_MIN    ALGO_PRESET_GOAL_Y_MIN
+#endif
+#ifndef ALGO_MAZE_GOAL_X_MAX
+#define ALGO_MAZE_GOAL_X_MAX    ALGO_PRESET_GOAL_X_MAX
+#endif
+#ifndef ALGO_MAZE_GOAL_Y_MAX
+#define ALGO_MAZE_GOAL_Y_MAX    ALGO_PRESET_GOAL_Y_MAX
+#endif
+
+/* start cell and heading, heading is one of NORTH, SOUTH, EAST, WEST */
+#ifndef ALGO_MAZE_START_X
+#define ALGO_MAZE_START_X       (0u)
+#endif
+#ifndef ALGO_MAZE_START_Y
+#define ALGO_MAZE_START_Y       (0u)
+#endif
+#ifndef ALGO_MAZE_START_HEADING
+#define ALGO_MAZE_START_HEADING NORTH
+#endif
+
+#if (ALGO_MAZE_WIDTH < 1) || (ALGO_MAZE_HEIGHT < 1)
+#error "maze must be at least one cell"
+#endif
+#if (ALGO_MAZE_GOAL_X_MIN > ALGO_MAZE_GOAL_X_MAX) \
+    || (ALGO_MAZE_GOAL_Y_MIN > ALGO_MAZE_GOAL_Y_MAX) \
+    || (ALGO_MAZE_GOAL_X_MAX >= ALGO_MAZE_WIDTH) \
+    || (ALGO_MAZE_GOAL_Y_MAX >= ALGO_MAZE_HEIGHT)
+#error "goal rectangle must be inside the maze"
+#endif
+#if (ALGO_MAZE_START_X >= ALGO_MAZE_WIDTH) || (ALGO_MAZE_START_Y >= ALGO_MAZE_HEIGHT)
+#error "start cell must be inside the maze"
+#endif
+
+/* bytes of SRAM the planner arena may take, see arena_algo.h; the
+   AT32UC3L0256 has 32 kB for the arena, the stack and everything else */
+#ifndef ALGO_ARENA_SIZE
+#define ALGO_ARENA_SIZE         ALGO_PRESET_ARENA_SIZE
+#endif
+
+/* row of the cell when the maze is printed north row first */
+#define ALGO_MAZE_MIRROR_Y(y)   ((ALGO_MAZE_HEIGHT - 1u) - (y))
+
+/* maze array index of a cell, maze arrays are stored north row first */
+#define ALGO_MAZE_IDX(x, y)     ((ALGO_MAZE_MIRROR_Y(y) * ALGO_MAZE_WIDTH) + (x))
+
+/* cell of a maze array index */
+#define ALGO_MAZE_IDX_X(idx)    ((idx) % ALGO_MAZE_WIDTH)
+#define ALGO_MAZE_IDX_Y(idx)    ALGO_MAZE_MIRROR_Y((idx) / ALGO_MAZE_WIDTH)
+
+/* whether a cell is inside the goal rectangle */
+#define ALGO_MAZE_IS_GOAL(x, y) \
+    (((x) >= ALGO_MAZE_GOAL_X_MIN) && ((x) <= ALGO_MAZE_GOAL_X_MAX) && \
+    ((y) >= ALGO_MAZE_GOAL_Y_MIN) && ((y) <= ALGO_MAZE_GOAL_Y_MAX))
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+#endif /* MAZECONFIG_ALGO_H_ */
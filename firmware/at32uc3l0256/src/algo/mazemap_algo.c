@@ -0,0 +1,96 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : mazemap_algo.c
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : algo layer
+*
+* This is the source file for the bit packed maze map. The per wall and per
+* cell accessors are inline in the header, this file has the whole cell and
+* whole map operations.
+*
+* The algo layer defines all mouse maze solving algorithms as the second most
+* highest layer to be called directly in main.
+*-----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <string.h>
+#include "algo/algo.h"
+#include "algo/mazemap_algo.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                               Debug Switches                               */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                    Private (Static) Function Prototype                     */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+/**
+* Forget every wall and visit, leaving only the outer walls
+*
+* \param[out] p_map Maze map
+* \retval None
+*/
+void algo_MazeMapClear(algo_maze_map_t* p_map)
+{
+    memset(p_map, 0, sizeof(*p_map));
+}
+
+/**
+* Record all four walls seen from a cell
+*
+* \param[in,out] p_map   Maze map
+* \param[in]     x       Cell column
+* \param[in]     y       Cell row
+* \param[in]     p_walls Walls seen from the cell
+* \retval None
+*/
+void algo_MazeMapSetCellWalls(algo_maze_map_t* p_map, unsigned int x,
+    unsigned int y, const MazeCell* p_walls)
+{
+    algo_MazeMapSetWall(p_map, x, y, NORTH, p_walls->northWall);
+    algo_MazeMapSetWall(p_map, x, y, SOUTH, p_walls->southWall);
+    algo_MazeMapSetWall(p_map, x, y, EAST, p_walls->eastWall);
+    algo_MazeMapSetWall(p_map, x, y, WEST, p_walls->westWall);
+}
+
+/**
+* Read back all four walls of a cell, unknown walls read as open
+*
+* \param[in]  p_map   Maze map
+* \param[in]  x       Cell column
+* \param[in]  y       Cell row
+* \param[out] p_walls Walls of the cell
+* \retval None
+*/
+void algo_MazeMapGetCellWalls(const algo_maze_map_t* p_map, unsigned int x,
+    unsigned int y, MazeCell* p_walls)
+{
+    p_walls->northWall = algo_MazeMapHasWall(p_map, x, y, NORTH);
+    p_walls->southWall = algo_MazeMapHasWall(p_map, x, y, SOUTH);
+    p_walls->eastWall = algo_MazeMapHasWall(p_map, x, y, EAST);
+    p_walls->westWall = algo_MazeMapHasWall(p_map, x, y, WEST);
+}
+
+/*----------------------------------------------------------------------------*/
+/*                         Private (Static) Functions                         */
+/*----------------------------------------------------------------------------*/
+/* None */
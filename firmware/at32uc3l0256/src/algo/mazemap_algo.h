@@ -0,0 +1,289 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : mazemap_algo.h
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : algo layer
+*
+* This is the header file for the bit packed maze map.
+*
+* Every wall is stored once as a bit, shared by the two cells on either side
+* of it, so setting a wall from one cell sets it for its neighbor as well.
+* Walls are kept a row of cells per word:
+*   hWalls[y] bit x - wall on the north side of cell (x, y)
+*   vWalls[y] bit x - wall on the east side of cell (x, y)
+* w/ a matching "known" bit for every wall and a visited bit for every cell.
+* Only the walls inside the maze are stored, the outer walls are always there
+* and always known, so a zeroed map is a valid map w/ nothing discovered yet.
+*
+* Keeping whole rows in a word lets a row of cells be scanned w/ a couple of
+* bit operations, e.g. the cells of row y that are open and unvisited to the
+* north are ~hWalls[y] & ~visited[y + 1] & ALGO_MAZE_ROW_MASK.
+*
+* The algo layer defines all mouse maze solving algorithms as the second most
+* highest layer to be called directly in main.
+*-----------------------------------------------------------------------------*/
+
+#ifndef MAZEMAP_ALGO_H_
+#define MAZEMAP_ALGO_H_
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include "algo/algo.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+/* smallest word that holds a row of cells */
+#if ALGO_MAZE_WIDTH <= 8
+typedef uint8_t algo_maze_row_t;
+#elif ALGO_MAZE_WIDTH <= 16
+typedef uint16_t algo_maze_row_t;
+#elif ALGO_MAZE_WIDTH <= 32
+typedef uint32_t algo_maze_row_t;
+#else
+#error "maze map rows only go up to 32 cells"
+#endif
+
+/* every cell of a row */
+#define ALGO_MAZE_ROW_MASK \
+    ((algo_maze_row_t)((((uint64_t)1u) << ALGO_MAZE_WIDTH) - 1u))
+
+/* bit of cell x in a row word */
+#define ALGO_MAZE_ROW_BIT(x)    ((algo_maze_row_t)(((algo_maze_row_t)1u) << (x)))
+
+typedef struct
+{
+    algo_maze_row_t hWalls[ALGO_MAZE_HEIGHT];   /* wall north of the cell */
+    algo_maze_row_t hKnown[ALGO_MAZE_HEIGHT];   /* north wall has been seen */
+    algo_maze_row_t vWalls[ALGO_MAZE_HEIGHT];   /* wall east of the cell */
+    algo_maze_row_t vKnown[ALGO_MAZE_HEIGHT];   /* east wall has been seen */
+    algo_maze_row_t visited[ALGO_MAZE_HEIGHT];  /* cell has been visited */
+} algo_maze_map_t;
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+void algo_MazeMapClear(algo_maze_map_t* p_map);
+void algo_MazeMapSetCellWalls(algo_maze_map_t* p_map, unsigned int x,
+    unsigned int y, const MazeCell* p_walls);
+void algo_MazeMapGetCellWalls(const algo_maze_map_t* p_map, unsigned int x,
+    unsigned int y, MazeCell* p_walls);
+
+/*----------------------------------------------------------------------------*/
+/*                           Inline Map Accessors                             */
+/*----------------------------------------------------------------------------*/
+/**
+* Whether there is a wall on one side of a cell, unknown walls read as open
+*
+* \param[in] p_map Maze map
+* \param[in] x     Cell column
+* \param[in] y     Cell row
+* \param[in] dir   Side of the cell (NORTH, SOUTH, EAST, WEST)
+* \retval TRUE if there is a wall
+*/
+static inline bool algo_MazeMapHasWall(const algo_maze_map_t* p_map,
+    unsigned int x, unsigned int y, unsigned int dir)
+{
+    switch (dir)
+    {
+        case NORTH:
+            return (y + 1 >= ALGO_MAZE_HEIGHT)
+                || (p_map->hWalls[y] & ALGO_MAZE_ROW_BIT(x));
+        case SOUTH:
+            return (y == 0u)
+                || (p_map->hWalls[y - 1] & ALGO_MAZE_ROW_BIT(x));
+        case EAST:
+            return (x + 1 >= ALGO_MAZE_WIDTH)
+                || (p_map->vWalls[y] & ALGO_MAZE_ROW_BIT(x));
+        case WEST:
+            return (x == 0u)
+                || (p_map->vWalls[y] & ALGO_MAZE_ROW_BIT(x - 1));
+    }
+
+    return TRUE;
+}
+
+/**
+* Whether the wall on one side of a cell has been seen yet
+*
+* \param[in] p_map Maze map
+* \param[in] x     Cell column
+* \param[in] y     Cell row
+* \param[in] dir   Side of the cell (NORTH, SOUTH, EAST, WEST)
+* \retval TRUE if the wall is known
+*/
+static inline bool algo_MazeMapIsWallKnown(const algo_maze_map_t* p_map,
+    unsigned int x, unsigned int y, unsigned int dir)
+{
+    switch (dir)
+    {
+        case NORTH:
+            return (y + 1 >= ALGO_MAZE_HEIGHT)
+                || (p_map->hKnown[y] & ALGO_MAZE_ROW_BIT(x));
+        case SOUTH:
+            return (y == 0u)
+                || (p_map->hKnown[y - 1] & ALGO_MAZE_ROW_BIT(x));
+        case EAST:
+            return (x + 1 >= ALGO_MAZE_WIDTH)
+                || (p_map->vKnown[y] & ALGO_MAZE_ROW_BIT(x));
+        case WEST:
+            return (x == 0u)
+                || (p_map->vKnown[y] & ALGO_MAZE_ROW_BIT(x - 1));
+    }
+
+    return TRUE;
+}
+
+/**
+* Whether there is a wall on one side of a cell that has been seen, guessed
+* walls read as open
+*
+* \param[in] p_map Maze map
+* \param[in] x     Cell column
+* \param[in] y     Cell row
+* \param[in] dir   Side of the cell (NORTH, SOUTH, EAST, WEST)
+* \retval TRUE if there is a known wall
+*/
+static inline bool algo_MazeMapHasKnownWall(const algo_maze_map_t* p_map,
+    unsigned int x, unsigned int y, unsigned int dir)
+{
+    return algo_MazeMapHasWall(p_map, x, y, dir)
+        && algo_MazeMapIsWallKnown(p_map, x, y, dir);
+}
+
+/**
+* Record a wall as seen, for the cell and the neighbor sharing it
+*
+* Outer walls are always there, setting them does nothing.
+*
+* \param[in,out] p_map   Maze map
+* \param[in]     x       Cell column
+* \param[in]     y       Cell row
+* \param[in]     dir     Side of the cell (NORTH, SOUTH, EAST, WEST)
+* \param[in]     present TRUE if there is a wall, FALSE if it is open
+* \retval None
+*/
+static inline void algo_MazeMapSetWall(algo_maze_map_t* p_map, unsigned int x,
+    unsigned int y, unsigned int dir, bool present)
+{
+    algo_maze_row_t* p_walls = NULL;
+    algo_maze_row_t* p_known = NULL;
+
+    switch (dir)
+    {
+        case NORTH:
+            if (y + 1 >= ALGO_MAZE_HEIGHT)
+                return;
+            p_walls = &p_map->hWalls[y];
+            p_known = &p_map->hKnown[y];
+            break;
+        case SOUTH:
+            if (y == 0u)
+                return;
+            p_walls = &p_map->hWalls[y - 1];
+            p_known = &p_map->hKnown[y - 1];
+            break;
+        case EAST:
+            if (x + 1 >= ALGO_MAZE_WIDTH)
+                return;
+            p_walls = &p_map->vWalls[y];
+            p_known = &p_map->vKnown[y];
+            break;
+        case WEST:
+            if (x == 0u)
+                return;
+            x--;
+            p_walls = &p_map->vWalls[y];
+            p_known = &p_map->vKnown[y];
+            break;
+        default:
+            return;
+    }
+
+    if (present)
+        *p_walls |= ALGO_MAZE_ROW_BIT(x);
+    else
+        *p_walls &= (algo_maze_row_t)~ALGO_MAZE_ROW_BIT(x);
+    *p_known |= ALGO_MAZE_ROW_BIT(x);
+}
+
+/**
+* Record a guess at a wall w/o taking it as seen, for the cell and the
+* neighbor sharing it
+*
+* The wall reads as present or open like any other, but stays unknown, so
+* it only steers the order the cells are explored in: the floods, the
+* pruning and the proof take it as open. Outer walls are always there,
+* guessing them does nothing.
+*
+* \param[in,out] p_map   Maze map
+* \param[in]     x       Cell column
+* \param[in]     y       Cell row
+* \param[in]     dir     Side of the cell (NORTH, SOUTH, EAST, WEST)
+* \param[in]     present TRUE to guess a wall, FALSE to guess it open
+* \retval None
+*/
+static inline void algo_MazeMapGuessWall(algo_maze_map_t* p_map,
+    unsigned int x, unsigned int y, unsigned int dir, bool present)
+{
+    algo_MazeMapSetWall(p_map, x, y, dir, present);
+
+    switch (dir)
+    {
+        case NORTH:
+            if (y + 1 < ALGO_MAZE_HEIGHT)
+                p_map->hKnown[y] &= (algo_maze_row_t)~ALGO_MAZE_ROW_BIT(x);
+            break;
+        case SOUTH:
+            if (y > 0u)
+                p_map->hKnown[y - 1] &= (algo_maze_row_t)~ALGO_MAZE_ROW_BIT(x);
+            break;
+        case EAST:
+            if (x + 1 < ALGO_MAZE_WIDTH)
+                p_map->vKnown[y] &= (algo_maze_row_t)~ALGO_MAZE_ROW_BIT(x);
+            break;
+        case WEST:
+            if (x > 0u)
+                p_map->vKnown[y] &= (algo_maze_row_t)~ALGO_MAZE_ROW_BIT(x - 1);
+            break;
+    }
+}
+
+/**
+* Whether a cell has been visited
+*
+* \param[in] p_map Maze map
+* \param[in] x     Cell column
+* \param[in] y     Cell row
+* \retval TRUE if visited
+*/
+static inline bool algo_MazeMapIsVisited(const algo_maze_map_t* p_map,
+    unsigned int x, unsigned int y)
+{
+    return (p_map->visited[y] & ALGO_MAZE_ROW_BIT(x)) != 0u;
+}
+
+/**
+* Mark a cell as visited
+*
+* \param[in,out] p_map Maze map
+* \param[in]     x     Cell column
+* \param[in]     y     Cell row
+* \retval None
+*/
+static inline void algo_MazeMapSetVisited(algo_maze_map_t* p_map,
+    unsigned int x, unsigned int y)
+{
+    p_map->visited[y] |= ALGO_MAZE_ROW_BIT(x);
+}
+
+#endif /* MAZEMAP_ALGO_H_ */
@@ -0,0 +1,414 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : mazestore_algo.c
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : algo layer
+*
+* This is the source file for keeping the maze map in flash.
+*
+* The storage region is split into slots, the record size rounded up to a
+* power of two, used as a ring. Flash wears out per erase, so a page is only
+* erased when the ring reaches the first slot in it and every page is erased
+* as often as any other. A save that would write the same map as the newest
+* record is skipped.
+*
+* A record is a header, then the map as it is in RAM:
+*   magic, CRC, maze layout (width, height), flags, sequence number, map
+* The CRC covers everything after itself. The map is written before the
+* header, so a save cut short by a reset leaves a slot w/o the magic or w/ a
+* bad CRC, and restoring falls back to the record before it. The newest
+* record is the good one w/ the highest sequence number.
+*
+* Nothing is kept in RAM but the ring position, records are checked and
+* compared a chunk at a time straight from flash.
+*
+* The last pages of the storage region hold the learned cost model, see
+* algo/costmodel_algo.h, the ring stops short of them.
+*
+* The algo layer defines all mouse maze solving algorithms as the second most
+* highest layer to be called directly in main.
+*-----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "algo/algo.h"
+#include "algo/mazemap_algo.h"
+#include "algo/mazestore_algo.h"
+#include "algo/costmodel_algo.h"
+#include "shared_functions/crc_sf.h"
+#include "mouse_hardware_interface/flash_mhi.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+#define ALGO_MAZESTORE_MAGIC        (0x4D5Au)   /* "MZ" */
+#define ALGO_MAZESTORE_LAYOUT \
+    ((uint16_t)((ALGO_MAZE_WIDTH << 8) | ALGO_MAZE_HEIGHT))
+#define ALGO_MAZESTORE_CHUNK        (32u)       /* bytes read at a time */
+#define ALGO_MAZESTORE_MIN_SLOT     (ALGO_MAZESTORE_CHUNK)
+#define ALGO_MAZESTORE_BLANK        (0xFFu)     /* erased flash */
+
+typedef struct
+{
+    uint16_t magic;
+    uint16_t crc;               /* CRC-16 of layout through the map */
+    uint16_t layout;            /* width << 8 | height */
+    uint16_t flags;             /* ALGO_MAZESTORE_FLAG_* */
+    uint32_t sequence;          /* counts up w/ every save */
+} algo_mazestore_header_t;
+
+/* header bytes covered by the CRC */
+#define ALGO_MAZESTORE_CRC_OFFSET   (offsetof(algo_mazestore_header_t, layout))
+#define ALGO_MAZESTORE_CRC_HEADER \
+    (sizeof(algo_mazestore_header_t) - ALGO_MAZESTORE_CRC_OFFSET)
+#define ALGO_MAZESTORE_RECORD_SIZE \
+    (sizeof(algo_mazestore_header_t) + sizeof(algo_maze_map_t))
+
+/*----------------------------------------------------------------------------*/
+/*                               Debug Switches                               */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+static bool storeReady = FALSE;         /* geometry read and ring scanned */
+static uint32_t storePageSize = 0u;
+static uint32_t storeSlotSize = 0u;
+static uint32_t storeSlotCount = 0u;
+
+static bool storeHasRecord = FALSE;
+static uint32_t storeNewestSlot = 0u;
+static uint32_t storeNewestSequence = 0u;
+
+/*----------------------------------------------------------------------------*/
+/*                    Private (Static) Function Prototype                     */
+/*----------------------------------------------------------------------------*/
+static bool algo_MazeStoreOpen(void);
+static bool algo_MazeStoreIsSlotValid(uint32_t slot,
+    algo_mazestore_header_t* p_header);
+static bool algo_MazeStoreIsSlotBlank(uint32_t slot);
+static bool algo_MazeStoreSlotMatches(uint32_t slot,
+    const algo_mazestore_header_t* p_header, const algo_maze_map_t* p_map);
+static bool algo_MazeStoreFlashMatches(uint32_t offset, const void* p_data,
+    uint32_t size);
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+/**
+* Restore the newest maze map saved in flash
+*
+* \param[out] p_map   Maze map, left alone if there is no good record
+* \param[out] p_flags Flags saved w/ the map, ALGO_MAZESTORE_FLAG_*
+* \retval TRUE if a map was restored
+*/
+bool algo_MazeStoreRestore(algo_maze_map_t* p_map, uint16_t* p_flags)
+{
+    algo_mazestore_header_t header;
+    uint32_t offset = 0u;
+
+    if (!algo_MazeStoreOpen() || !storeHasRecord)
+        return FALSE;
+
+    offset = storeNewestSlot * storeSlotSize;
+    if (!mhi_ReadFlashStore(offset, &header, sizeof(header))
+        || !mhi_ReadFlashStore(offset + sizeof(header), p_map,
+            sizeof(algo_maze_map_t)))
+        return FALSE;
+
+    *p_flags = header.flags;
+    return TRUE;
+}
+
+/**
+* Save the maze map to the next slot of the ring
+*
+* Does nothing if the newest record already holds the same map and flags.
+*
+* \param[in] p_map Maze map
+* \param[in] flags ALGO_MAZESTORE_FLAG_*
+* \retval TRUE if the map is in flash, saved now or before
+*/
+bool algo_MazeStoreSave(const algo_maze_map_t* p_map, uint16_t flags)
+{
+    algo_mazestore_header_t header;
+    uint32_t slot = 0u;
+    uint32_t offset = 0u;
+    uint32_t page = 0u;
+
+    if (!algo_MazeStoreOpen())
+        return FALSE;
+
+    header.magic = ALGO_MAZESTORE_MAGIC;
+    header.layout = ALGO_MAZESTORE_LAYOUT;
+    header.flags = flags;
+    header.sequence = storeNewestSequence + 1u;
+
+    if (storeHasRecord)
+    {
+        /* same map as the newest record, only the sequence would change */
+        header.sequence--;
+        if (algo_MazeStoreSlotMatches(storeNewestSlot, &header, p_map))
+            return TRUE;
+        header.sequence++;
+        slot = (storeNewestSlot + 1u) % storeSlotCount;
+    }
+
+    header.crc = sf_Crc16(SF_CRC16_INIT,
+        (const uint8_t*)&header + ALGO_MAZESTORE_CRC_OFFSET,
+        ALGO_MAZESTORE_CRC_HEADER);
+    header.crc = sf_Crc16(header.crc, p_map, sizeof(algo_maze_map_t));
+
+    /* a slot in the middle of a page can only be written if it is still
+       erased, one left half written by a reset is skipped up to the next
+       page, erasing its page would lose the newest record */
+    while (((slot * storeSlotSize) % storePageSize != 0u)
+        && !algo_MazeStoreIsSlotBlank(slot))
+        slot = (slot + 1u) % storeSlotCount;
+
+    /* erase every page that starts inside the slot */
+    offset = slot * storeSlotSize;
+    for (page = (offset + storePageSize - 1u) / storePageSize;
+        page * storePageSize < offset + storeSlotSize; page++)
+    {
+        if (!mhi_EraseFlashStorePage(page))
+            return FALSE;
+    }
+
+    /* map first, the header makes the record valid, then read it back */
+    if (!mhi_WriteFlashStore(offset + sizeof(header), p_map,
+            sizeof(algo_maze_map_t))
+        || !mhi_WriteFlashStore(offset, &header, sizeof(header))
+        || !algo_MazeStoreFlashMatches(offset, &header, sizeof(header))
+        || !algo_MazeStoreFlashMatches(offset + sizeof(header), p_map,
+            sizeof(algo_maze_map_t)))
+        return FALSE;
+
+    storeHasRecord = TRUE;
+    storeNewestSlot = slot;
+    storeNewestSequence = header.sequence;
+    return TRUE;
+}
+
+/**
+* Erase every saved maze map
+*
+* \param  None
+* \retval TRUE if the whole storage region was erased
+*/
+bool algo_MazeStoreErase(void)
+{
+    uint32_t page = 0u;
+    uint32_t pageCount = 0u;
+
+    if (!algo_MazeStoreOpen())
+        return FALSE;
+
+    pageCount = (storeSlotSize * storeSlotCount) / storePageSize;
+    for (page = 0u; page < pageCount; page++)
+    {
+        if (!mhi_EraseFlashStorePage(page))
+            return FALSE;
+    }
+
+    storeHasRecord = FALSE;
+    storeNewestSlot = 0u;
+    storeNewestSequence = 0u;
+    return TRUE;
+}
+
+/**
+* Bytes of flash taken by one saved map
+*
+* \param  None
+* \retval slot size, 0 if the storage region cannot hold a map
+*/
+uint32_t algo_MazeStoreGetSlotSize(void)
+{
+    if (!algo_MazeStoreOpen())
+        return 0u;
+
+    return storeSlotSize;
+}
+
+/*----------------------------------------------------------------------------*/
+/*                           Local Shared Functions                           */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                         Private (Static) Functions                         */
+/*----------------------------------------------------------------------------*/
+/**
+* Size up the ring and find the newest record, once after boot
+*
+* \param  None
+* \retval TRUE if the storage region can hold a map
+*/
+static bool algo_MazeStoreOpen(void)
+{
+    algo_mazestore_header_t header;
+    uint32_t pageCount = 0u;
+    uint32_t costPages = 0u;
+    uint32_t slot = 0u;
+
+    if (storeReady)
+        return TRUE;
+
+    if (!mhi_GetFlashStoreGeometry(&storePageSize, &pageCount)
+        || storePageSize == 0u || pageCount == 0u)
+        return FALSE;
+
+    costPages = algo_CostModelGetStorePages(storePageSize);
+    if (pageCount <= costPages)
+        return FALSE;
+    pageCount -= costPages;
+
+    /* powers of two, so slots never straddle a page they do not fill */
+    storeSlotSize = ALGO_MAZESTORE_MIN_SLOT;
+    while (storeSlotSize < ALGO_MAZESTORE_RECORD_SIZE)
+        storeSlotSize <<= 1;
+    storeSlotCount = (storePageSize * pageCount) / storeSlotSize;
+
+    /* the slot being written must never share a page w/ the newest record */
+    if ((storeSlotSize % storePageSize != 0u && pageCount < 2u)
+        || storeSlotCount < 2u)
+        return FALSE;
+
+    storeHasRecord = FALSE;
+    for (slot = 0u; slot < storeSlotCount; slot++)
+    {
+        if (!algo_MazeStoreIsSlotValid(slot, &header))
+            continue;
+        if (!storeHasRecord
+            || (int32_t)(header.sequence - storeNewestSequence) > 0)
+        {
+            storeHasRecord = TRUE;
+            storeNewestSlot = slot;
+            storeNewestSequence = header.sequence;
+        }
+    }
+
+    storeReady = TRUE;
+    return TRUE;
+}
+
+/**
+* Whether a slot holds a whole record for this maze layout
+*
+* \param[in]  slot     Slot of the ring
+* \param[out] p_header Header of the record
+* \retval TRUE if the magic, layout and CRC are good
+*/
+static bool algo_MazeStoreIsSlotValid(uint32_t slot,
+    algo_mazestore_header_t* p_header)
+{
+    uint8_t chunk[ALGO_MAZESTORE_CHUNK];
+    uint32_t offset = slot * storeSlotSize;
+    uint32_t end = offset + ALGO_MAZESTORE_RECORD_SIZE;
+    uint32_t size = 0u;
+    uint16_t crc = 0u;
+
+    if (!mhi_ReadFlashStore(offset, p_header, sizeof(*p_header))
+        || p_header->magic != ALGO_MAZESTORE_MAGIC
+        || p_header->layout != ALGO_MAZESTORE_LAYOUT)
+        return FALSE;
+
+    crc = sf_Crc16(SF_CRC16_INIT,
+        (const uint8_t*)p_header + ALGO_MAZESTORE_CRC_OFFSET,
+        ALGO_MAZESTORE_CRC_HEADER);
+    for (offset += sizeof(*p_header); offset < end; offset += size)
+    {
+        size = end - offset;
+        if (size > sizeof(chunk))
+            size = sizeof(chunk);
+        if (!mhi_ReadFlashStore(offset, chunk, size))
+            return FALSE;
+        crc = sf_Crc16(crc, chunk, size);
+    }
+
+    return crc == p_header->crc;
+}
+
+/**
+* Whether a slot is still erased
+*
+* \param[in] slot Slot of the ring
+* \retval TRUE if every byte of the slot reads erased
+*/
+static bool algo_MazeStoreIsSlotBlank(uint32_t slot)
+{
+    uint8_t chunk[ALGO_MAZESTORE_CHUNK];
+    uint32_t offset = slot * storeSlotSize;
+    uint32_t end = offset + storeSlotSize;
+    uint32_t i = 0u;
+
+    for (; offset < end; offset += sizeof(chunk))
+    {
+        if (!mhi_ReadFlashStore(offset, chunk, sizeof(chunk)))
+            return FALSE;
+        for (i = 0u; i < sizeof(chunk); i++)
+        {
+            if (chunk[i] != ALGO_MAZESTORE_BLANK)
+                return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+* Whether a slot holds exactly the given record
+*
+* \param[in] slot     Slot of the ring
+* \param[in] p_header Header to compare, the CRC is not compared
+* \param[in] p_map    Map to compare
+* \retval TRUE if the slot matches
+*/
+static bool algo_MazeStoreSlotMatches(uint32_t slot,
+    const algo_mazestore_header_t* p_header, const algo_maze_map_t* p_map)
+{
+    uint32_t offset = slot * storeSlotSize;
+
+    return algo_MazeStoreFlashMatches(offset + ALGO_MAZESTORE_CRC_OFFSET,
+            (const uint8_t*)p_header + ALGO_MAZESTORE_CRC_OFFSET,
+            ALGO_MAZESTORE_CRC_HEADER)
+        && algo_MazeStoreFlashMatches(offset + sizeof(*p_header), p_map,
+            sizeof(*p_map))
+        && algo_MazeStoreFlashMatches(offset, &p_header->magic,
+            sizeof(p_header->magic));
+}
+
+/**
+* Whether flash holds the given bytes
+*
+* \param[in] offset Byte offset into the storage region
+* \param[in] p_data Bytes to compare
+* \param[in] size   Number of bytes
+* \retval TRUE if they match
+*/
+static bool algo_MazeStoreFlashMatches(uint32_t offset, const void* p_data,
+    uint32_t size)
+{
+    uint8_t chunk[ALGO_MAZESTORE_CHUNK];
+    const uint8_t* p_byte = (const uint8_t*)p_data;
+    uint32_t part = 0u;
+
+    for (; size > 0u; size -= part)
+    {
+        part = (size > sizeof(chunk)) ? sizeof(chunk) : size;
+        if (!mhi_ReadFlashStore(offset, chunk, part)
+            || memcmp(chunk, p_byte, part) != 0)
+            return FALSE;
+        offset += part;
+        p_byte += part;
+    }
+
+    return TRUE;
+}
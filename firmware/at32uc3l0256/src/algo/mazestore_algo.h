@@ -0,0 +1,48 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : mazestore_algo.h
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : algo layer
+*
+* This is the header file for keeping the maze map in flash.
+*
+* The map is saved as a record w/ a CRC into a ring of slots over the flash
+* storage region, each save going to the slot after the last one, so a
+* power loss or reset mid run keeps the walls found so far. At boot the
+* newest record w/ a good CRC is restored.
+*
+* The algo layer defines all mouse maze solving algorithms as the second most
+* highest layer to be called directly in main.
+*-----------------------------------------------------------------------------*/
+
+#ifndef MAZESTORE_ALGO_H_
+#define MAZESTORE_ALGO_H_
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdint.h>
+#include "algo/algo.h"
+#include "algo/mazemap_algo.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+/* record flags */
+#define ALGO_MAZESTORE_FLAG_EXPLORED    (0x0001u)   /* exploring finished */
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+bool algo_MazeStoreRestore(algo_maze_map_t* p_map, uint16_t* p_flags);
+bool algo_MazeStoreSave(const algo_maze_map_t* p_map, uint16_t flags);
+bool algo_MazeStoreErase(void);
+uint32_t algo_MazeStoreGetSlotSize(void);
+
+#endif /* MAZESTORE_ALGO_H_ */
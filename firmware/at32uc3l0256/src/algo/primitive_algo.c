@@ -0,0 +1,312 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : primitive_algo.c
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : algo layer
+*
+* This is the source file for the motion primitive compiler.
+*
+* Compiling is two passes. The first appends a turn and a straight per leg,
+* growing the last straight instead when the heading does not change, so a
+* cell path of N moves in a row becomes one N square straight. The second
+* pass folds every 90 degree turn, one square straight, 90 degree turn into
+* a combined U turn or jog- a one square hop between two turns never gets up
+* to speed, so the executor runs it as one move.
+*
+* The algo layer defines all mouse maze solving algorithms as the second most
+* highest layer to be called directly in main.
+*-----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include "algo/algo.h"
+#include "algo/primitive_algo.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+/* straight between two turns folded into a combined primitive */
+#define ALGO_PRIM_COMBINE_HALF_SQUARES  (2u)
+
+/*----------------------------------------------------------------------------*/
+/*                               Debug Switches                               */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+/* quarter turns clockwise from north of NORTH, SOUTH, EAST, WEST */
+static const uint8_t primQuarterTurns[4] = { 0u, 2u, 1u, 3u };
+
+/* turn in place for a number of quarter turns clockwise */
+static const uint8_t primTurns[4] = { ALGO_PRIM_STRAIGHT, ALGO_PRIM_TURN_RIGHT_90,
+    ALGO_PRIM_TURN_180, ALGO_PRIM_TURN_LEFT_90 };
+
+/* heading of a number of quarter turns clockwise from north */
+static const uint8_t primQuarterHeadings[4] = { NORTH, EAST, SOUTH, WEST };
+
+/* half square steps per eighth turn clockwise from north */
+static const int8_t primEighthDu[8] = { 0, 1, 1, 1, 0, -1, -1, -1 };
+static const int8_t primEighthDv[8] = { 1, 1, 0, -1, -1, -1, 0, 1 };
+
+/*----------------------------------------------------------------------------*/
+/*                    Private (Static) Function Prototype                     */
+/*----------------------------------------------------------------------------*/
+static bool algo_PrimAppend(algo_prim_list_t* p_prims, unsigned int type,
+    unsigned int count);
+static bool algo_PrimIsTurn90(unsigned int type);
+static void algo_PrimStep(int* p_u, int* p_v, unsigned int eighth,
+    unsigned int count);
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+/**
+* Empty a primitive list
+*
+* \param[out] p_prims Primitive list
+* \retval None
+*/
+void algo_PrimListClear(algo_prim_list_t* p_prims)
+{
+    p_prims->count = 0u;
+    p_prims->estimatedTimeUs = 0u;
+}
+
+/**
+* Append a turn in place and a straight, merging w/ the straight before when
+* the heading does not change
+*
+* \param[in,out] p_prims     Primitive list
+* \param[in]     fromHeading Heading before the leg (NORTH, SOUTH, EAST, WEST)
+* \param[in]     heading     Heading of the leg
+* \param[in]     cells       Squares driven straight
+* \retval FALSE if the list is full
+*/
+bool algo_PrimAppendLeg(algo_prim_list_t* p_prims, unsigned int fromHeading,
+    unsigned int heading, unsigned int cells)
+{
+    unsigned int quarterTurns =
+        (primQuarterTurns[heading] - primQuarterTurns[fromHeading]) & 3u;
+    algo_prim_t* p_last = NULL;
+
+    if ((quarterTurns == 0u) && (p_prims->count > 0u))
+    {
+        p_last = &p_prims->prims[p_prims->count - 1u];
+        if ((p_last->type == ALGO_PRIM_STRAIGHT)
+            && ((p_last->count + (2u * cells)) <= UINT8_MAX))
+        {
+            p_last->count = (uint8_t)(p_last->count + (2u * cells));
+            return TRUE;
+        }
+    }
+
+    if ((quarterTurns != 0u)
+        && !algo_PrimAppend(p_prims, primTurns[quarterTurns], 0u))
+        return FALSE;
+
+    return algo_PrimAppend(p_prims, ALGO_PRIM_STRAIGHT, 2u * cells);
+}
+
+/**
+* Fold every 90 degree turn, one square straight, 90 degree turn into a
+* combined U turn or jog
+*
+* \param[in,out] p_prims Primitive list
+* \retval None
+*/
+void algo_PrimCombineTurns(algo_prim_list_t* p_prims)
+{
+    const algo_prim_t* p_prim = NULL;
+    uint16_t from = 0u;
+    uint16_t to = 0u;
+    bool sameWay = FALSE;
+
+    while (from < p_prims->count)
+    {
+        p_prim = &p_prims->prims[from];
+        if (((from + 2u) < p_prims->count)
+            && algo_PrimIsTurn90(p_prim[0].type)
+            && (p_prim[1].type == ALGO_PRIM_STRAIGHT)
+            && (p_prim[1].count == ALGO_PRIM_COMBINE_HALF_SQUARES)
+            && algo_PrimIsTurn90(p_prim[2].type))
+        {
+            sameWay = (p_prim[0].type == p_prim[2].type);
+            if (p_prim[0].type == ALGO_PRIM_TURN_LEFT_90)
+                p_prims->prims[to].type = sameWay ? ALGO_PRIM_UTURN_LEFT : ALGO_PRIM_JOG_LEFT;
+            else
+                p_prims->prims[to].type = sameWay ? ALGO_PRIM_UTURN_RIGHT : ALGO_PRIM_JOG_RIGHT;
+            p_prims->prims[to].count = p_prim[1].count;
+            from += 3u;
+        }
+        else
+        {
+            p_prims->prims[to] = *p_prim;
+            from++;
+        }
+        to++;
+    }
+
+    p_prims->count = to;
+}
+
+/**
+* Compile a cell path into primitives
+*
+* \param[in]  startHeading Heading at the start of the path
+* \param[in]  p_moves      Heading of every move from one cell to the next
+* \param[in]  moveCount    Number of moves
+* \param[out] p_prims      Primitive list, w/o an estimated time
+* \retval FALSE if the path does not fit the list
+*/
+bool algo_PrimCompilePath(unsigned int startHeading, const uint8_t* p_moves,
+    unsigned int moveCount, algo_prim_list_t* p_prims)
+{
+    unsigned int heading = startHeading;
+    unsigned int i = 0u;
+
+    algo_PrimListClear(p_prims);
+
+    for (i = 0u; i < moveCount; i++)
+    {
+        if (!algo_PrimAppendLeg(p_prims, heading, p_moves[i], 1u))
+            return FALSE;
+        heading = p_moves[i];
+    }
+
+    algo_PrimCombineTurns(p_prims);
+
+    return TRUE;
+}
+
+/**
+* Cell a primitive list ends in, for keeping track of the mouse after a run
+*
+* \param[in]     p_prims   Primitive list
+* \param[in,out] p_x       Cell column at the start, then at the end
+* \param[in,out] p_y       Cell row at the start, then at the end
+* \param[in,out] p_heading Heading at the start, then at the end
+* \retval FALSE if the list does not end in a cell centre facing along the
+*         maze, the cell is left as it was then
+*/
+bool algo_PrimEndCell(const algo_prim_list_t* p_prims, unsigned int* p_x,
+    unsigned int* p_y, unsigned int* p_heading)
+{
+    /* half squares, cell centres at odd coordinates */
+    int u = (int)(2u * *p_x + 1u);
+    int v = (int)(2u * *p_y + 1u);
+    unsigned int eighth = 2u * primQuarterTurns[*p_heading];
+    unsigned int count = 0u;
+    unsigned int i = 0u;
+
+    for (i = 0u; i < p_prims->count; i++)
+    {
+        count = p_prims->prims[i].count;
+        switch (p_prims->prims[i].type)
+        {
+            case ALGO_PRIM_STRAIGHT:
+            case ALGO_PRIM_DIAGONAL:
+                algo_PrimStep(&u, &v, eighth, count);
+                break;
+            case ALGO_PRIM_TURN_LEFT_45:
+                eighth += 7u;
+                break;
+            case ALGO_PRIM_TURN_RIGHT_45:
+                eighth += 1u;
+                break;
+            case ALGO_PRIM_TURN_LEFT_90:
+                eighth += 6u;
+                break;
+            case ALGO_PRIM_TURN_RIGHT_90:
+                eighth += 2u;
+                break;
+            case ALGO_PRIM_TURN_180:
+                eighth += 4u;
+                break;
+            case ALGO_PRIM_UTURN_LEFT:
+                algo_PrimStep(&u, &v, eighth + 6u, count);
+                eighth += 4u;
+                break;
+            case ALGO_PRIM_UTURN_RIGHT:
+                algo_PrimStep(&u, &v, eighth + 2u, count);
+                eighth += 4u;
+                break;
+            case ALGO_PRIM_JOG_LEFT:
+                algo_PrimStep(&u, &v, eighth + 6u, count);
+                break;
+            case ALGO_PRIM_JOG_RIGHT:
+                algo_PrimStep(&u, &v, eighth + 2u, count);
+                break;
+        }
+        eighth %= 8u;
+    }
+
+    if (!(u & 1) || !(v & 1) || (eighth & 1u) || (u < 0) || (v < 0))
+        return FALSE;
+
+    *p_x = (unsigned int)u / 2u;
+    *p_y = (unsigned int)v / 2u;
+    *p_heading = primQuarterHeadings[eighth / 2u];
+    return TRUE;
+}
+
+/*----------------------------------------------------------------------------*/
+/*                           Local Shared Functions                           */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                         Private (Static) Functions                         */
+/*----------------------------------------------------------------------------*/
+/**
+* Append one primitive
+*
+* \param[in,out] p_prims Primitive list
+* \param[in]     type    algo_prim_type_t
+* \param[in]     count   Half squares or half steps of a drive
+* \retval FALSE if the list is full
+*/
+static bool algo_PrimAppend(algo_prim_list_t* p_prims, unsigned int type,
+    unsigned int count)
+{
+    if (p_prims->count >= ALGO_PRIM_LIST_MAX)
+        return FALSE;
+
+    p_prims->prims[p_prims->count].type = (uint8_t)type;
+    p_prims->prims[p_prims->count].count = (uint8_t)count;
+    p_prims->count++;
+
+    return TRUE;
+}
+
+/**
+* Whether a primitive is a 90 degree turn in place
+*
+* \param[in] type algo_prim_type_t
+* \retval TRUE for a left or right 90 degree turn
+*/
+static bool algo_PrimIsTurn90(unsigned int type)
+{
+    return (type == ALGO_PRIM_TURN_LEFT_90) || (type == ALGO_PRIM_TURN_RIGHT_90);
+}
+
+/**
+* Move half squares, or half steps on a diagonal, along an eighth heading
+*
+* \param[in,out] p_u    Half square column
+* \param[in,out] p_v    Half square row
+* \param[in]     eighth Eighth turns clockwise from north, any multiple
+* \param[in]     count  Half squares or half steps
+* \retval None
+*/
+static void algo_PrimStep(int* p_u, int* p_v, unsigned int eighth,
+    unsigned int count)
+{
+    *p_u += primEighthDu[eighth % 8u] * (int)count;
+    *p_v += primEighthDv[eighth % 8u] * (int)count;
+}
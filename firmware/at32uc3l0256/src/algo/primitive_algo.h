@@ -0,0 +1,93 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : primitive_algo.h
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : algo layer
+*
+* This is the header file for motion primitives.
+*
+* A primitive is one move the movement layer can run in a go: a turn in place
+* or a straight drive. Straights are counted in half squares so a drive can
+* stop in a wall gap, diagonals in half steps from one wall gap to the next:
+*
+*   ALGO_PRIM_STRAIGHT - count half squares along the heading
+*   ALGO_PRIM_DIAGONAL - count half steps of cell / sqrt(2), gap to gap
+*   ALGO_PRIM_TURN_*   - turn in place, count is unused
+*   ALGO_PRIM_UTURN_*  - 90 degree turn, count half squares, 90 degree turn
+*                        the same way
+*   ALGO_PRIM_JOG_*    - 90 degree turn, count half squares, 90 degree turn
+*                        back to the heading before, named by the first turn
+*
+* Speed run plans are handed to the executor as a list of primitives. A cell
+* path or a list of legs is compiled into one w/ every run of cells in the
+* same heading merged into one straight, and every turn, one square, turn
+* folded into one combined primitive.
+*
+* The algo layer defines all mouse maze solving algorithms as the second most
+* highest layer to be called directly in main.
+*-----------------------------------------------------------------------------*/
+
+#ifndef PRIMITIVE_ALGO_H_
+#define PRIMITIVE_ALGO_H_
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdint.h>
+#include "algo/algo.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+/* a route needs at most three primitives per cell it drives through, the
+   planners still check the list never overflows */
+#define ALGO_PRIM_LIST_MAX      (3u * ALGO_MAZE_CELL_COUNT)
+
+/* motion primitive enumeration */
+typedef enum
+{
+    ALGO_PRIM_STRAIGHT = 0u,
+    ALGO_PRIM_DIAGONAL,
+    ALGO_PRIM_TURN_LEFT_45,
+    ALGO_PRIM_TURN_RIGHT_45,
+    ALGO_PRIM_TURN_LEFT_90,
+    ALGO_PRIM_TURN_RIGHT_90,
+    ALGO_PRIM_TURN_180,
+    ALGO_PRIM_UTURN_LEFT,
+    ALGO_PRIM_UTURN_RIGHT,
+    ALGO_PRIM_JOG_LEFT,
+    ALGO_PRIM_JOG_RIGHT
+} algo_prim_type_t;
+
+typedef struct
+{
+    uint8_t type;               /* algo_prim_type_t */
+    uint8_t count;              /* half squares or half steps of a drive */
+} algo_prim_t;
+
+typedef struct
+{
+    uint16_t count;
+    algo_prim_t prims[ALGO_PRIM_LIST_MAX];
+    uint32_t estimatedTimeUs;   /* run time the model expects */
+} algo_prim_list_t;
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+void algo_PrimListClear(algo_prim_list_t* p_prims);
+bool algo_PrimAppendLeg(algo_prim_list_t* p_prims, unsigned int fromHeading,
+    unsigned int heading, unsigned int cells);
+void algo_PrimCombineTurns(algo_prim_list_t* p_prims);
+bool algo_PrimCompilePath(unsigned int startHeading, const uint8_t* p_moves,
+    unsigned int moveCount, algo_prim_list_t* p_prims);
+bool algo_PrimEndCell(const algo_prim_list_t* p_prims, unsigned int* p_x,
+    unsigned int* p_y, unsigned int* p_heading);
+
+#endif /* PRIMITIVE_ALGO_H_ */
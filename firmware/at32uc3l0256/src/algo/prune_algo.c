@@ -0,0 +1,261 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : prune_algo.c
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : algo layer
+*
+* This is the source file for dead end pruning.
+*
+* The cells still kept are a row of cells per word like the maze map, so the
+* ways out of a whole row are four masks: open to the north, south, east and
+* west into a kept cell. A kept cell in none or one of them is a dead end.
+* A row is pruned until it settles, which runs a dead end corridor along
+* the row in one go, and the rows are swept up and down again until no row
+* changes, which runs it around the corners.
+*
+* Updates carry on from the cells pruned before: walls only prune more, and
+* a cell that was a dead end stays one.
+*
+* The algo layer defines all mouse maze solving algorithms as the second most
+* highest layer to be called directly in main.
+*-----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdint.h>
+#include "algo/algo.h"
+#include "algo/mazemap_algo.h"
+#include "algo/prune_algo.h"
+#include "algo/arena_algo.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+/* goal columns of a row word */
+#define ALGO_PRUNE_GOAL_COLUMNS \
+    ((algo_maze_row_t)(((((uint64_t)1u) << (ALGO_MAZE_GOAL_X_MAX + 1u)) - 1u) \
+    & ~((((uint64_t)1u) << ALGO_MAZE_GOAL_X_MIN) - 1u)))
+
+/*----------------------------------------------------------------------------*/
+/*                               Debug Switches                               */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+/* cells not pruned, and the ones the last update pruned */
+static algo_maze_row_t* const pruneKept = algoArena.pruneKept;
+static algo_maze_row_t* const pruneNew = algoArena.pruneNew;
+static unsigned int prunedCount = 0u;
+static bool pruneCleared = FALSE;
+
+/*----------------------------------------------------------------------------*/
+/*                    Private (Static) Function Prototype                     */
+/*----------------------------------------------------------------------------*/
+static bool algo_PruneRow(const algo_maze_map_t* p_map, unsigned int y);
+static algo_maze_row_t algo_PruneGetAnchors(unsigned int y);
+static unsigned int algo_PruneCountCells(algo_maze_row_t cells);
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+/**
+* Keep every cell again, for a new or restored map or a wall taken away
+*
+* \param None
+* \retval None
+*/
+void algo_PruneClear(void)
+{
+    unsigned int y = 0u;
+
+    for (y = 0u; y < ALGO_MAZE_HEIGHT; y++)
+    {
+        pruneKept[y] = ALGO_MAZE_ROW_MASK;
+        pruneNew[y] = 0u;
+    }
+    prunedCount = 0u;
+    pruneCleared = TRUE;
+}
+
+/**
+* Prune the dead ends the walls seen so far leave
+*
+* \param[in] p_map Walls discovered so far
+* \retval Number of cells newly pruned
+*/
+unsigned int algo_PruneUpdate(const algo_maze_map_t* p_map)
+{
+    unsigned int newCount = 0u;
+    bool changed = TRUE;
+    unsigned int y = 0u;
+
+    if (!pruneCleared)
+        algo_PruneClear();
+
+    for (y = 0u; y < ALGO_MAZE_HEIGHT; y++)
+        pruneNew[y] = pruneKept[y];
+
+    /* a corridor may wind up and down, sweep both ways until it settles */
+    while (changed)
+    {
+        changed = FALSE;
+        for (y = 0u; y < ALGO_MAZE_HEIGHT; y++)
+            changed |= algo_PruneRow(p_map, y);
+        for (y = ALGO_MAZE_HEIGHT; y-- > 0u; )
+            changed |= algo_PruneRow(p_map, y);
+    }
+
+    for (y = 0u; y < ALGO_MAZE_HEIGHT; y++)
+    {
+        pruneNew[y] &= (algo_maze_row_t)~pruneKept[y];
+        newCount += algo_PruneCountCells(pruneNew[y]);
+    }
+    prunedCount += newCount;
+
+    return newCount;
+}
+
+/**
+* Whether a cell is pruned
+*
+* \param[in] x Cell column
+* \param[in] y Cell row
+* \retval TRUE if it can not be on a route to the goal
+*/
+bool algo_PruneIsPruned(unsigned int x, unsigned int y)
+{
+    return pruneCleared && !(pruneKept[y] & ALGO_MAZE_ROW_BIT(x));
+}
+
+/**
+* Cells not pruned, e.g. for a flood to stay within
+*
+* \param None
+* \retval A row of cells per word, ALGO_MAZE_HEIGHT rows
+*/
+const algo_maze_row_t* algo_PruneGetKeptCells(void)
+{
+    if (!pruneCleared)
+        algo_PruneClear();
+
+    return pruneKept;
+}
+
+/**
+* Cells the last update pruned
+*
+* \param None
+* \retval A row of cells per word, ALGO_MAZE_HEIGHT rows
+*/
+const algo_maze_row_t* algo_PruneGetNewCells(void)
+{
+    if (!pruneCleared)
+        algo_PruneClear();
+
+    return pruneNew;
+}
+
+/**
+* Number of cells pruned since the last clear
+*
+* \param None
+* \retval Cells
+*/
+unsigned int algo_PruneGetCount(void)
+{
+    return prunedCount;
+}
+
+/*----------------------------------------------------------------------------*/
+/*                           Local Shared Functions                           */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                         Private (Static) Functions                         */
+/*----------------------------------------------------------------------------*/
+/**
+* Prune the dead ends of one row until the row settles
+*
+* \param[in] p_map Walls discovered so far
+* \param[in] y     Row
+* \retval TRUE if any cell of the row was pruned
+*/
+static bool algo_PruneRow(const algo_maze_map_t* p_map, unsigned int y)
+{
+    algo_maze_row_t kept = pruneKept[y];
+    algo_maze_row_t walls =
+        (algo_maze_row_t)(p_map->vWalls[y] & p_map->vKnown[y]);
+    algo_maze_row_t anchors = algo_PruneGetAnchors(y);
+    algo_maze_row_t north = 0u;
+    algo_maze_row_t south = 0u;
+    algo_maze_row_t east = 0u;
+    algo_maze_row_t west = 0u;
+    algo_maze_row_t dead = 0u;
+
+    /* ways out north and south do not change while the row is pruned, only
+       known walls close a way out, a guessed one may still be open */
+    if (y + 1u < ALGO_MAZE_HEIGHT)
+        north = (algo_maze_row_t)(~(p_map->hWalls[y] & p_map->hKnown[y])
+            & pruneKept[y + 1u]);
+    if (y > 0u)
+        south = (algo_maze_row_t)(~(p_map->hWalls[y - 1u]
+            & p_map->hKnown[y - 1u]) & pruneKept[y - 1u]);
+
+    do
+    {
+        /* the outer walls fall off the ends of the shifted rows */
+        east = (algo_maze_row_t)(~walls & (kept >> 1));
+        west = (algo_maze_row_t)(~(walls << 1) & (kept << 1));
+
+        /* kept cells w/o two ways out */
+        dead = (algo_maze_row_t)(kept & ~anchors
+            & ~((north & (south | east | west)) | (south & (east | west))
+            | (east & west)));
+        kept &= (algo_maze_row_t)~dead;
+    } while (dead != 0u);
+
+    if (kept == pruneKept[y])
+        return FALSE;
+
+    pruneKept[y] = kept;
+    return TRUE;
+}
+
+/**
+* Cells of a row that are never pruned: the start and the goal
+*
+* \param[in] y Row
+* \retval A bit per cell
+*/
+static algo_maze_row_t algo_PruneGetAnchors(unsigned int y)
+{
+    algo_maze_row_t anchors = 0u;
+
+    if (y == ALGO_MAZE_START_Y)
+        anchors |= ALGO_MAZE_ROW_BIT(ALGO_MAZE_START_X);
+    if ((y >= ALGO_MAZE_GOAL_Y_MIN) && (y <= ALGO_MAZE_GOAL_Y_MAX))
+        anchors |= ALGO_PRUNE_GOAL_COLUMNS;
+
+    return anchors;
+}
+
+/**
+* Number of cells set in a row word
+*
+* \param[in] cells A bit per cell
+* \retval Cells
+*/
+static unsigned int algo_PruneCountCells(algo_maze_row_t cells)
+{
+    unsigned int count = 0u;
+
+    for (; cells != 0u; cells &= (algo_maze_row_t)(cells - 1u))
+        count++;
+
+    return count;
+}
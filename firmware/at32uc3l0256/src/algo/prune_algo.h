@@ -0,0 +1,58 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : prune_algo.h
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : algo layer
+*
+* This is the header file for dead end pruning.
+*
+* A cell w/ at most one way out, walls not seen yet taken as open, is a dead
+* end: a route into it has to come back out the way it went in, so it can
+* never be on a route from the start to the goal. Once it is pruned, the
+* cell leading into it may be left w/ one way out as well, and so on down
+* the corridor. The start and goal cells are never pruned.
+*
+* Pruned cells are left out of the goal flood, so they read as unreachable
+* and are never picked to explore, the same as a region walled off on all
+* sides, which the flood never reaches in the first place.
+*
+* Walls only ever take ways out away, so pruned cells stay pruned as the
+* maze fills in. A reading that takes a wall away needs algo_PruneClear()
+* and a fresh update.
+*
+* The algo layer defines all mouse maze solving algorithms as the second most
+* highest layer to be called directly in main.
+*-----------------------------------------------------------------------------*/
+
+#ifndef PRUNE_ALGO_H_
+#define PRUNE_ALGO_H_
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdint.h>
+#include "algo/algo.h"
+#include "algo/mazemap_algo.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+void algo_PruneClear(void);
+unsigned int algo_PruneUpdate(const algo_maze_map_t* p_map);
+bool algo_PruneIsPruned(unsigned int x, unsigned int y);
+const algo_maze_row_t* algo_PruneGetKeptCells(void);
+const algo_maze_row_t* algo_PruneGetNewCells(void);
+unsigned int algo_PruneGetCount(void);
+
+#endif /* PRUNE_ALGO_H_ */
@@ -0,0 +1,412 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : runmanager_algo.c
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : algo layer
+*
+* This is the source file for the run manager.
+*
+* The D1, D2 and D3 LEDs show the mode while it is picked, the ERR LED that
+* the mouse is lost and waits to be put back at the start.
+*
+* The algo layer defines all mouse maze solving algorithms as the second most
+* highest layer to be called directly in main.
+*-----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <string.h>
+#include "algo/algo.h"
+#include "algo/runmanager_algo.h"
+#include "algo/costmodel_algo.h"
+#include "mouse_hardware_interface/leds_mhi.h"
+#include "mouse_hardware_interface/usart_mhi.h"
+#include "mouse_control_interface/walldetection_mci.h"
+#include "mouse_control_interface/movement_mci.h"
+#include "mouse_control_interface/configswitch_mci.h"
+#include "mouse_control_interface/time_mci.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+/* button poll while picking the mode or waiting to be put back */
+#define ALGO_RUN_POLL_MS            (10u)
+
+/* a speed run only starts if the time left is this many times the run the
+   cost table of its profile expects; the first runs at a profile are
+   planned w/ the motion model alone, which knows nothing about the profile */
+#define ALGO_RUN_TIME_FACTOR        (2u)
+
+/* every profile times its primitives into a cost table of its own */
+#if ALGO_RUN_PROFILE_COUNT != ALGO_COSTMODEL_PROFILE_COUNT
+#error "every speed profile needs a cost table"
+#endif
+
+/*----------------------------------------------------------------------------*/
+/*                               Debug Switches                               */
+/*----------------------------------------------------------------------------*/
+/* 1 = Enable Debug Trace Output */
+#define DEBUG_ALGO_RUN_ENABLE       (1)
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+/* PWM of the straights and turns, safe to fast, the first one is also
+   what exploring and the drives back run at */
+static const mci_speed_profile_t runProfiles[ALGO_RUN_PROFILE_COUNT] =
+{
+    { .forwardSpeed = MCI_FORWARD_FAST_SPEED, .turnSpeed = MCI_TURN_SPEED },
+    { .forwardSpeed = 170u, .turnSpeed = 150u },
+    { .forwardSpeed = 200u, .turnSpeed = 160u },
+    { .forwardSpeed = 230u, .turnSpeed = 170u },
+};
+
+static algo_run_state_t runState = ALGO_RUN_STATE_DONE;
+static algo_run_stats_t runStats;
+static bool runPlanned = FALSE;         /* a route to the goal is known */
+
+/*----------------------------------------------------------------------------*/
+/*                    Private (Static) Function Prototype                     */
+/*----------------------------------------------------------------------------*/
+static void algo_RunShowMode(algo_run_mode_t mode);
+static void algo_RunSetProfile(unsigned int profile);
+static void algo_RunSpeedRun(void);
+static void algo_RunLose(void);
+static void algo_RunFinish(void);
+static void algo_RunPrintStats(void);
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+/**
+* Pick the starting mode: every press of the config button steps to the
+* next one, and the selection ends ALGO_RUN_SELECT_MS after the last press
+*
+* \param None
+* \retval Mode picked
+*/
+algo_run_mode_t algo_RunSelectMode(void)
+{
+    algo_run_mode_t mode = ALGO_RUN_MODE_CONTINUE;
+
+    /* drop presses from before the selection */
+    (void)mci_CheckConfigButtonPressed();
+    algo_RunShowMode(mode);
+
+    mci_StartTimer();
+    while (mci_GetTimeMs() < ALGO_RUN_SELECT_MS)
+    {
+        if (mci_CheckConfigButtonPressed() == MCI_BUTTON_PRESSED)
+        {
+            mode = (algo_run_mode_t)((mode + 1u) % ALGO_RUN_MODE_COUNT);
+            algo_RunShowMode(mode);
+            mci_ResetTimer();
+        }
+        mci_DelayMs(ALGO_RUN_POLL_MS);
+    }
+
+    mhi_ClearD1Led();
+    mhi_ClearD2Led();
+    mhi_ClearD3Led();
+
+    return mode;
+}
+
+/**
+* Start the competition clock and the run in a mode, w/ the mouse in the
+* start cell facing the way runs start
+*
+* \param[in] mode Starting mode
+* \retval None
+*/
+void algo_RunStart(algo_run_mode_t mode)
+{
+    memset(&runStats, 0, sizeof(runStats));
+    runStats.topProfile = ALGO_RUN_PROFILE_COUNT - 1u;
+    runStats.profile = (runStats.topProfile > 0u) ? 1u : 0u;
+    runPlanned = FALSE;
+    algo_RunSetProfile(0u);
+    mci_PlaceAtStart();
+    mhi_ClearErrLed();
+    (void)algo_CostModelRestore();
+
+    if ((mode == ALGO_RUN_MODE_NEW_MAZE) || !restoreMaze())
+    {
+        forgetMaze();
+        runState = ALGO_RUN_STATE_EXPLORE;
+    }
+    else if ((mode == ALGO_RUN_MODE_SPEED_RUNS) || isMazeExplored())
+        runState = ALGO_RUN_STATE_RETURN;
+    else
+        runState = ALGO_RUN_STATE_EXPLORE;
+
+    mci_ResetTimer();
+}
+
+/**
+* Take one step of the run: one exploring step, one drive back, one speed
+* run or one button poll
+*
+* \param None
+* \retval FALSE once the run is done
+*/
+bool algo_RunStep(void)
+{
+    if ((runState != ALGO_RUN_STATE_DONE)
+        && (mci_GetTimeMs() >= ALGO_RUN_TIME_LIMIT_MS))
+    {
+        algo_RunFinish();
+    }
+
+    switch (runState)
+    {
+        case ALGO_RUN_STATE_EXPLORE:
+            if (traverseCell())
+            {
+                runStats.exploreMs = mci_GetTimeMs();
+                if (checkPosition())
+                    runState = ALGO_RUN_STATE_RETURN;
+                else
+                    algo_RunLose();
+            }
+            break;
+
+        case ALGO_RUN_STATE_RETURN:
+            algo_RunSetProfile(0u);
+            if (!returnToStart() || !checkPosition())
+            {
+                algo_RunLose();
+                break;
+            }
+            /* the drive back took over the speed run primitives */
+            runPlanned = planSpeedRun(runStats.profile);
+            if (runPlanned)
+                runState = ALGO_RUN_STATE_SPEED_RUN;
+            else if (!isMazeExplored())
+                runState = ALGO_RUN_STATE_EXPLORE;
+            else
+            {
+                algo_RunFinish();
+            }
+            break;
+
+        case ALGO_RUN_STATE_SPEED_RUN:
+            algo_RunSpeedRun();
+            break;
+
+        case ALGO_RUN_STATE_LOST:
+            /* pressed once the mouse is back in the start cell */
+            if (mci_CheckConfigButtonPressed() == MCI_BUTTON_PRESSED)
+            {
+                placeAtStart();
+                mhi_ClearErrLed();
+                runState = (runPlanned || isMazeExplored())
+                    ? ALGO_RUN_STATE_RETURN : ALGO_RUN_STATE_EXPLORE;
+            }
+            else
+                mci_DelayMs(ALGO_RUN_POLL_MS);
+            break;
+
+        case ALGO_RUN_STATE_DONE:
+            return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+* The mouse crashed or lost its way, for crash detection outside the run
+* manager; wait for it to be put back at the start
+*
+* \param None
+* \retval None
+*/
+void algo_RunReportLost(void)
+{
+    if ((runState != ALGO_RUN_STATE_LOST) && (runState != ALGO_RUN_STATE_DONE))
+        algo_RunLose();
+}
+
+/**
+* State of the run
+*
+* \param None
+* \retval State
+*/
+algo_run_state_t algo_RunGetState(void)
+{
+    return runState;
+}
+
+/**
+* Counts since the run started
+*
+* \param None
+* \retval Counts
+*/
+const algo_run_stats_t* algo_RunGetStats(void)
+{
+    return &runStats;
+}
+
+/*----------------------------------------------------------------------------*/
+/*                           Local Shared Functions                           */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                         Private (Static) Functions                         */
+/*----------------------------------------------------------------------------*/
+/**
+* Show a mode on the D1, D2 and D3 LEDs, one LED per mode
+*
+* \param[in] mode Mode to show
+* \retval None
+*/
+static void algo_RunShowMode(algo_run_mode_t mode)
+{
+    mhi_ClearD1Led();
+    mhi_ClearD2Led();
+    mhi_ClearD3Led();
+
+    switch (mode)
+    {
+        case ALGO_RUN_MODE_CONTINUE:
+            mhi_SetD1Led();
+            break;
+        case ALGO_RUN_MODE_NEW_MAZE:
+            mhi_SetD2Led();
+            break;
+        default:
+            mhi_SetD3Led();
+            break;
+    }
+}
+
+/**
+* Drive at a speed profile from now on, and time the moves into its cost
+* table
+*
+* \param[in] profile Index into runProfiles
+* \retval None
+*/
+static void algo_RunSetProfile(unsigned int profile)
+{
+    mci_SetSpeedProfile(&runProfiles[profile]);
+    setRunProfile(profile);
+}
+
+/**
+* One speed run at the next profile, if the time left covers it; a run that
+* ends where the map says steps the profile up
+*
+* \param None
+* \retval None
+*/
+static void algo_RunSpeedRun(void)
+{
+    uint32_t needMs = ALGO_RUN_TIME_FACTOR * estimateSpeedRunMs();
+    uint32_t startMs = 0u;
+    uint32_t runMs = 0u;
+
+    if (mci_GetTimeMs() + needMs > ALGO_RUN_TIME_LIMIT_MS)
+    {
+        algo_RunFinish();
+        return;
+    }
+
+    algo_RunSetProfile(runStats.profile);
+    startMs = mci_GetTimeMs();
+    runSpeedRun();
+    runMs = mci_GetTimeMs() - startMs;
+    algo_RunSetProfile(0u);
+
+    if (!checkPosition())
+    {
+        algo_RunLose();
+        return;
+    }
+
+    runStats.speedRuns++;
+    if ((runStats.bestRunMs == 0u) || (runMs < runStats.bestRunMs))
+        runStats.bestRunMs = runMs;
+
+#if defined(DEBUG_ALGO_RUN_ENABLE) && (DEBUG_ALGO_RUN_ENABLE == 1)
+    mhi_PrintString("Speed run ms: ");
+    mhi_PrintInt(runMs);
+    mhi_PrintString(", profile: ");
+    mhi_PrintInt(runStats.profile);
+    mhi_PrintString("\n\r");
+#endif /* DEBUG_ALGO_RUN_ENABLE */
+
+    /* keep what the run taught the cost model through a reset */
+    (void)algo_CostModelSave();
+
+    if (runStats.profile < runStats.topProfile)
+        runStats.profile++;
+    runState = ALGO_RUN_STATE_RETURN;
+}
+
+/**
+* Wait for the mouse to be put back at the start; lost on a speed run, the
+* runs after stay below the profile it was lost at
+*
+* \param None
+* \retval None
+*/
+static void algo_RunLose(void)
+{
+    if ((runState == ALGO_RUN_STATE_SPEED_RUN) && (runStats.profile > 0u))
+    {
+        runStats.topProfile = runStats.profile - 1u;
+        runStats.profile = runStats.topProfile;
+    }
+
+    runStats.lost++;
+    algo_RunSetProfile(0u);
+    mhi_SetErrLed();
+    runState = ALGO_RUN_STATE_LOST;
+
+#if defined(DEBUG_ALGO_RUN_ENABLE) && (DEBUG_ALGO_RUN_ENABLE == 1)
+    mhi_PrintString("Run lost, put the mouse back and press the button\n\r");
+#endif /* DEBUG_ALGO_RUN_ENABLE */
+}
+
+/**
+* End the run: keep the cost model in flash and print it w/ how the run went
+*
+* \param None
+* \retval None
+*/
+static void algo_RunFinish(void)
+{
+    runState = ALGO_RUN_STATE_DONE;
+    if (!algo_CostModelSave())
+        mhi_PrintString("Cost model save: flash error\n\r");
+    algo_RunPrintStats();
+    algo_CostModelExport();
+}
+
+/**
+* Print how the run went
+*
+* \param None
+* \retval None
+*/
+static void algo_RunPrintStats(void)
+{
+#if defined(DEBUG_ALGO_RUN_ENABLE) && (DEBUG_ALGO_RUN_ENABLE == 1)
+    mhi_PrintString("Run done, explore ms: ");
+    mhi_PrintInt(runStats.exploreMs);
+    mhi_PrintString(", speed runs: ");
+    mhi_PrintInt(runStats.speedRuns);
+    mhi_PrintString(", best ms: ");
+    mhi_PrintInt(runStats.bestRunMs);
+    mhi_PrintString(", lost: ");
+    mhi_PrintInt(runStats.lost);
+    mhi_PrintString("\n\r");
+#endif /* DEBUG_ALGO_RUN_ENABLE */
+}
@@ -0,0 +1,108 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : runmanager_algo.h
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : algo layer
+*
+* This is the header file for the run manager.
+*
+* A competition run is a sequence within a time limit, and the run manager
+* steps through it one call at a time from main:
+*
+*   EXPLORE    - traverseCell() until the route to the goal is proven
+*   RETURN     - drive back to the start over walls known to be open, and
+*                plan the speed run
+*   SPEED_RUN  - one speed run at the next speed profile, then RETURN again
+*   LOST       - the walls around the mouse do not match the map, after a
+*                crash or a slip: wait for the config button, pressed once
+*                the mouse is back in the start cell by hand
+*   DONE       - out of time, or no route to run
+*
+* Every speed run that ends where the map says it should steps the speed
+* profile up. Losing the position at a profile caps the speed runs one
+* profile below it for the rest of the run. Exploring and returning always
+* run at the safe profile.
+*
+* The primitive times learned in the run, one cost table per profile, are
+* saved to flash after every speed run and at the end, and printed over the
+* USART once it is done. Starting a run restores them. A speed run is
+* planned, and its time estimated, w/ the table of the profile it runs at.
+*
+* The elapsed competition time comes from mci_GetTimeMs(), started once the
+* mode is picked, and a speed run only starts if the time left covers it. A
+* run counts once it ends in the goal, so the drive back after the last one
+* does not have to fit.
+*
+* The algo layer defines all mouse maze solving algorithms as the second most
+* highest layer to be called directly in main.
+*-----------------------------------------------------------------------------*/
+
+#ifndef RUNMANAGER_ALGO_H_
+#define RUNMANAGER_ALGO_H_
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdint.h>
+#include "algo/algo.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+/* competition time limit, from the end of the mode selection */
+#ifndef ALGO_RUN_TIME_LIMIT_MS
+#define ALGO_RUN_TIME_LIMIT_MS      (600000u)
+#endif
+
+/* time w/o a button press that ends the mode selection */
+#define ALGO_RUN_SELECT_MS          (3000u)
+
+/* speed profiles, the safe one first */
+#define ALGO_RUN_PROFILE_COUNT      (4u)
+
+/* starting mode enumeration, picked w/ the config button */
+typedef enum
+{
+    ALGO_RUN_MODE_CONTINUE = 0u,    /* restored map, explore if unproven */
+    ALGO_RUN_MODE_NEW_MAZE,         /* blank map, explore from scratch */
+    ALGO_RUN_MODE_SPEED_RUNS,       /* restored map, straight to speed runs */
+    ALGO_RUN_MODE_COUNT
+} algo_run_mode_t;
+
+/* run state enumeration */
+typedef enum
+{
+    ALGO_RUN_STATE_EXPLORE = 0u,
+    ALGO_RUN_STATE_RETURN,
+    ALGO_RUN_STATE_SPEED_RUN,
+    ALGO_RUN_STATE_LOST,
+    ALGO_RUN_STATE_DONE
+} algo_run_state_t;
+
+typedef struct
+{
+    uint32_t exploreMs;         /* from the start until exploring was done */
+    uint32_t bestRunMs;         /* fastest speed run, 0 before the first */
+    uint16_t speedRuns;         /* speed runs that ended in the goal */
+    uint16_t lost;              /* times the position was lost */
+    uint8_t profile;            /* profile of the next speed run */
+    uint8_t topProfile;         /* fastest profile still allowed */
+} algo_run_stats_t;
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+algo_run_mode_t algo_RunSelectMode(void);
+void algo_RunStart(algo_run_mode_t mode);
+bool algo_RunStep(void);
+void algo_RunReportLost(void);
+algo_run_state_t algo_RunGetState(void);
+const algo_run_stats_t* algo_RunGetStats(void);
+
+#endif /* RUNMANAGER_ALGO_H_ */
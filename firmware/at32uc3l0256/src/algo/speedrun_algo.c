@@ -0,0 +1,1195 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : speedrun_algo.c
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : algo layer
+*
+* This is the source file for the speed run planner.
+*
+* The planner is a Dijkstra search over (cell, axis) states, where the axis
+* says whether the mouse came into the cell driving north/south or east/west.
+* From a state the mouse turns 90 degrees in place and drives a straight of
+* any length the known walls allow, so every edge is one whole leg and its
+* cost is the turn plus the time the straight takes w/ the acceleration
+* limit. Straights start and end at rest since the turns are in place.
+*
+* Only walls that are known to be open are driven through- the speed run
+* should never find a wall the hard way.
+*
+* W/ a learned cost table in the model, see algo/costmodel_algo.h, every
+* turn and drive length timed often enough costs what it took on the mouse,
+* the rest what the motion model works out.
+*
+* The diagonal planner searches the same way over a finer grid of half
+* squares, where cell centres have odd coordinates on both axes and wall gaps
+* (the middle of a wall) odd on one axis only. On top of the cell states it
+* has two states per wall gap, one for each way through it. Runs are:
+*   cell -> straight -> cell           turn 90 at the cell
+*   cell -> straight -> gap, diagonal  turn 45 in the gap between them
+*   gap  -> straight -> cell or gap    turn 45 out of the diagonal first
+*   gap  -> diagonal                   turn 90 from one diagonal to the other
+* so a staircase of one square legs becomes one long diagonal w/ a 45 degree
+* turn at each end. A gap state keeps the way through but not which diagonal
+* the mouse came in on, so carrying on along the same diagonal is charged a
+* 90 degree turn- the one longer run from the state before is always faster,
+* the search never picks it.
+*
+* The algo layer defines all mouse maze solving algorithms as the second most
+* highest layer to be called directly in main.
+*-----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include <math.h>
+#include "algo/algo.h"
+#include "algo/mazemap_algo.h"
+#include "algo/speedrun_algo.h"
+#include "algo/costmodel_algo.h"
+#include "algo/arena_algo.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+#define ALGO_SPEEDRUN_STATE(idx, axis)  (((idx) << 1) | (axis))
+#define ALGO_SPEEDRUN_STATE_IDX(state)  ((state) >> 1)
+
+/* 0 = north/south, 1 = east/west */
+#define ALGO_SPEEDRUN_AXIS(heading)     (((heading) == EAST) || ((heading) == WEST))
+
+/* first north wall gap and first east wall gap state, way 0 is north/east */
+#define ALGO_SPEEDRUN_H_GAP_BASE    (ALGO_MAZE_CELL_COUNT * 2u)
+#define ALGO_SPEEDRUN_V_GAP_BASE    (ALGO_MAZE_CELL_COUNT * 4u)
+
+/* headings of the diagonal planner, clockwise in 45 degree steps */
+#define ALGO_SPEEDRUN_H8_NORTH      (0u)
+#define ALGO_SPEEDRUN_H8_EAST       (2u)
+#define ALGO_SPEEDRUN_H8_SOUTH      (4u)
+#define ALGO_SPEEDRUN_H8_WEST       (6u)
+#define ALGO_SPEEDRUN_H8_TURN(heading, steps)   (((heading) + (steps)) & 7u)
+
+/* half step length is cell / sqrt(2) */
+#define ALGO_SPEEDRUN_HALF_STEP_PER_CELL    (0.70710678f)
+
+#if ALGO_SPEEDRUN_STATE_COUNT >= 0xFFFEu
+#error "speed run states do not fit the 16 bit search arrays"
+#endif
+
+/* speedRunPrev of a state reached straight from the start */
+#define ALGO_SPEEDRUN_FROM_START    (0xFFFFu)
+
+/* speedRunHeapPos of states not in the heap */
+#define ALGO_SPEEDRUN_NOT_QUEUED    (0xFFFFu)
+#define ALGO_SPEEDRUN_SETTLED       (0xFFFEu)
+
+#define ALGO_SPEEDRUN_UNREACHED     (0xFFFFFFFFu)
+
+/*----------------------------------------------------------------------------*/
+/*                               Debug Switches                               */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+/* best time found so far to each state and where it came from */
+static uint32_t* const speedRunDist = algoArena.speedRunDist;
+static uint16_t* const speedRunPrev = algoArena.speedRunPrev;
+
+/* indexed binary min heap of states waiting to be settled */
+static uint16_t* const speedRunHeap = algoArena.speedRunHeap;
+static uint16_t* const speedRunHeapPos = algoArena.speedRunHeapPos;
+static uint16_t speedRunHeapCount = 0u;
+
+/* straight times for the model being planned w/, index is cells */
+static uint32_t* const speedRunStraightUs = algoArena.speedRunStraightUs;
+
+#if ALGO_SPEEDRUN_DIAGONAL_ENABLE
+/* straight and diagonal times, index is half squares and half steps */
+static uint32_t* const speedRunHalfUs = algoArena.speedRunHalfUs;
+static uint32_t* const speedRunDiagUs = algoArena.speedRunDiagUs;
+
+/* half square offsets of each heading */
+static const int8_t speedRunStepU[8] = { 0, 1, 1, 1, 0, -1, -1, -1 };
+static const int8_t speedRunStepV[8] = { 1, 1, 0, -1, -1, -1, 0, 1 };
+
+/* diagonal planner heading of NORTH, SOUTH, EAST, WEST */
+static const uint8_t speedRunHeading8[4] = {
+    ALGO_SPEEDRUN_H8_NORTH, ALGO_SPEEDRUN_H8_SOUTH,
+    ALGO_SPEEDRUN_H8_EAST, ALGO_SPEEDRUN_H8_WEST };
+#endif
+
+/*----------------------------------------------------------------------------*/
+/*                    Private (Static) Function Prototype                     */
+/*----------------------------------------------------------------------------*/
+static void algo_SpeedRunResetSearch(void);
+static uint32_t algo_SpeedRunDriveUs(const algo_speedrun_model_t* p_model,
+    float distanceMm);
+static uint32_t algo_SpeedRunRunUs(const algo_speedrun_model_t* p_model,
+    unsigned int type, unsigned int count);
+static uint32_t algo_SpeedRunModelRunUs(const algo_speedrun_model_t* p_model,
+    unsigned int type, unsigned int count);
+static uint32_t algo_SpeedRunTurnTimeUs(const algo_speedrun_model_t* p_model,
+    unsigned int type);
+static void algo_SpeedRunResolveTurns(const algo_speedrun_model_t* p_model,
+    algo_speedrun_model_t* p_resolved);
+static bool algo_SpeedRunIsOpen(const algo_maze_map_t* p_map, unsigned int x,
+    unsigned int y, unsigned int dir);
+static void algo_SpeedRunRelaxLegs(const algo_maze_map_t* p_map,
+    unsigned int x, unsigned int y, unsigned int dir, uint32_t baseUs,
+    uint16_t fromState);
+static void algo_SpeedRunRelax(uint16_t state, uint32_t timeUs,
+    uint16_t fromState);
+static uint16_t algo_SpeedRunHeapPop(void);
+static void algo_SpeedRunHeapUp(uint16_t pos);
+static void algo_SpeedRunHeapDown(uint16_t pos);
+static void algo_SpeedRunHeapSwap(uint16_t a, uint16_t b);
+static void algo_SpeedRunBuildRoute(uint16_t goalState,
+    algo_speedrun_route_t* p_route);
+#if ALGO_SPEEDRUN_DIAGONAL_ENABLE
+static bool algo_SpeedRunIsPassable(const algo_maze_map_t* p_map, int u, int v);
+static uint16_t algo_SpeedRunPointState(int u, int v, unsigned int heading);
+static unsigned int algo_SpeedRunStatePoint(uint16_t state, int* p_u, int* p_v);
+static void algo_SpeedRunRelaxRuns(const algo_maze_map_t* p_map, int u, int v,
+    unsigned int heading, uint32_t baseUs, const algo_speedrun_model_t* p_model,
+    uint16_t fromState);
+static void algo_SpeedRunRelaxDiagonal(const algo_maze_map_t* p_map, int u,
+    int v, unsigned int heading, uint32_t baseUs, uint16_t fromState);
+static unsigned int algo_SpeedRunSplitRun(int fromU, int fromV, int toU,
+    int toV, unsigned int* p_headings, unsigned int* p_steps);
+static bool algo_SpeedRunBuildPrims(uint16_t goalState,
+    algo_prim_list_t* p_prims);
+static bool algo_SpeedRunPushPrim(algo_prim_list_t* p_prims, uint16_t* p_pos,
+    unsigned int type, unsigned int count);
+static bool algo_SpeedRunPushTurn(algo_prim_list_t* p_prims, uint16_t* p_pos,
+    unsigned int fromHeading, unsigned int toHeading);
+#endif
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+/**
+* Fill a motion model w/ the default estimates
+*
+* \param[out] p_model Motion model
+* \retval None
+*/
+void algo_SpeedRunGetDefaultModel(algo_speedrun_model_t* p_model)
+{
+    p_model->cellMm = ALGO_SPEEDRUN_CELL_MM;
+    p_model->maxSpeedMmPerS = ALGO_SPEEDRUN_MAX_SPEED_MM_PER_S;
+    p_model->accelMmPerS2 = ALGO_SPEEDRUN_ACCEL_MM_PER_S2;
+    p_model->turn45Us = ALGO_SPEEDRUN_TURN_45_US;
+    p_model->turn90Us = ALGO_SPEEDRUN_TURN_90_US;
+    p_model->turn180Us = ALGO_SPEEDRUN_TURN_180_US;
+    p_model->p_costs = NULL;
+}
+
+/**
+* Plan the fastest route from the start pose to the goal rectangle
+*
+* \param[in]  p_map   Maze map, only known open walls are used
+* \param[in]  p_model Motion model for the edge costs
+* \param[out] p_route Fastest route and its estimated time
+* \retval TRUE if the known walls connect the start to the goal
+*/
+bool algo_SpeedRunPlan(const algo_maze_map_t* p_map,
+    const algo_speedrun_model_t* p_model, algo_speedrun_route_t* p_route)
+{
+    algo_speedrun_model_t model;
+    unsigned int state = 0u;
+    unsigned int idx = 0u;
+    unsigned int x = 0u;
+    unsigned int y = 0u;
+    unsigned int dir = 0u;
+
+    p_route->startX = ALGO_MAZE_START_X;
+    p_route->startY = ALGO_MAZE_START_Y;
+    p_route->startHeading = ALGO_MAZE_START_HEADING;
+    p_route->legCount = 0u;
+    p_route->estimatedTimeUs = 0u;
+
+    if (ALGO_MAZE_IS_GOAL(ALGO_MAZE_START_X, ALGO_MAZE_START_Y))
+        return TRUE;
+
+    algo_SpeedRunResolveTurns(p_model, &model);
+
+    for (x = 0u; x <= ALGO_SPEEDRUN_MAX_STRAIGHT; x++)
+        speedRunStraightUs[x] = algo_SpeedRunStraightUs(&model, x);
+
+    algo_SpeedRunResetSearch();
+
+    /* the first leg may go any way, turning from the start heading first */
+    for (dir = NORTH; dir <= WEST; dir++)
+        algo_SpeedRunRelaxLegs(p_map, ALGO_MAZE_START_X, ALGO_MAZE_START_Y,
+            dir, algo_SpeedRunTurnUs(&model, ALGO_MAZE_START_HEADING, dir),
+            ALGO_SPEEDRUN_FROM_START);
+
+    while (speedRunHeapCount > 0u)
+    {
+        state = algo_SpeedRunHeapPop();
+        idx = ALGO_SPEEDRUN_STATE_IDX(state);
+        x = ALGO_MAZE_IDX_X(idx);
+        y = ALGO_MAZE_IDX_Y(idx);
+
+        /* states leave the heap fastest first, the first goal is the best */
+        if (ALGO_MAZE_IS_GOAL(x, y))
+        {
+            algo_SpeedRunBuildRoute((uint16_t)state, p_route);
+            p_route->estimatedTimeUs = speedRunDist[state];
+            return TRUE;
+        }
+
+        /* carrying on along the same axis would have been one longer leg */
+        for (dir = NORTH; dir <= WEST; dir++)
+            if (ALGO_SPEEDRUN_AXIS(dir) != (state & 1u))
+                algo_SpeedRunRelaxLegs(p_map, x, y, dir,
+                    speedRunDist[state] + model.turn90Us, (uint16_t)state);
+    }
+
+    return FALSE;
+}
+
+#if ALGO_SPEEDRUN_DIAGONAL_ENABLE
+/**
+* Plan the fastest route from the start pose to the goal rectangle w/ 45
+* degree diagonals through the wall gaps
+*
+* \param[in]  p_map   Maze map, only known open walls are used
+* \param[in]  p_model Motion model for the edge costs
+* \param[out] p_prims Primitives of the fastest route and its estimated time
+* \retval TRUE if the known walls connect the start to the goal and the
+*         route fits the primitive list
+*/
+bool algo_SpeedRunPlanDiagonal(const algo_maze_map_t* p_map,
+    const algo_speedrun_model_t* p_model, algo_prim_list_t* p_prims)
+{
+    algo_speedrun_model_t model;
+    unsigned int state = 0u;
+    unsigned int heading = 0u;
+    unsigned int i = 0u;
+    int u = 0;
+    int v = 0;
+
+    p_prims->count = 0u;
+    p_prims->estimatedTimeUs = 0u;
+
+    if (ALGO_MAZE_IS_GOAL(ALGO_MAZE_START_X, ALGO_MAZE_START_Y))
+        return TRUE;
+
+    algo_SpeedRunResolveTurns(p_model, &model);
+
+    for (i = 0u; i <= (2u * ALGO_SPEEDRUN_MAX_STRAIGHT); i++)
+    {
+        speedRunHalfUs[i] = algo_SpeedRunRunUs(&model, ALGO_PRIM_STRAIGHT, i);
+        speedRunDiagUs[i] = algo_SpeedRunRunUs(&model, ALGO_PRIM_DIAGONAL, i);
+    }
+
+    algo_SpeedRunResetSearch();
+
+    for (i = NORTH; i <= WEST; i++)
+        algo_SpeedRunRelaxRuns(p_map, (int)(2u * ALGO_MAZE_START_X) + 1,
+            (int)(2u * ALGO_MAZE_START_Y) + 1, speedRunHeading8[i],
+            algo_SpeedRunTurnUs(&model, ALGO_MAZE_START_HEADING, i), &model,
+            ALGO_SPEEDRUN_FROM_START);
+
+    while (speedRunHeapCount > 0u)
+    {
+        state = algo_SpeedRunHeapPop();
+        heading = algo_SpeedRunStatePoint((uint16_t)state, &u, &v);
+
+        if (state < ALGO_SPEEDRUN_H_GAP_BASE)
+        {
+            if (ALGO_MAZE_IS_GOAL((unsigned int)(u >> 1), (unsigned int)(v >> 1)))
+            {
+                p_prims->estimatedTimeUs = speedRunDist[state];
+                return algo_SpeedRunBuildPrims((uint16_t)state, p_prims);
+            }
+
+            /* same as the square planner, turn 90 and go */
+            algo_SpeedRunRelaxRuns(p_map, u, v, ALGO_SPEEDRUN_H8_TURN(heading, 2u),
+                speedRunDist[state] + model.turn90Us, &model, (uint16_t)state);
+            algo_SpeedRunRelaxRuns(p_map, u, v, ALGO_SPEEDRUN_H8_TURN(heading, 6u),
+                speedRunDist[state] + model.turn90Us, &model, (uint16_t)state);
+        }
+        else
+        {
+            /* straighten up through the gap, or swap diagonals */
+            algo_SpeedRunRelaxRuns(p_map, u, v, heading,
+                speedRunDist[state] + model.turn45Us, &model, (uint16_t)state);
+            algo_SpeedRunRelaxDiagonal(p_map, u, v, ALGO_SPEEDRUN_H8_TURN(heading, 1u),
+                speedRunDist[state] + model.turn90Us, (uint16_t)state);
+            algo_SpeedRunRelaxDiagonal(p_map, u, v, ALGO_SPEEDRUN_H8_TURN(heading, 7u),
+                speedRunDist[state] + model.turn90Us, (uint16_t)state);
+        }
+    }
+
+    return FALSE;
+}
+#endif
+
+/**
+* Estimated run time of a route under a motion model
+*
+* \param[in] p_model Motion model
+* \param[in] p_route Route to time
+* \retval Estimated run time in microseconds
+*/
+uint32_t algo_SpeedRunEstimateUs(const algo_speedrun_model_t* p_model,
+    const algo_speedrun_route_t* p_route)
+{
+    uint32_t timeUs = 0u;
+    unsigned int heading = p_route->startHeading;
+    unsigned int i = 0u;
+
+    for (i = 0u; i < p_route->legCount; i++)
+    {
+        timeUs += algo_SpeedRunTurnUs(p_model, heading, p_route->legs[i].heading);
+        timeUs += algo_SpeedRunStraightUs(p_model, p_route->legs[i].cells);
+        heading = p_route->legs[i].heading;
+    }
+
+    return timeUs;
+}
+
+/**
+* Time to drive a straight from rest to rest w/ the acceleration limit
+*
+* \param[in] p_model Motion model
+* \param[in] cells   Length of the straight in cells
+* \retval Time in microseconds
+*/
+uint32_t algo_SpeedRunStraightUs(const algo_speedrun_model_t* p_model,
+    unsigned int cells)
+{
+    return algo_SpeedRunRunUs(p_model, ALGO_PRIM_STRAIGHT, 2u * cells);
+}
+
+/**
+* Time to turn in place between two headings
+*
+* \param[in] p_model     Motion model
+* \param[in] fromHeading Heading before the turn
+* \param[in] toHeading   Heading after the turn
+* \retval Time in microseconds
+*/
+uint32_t algo_SpeedRunTurnUs(const algo_speedrun_model_t* p_model,
+    unsigned int fromHeading, unsigned int toHeading)
+{
+    if (fromHeading == toHeading)
+        return 0u;
+
+    /* NORTH/SOUTH and EAST/WEST only differ in the lowest bit */
+    if ((fromHeading ^ 1u) == toHeading)
+        return algo_SpeedRunTurnTimeUs(p_model, ALGO_PRIM_TURN_180);
+
+    return algo_SpeedRunTurnTimeUs(p_model, ALGO_PRIM_TURN_LEFT_90);
+}
+
+/**
+* Time a motion primitive takes
+*
+* \param[in] p_model Motion model
+* \param[in] p_prim  Primitive to time
+* \retval Time in microseconds
+*/
+uint32_t algo_SpeedRunPrimUs(const algo_speedrun_model_t* p_model,
+    const algo_prim_t* p_prim)
+{
+    switch (p_prim->type)
+    {
+        case ALGO_PRIM_STRAIGHT:
+        case ALGO_PRIM_DIAGONAL:
+            return algo_SpeedRunRunUs(p_model, p_prim->type, p_prim->count);
+        case ALGO_PRIM_TURN_LEFT_45:
+        case ALGO_PRIM_TURN_RIGHT_45:
+        case ALGO_PRIM_TURN_LEFT_90:
+        case ALGO_PRIM_TURN_RIGHT_90:
+        case ALGO_PRIM_TURN_180:
+            return algo_SpeedRunTurnTimeUs(p_model, p_prim->type);
+        case ALGO_PRIM_UTURN_LEFT:
+        case ALGO_PRIM_UTURN_RIGHT:
+        case ALGO_PRIM_JOG_LEFT:
+        case ALGO_PRIM_JOG_RIGHT:
+            return (2u * algo_SpeedRunTurnTimeUs(p_model, ALGO_PRIM_TURN_LEFT_90))
+                + algo_SpeedRunRunUs(p_model, ALGO_PRIM_STRAIGHT, p_prim->count);
+    }
+
+    return 0u;
+}
+
+/**
+* Compile the legs of a route into primitives
+*
+* \param[in]  p_model Motion model for the estimated time
+* \param[in]  p_route Route to compile
+* \param[out] p_prims Primitives of the route and their estimated time
+* \retval FALSE if the route does not fit the list
+*/
+bool algo_SpeedRunCompileRoute(const algo_speedrun_model_t* p_model,
+    const algo_speedrun_route_t* p_route, algo_prim_list_t* p_prims)
+{
+    unsigned int heading = p_route->startHeading;
+    unsigned int i = 0u;
+
+    algo_PrimListClear(p_prims);
+
+    for (i = 0u; i < p_route->legCount; i++)
+    {
+        if (!algo_PrimAppendLeg(p_prims, heading, p_route->legs[i].heading,
+            p_route->legs[i].cells))
+            return FALSE;
+        heading = p_route->legs[i].heading;
+    }
+
+    algo_PrimCombineTurns(p_prims);
+    p_prims->estimatedTimeUs = algo_SpeedRunEstimatePrimsUs(p_model, p_prims);
+
+    return TRUE;
+}
+
+/**
+* Estimated run time of a primitive list under a motion model
+*
+* \param[in] p_model Motion model
+* \param[in] p_prims Primitives to time
+* \retval Estimated run time in microseconds
+*/
+uint32_t algo_SpeedRunEstimatePrimsUs(const algo_speedrun_model_t* p_model,
+    const algo_prim_list_t* p_prims)
+{
+    uint32_t timeUs = 0u;
+    unsigned int i = 0u;
+
+    for (i = 0u; i < p_prims->count; i++)
+        timeUs += algo_SpeedRunPrimUs(p_model, &p_prims->prims[i]);
+
+    return timeUs;
+}
+
+/*----------------------------------------------------------------------------*/
+/*                           Local Shared Functions                           */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                         Private (Static) Functions                         */
+/*----------------------------------------------------------------------------*/
+/**
+* Mark every state unreached and empty the heap
+*
+* \param None
+* \retval None
+*/
+static void algo_SpeedRunResetSearch(void)
+{
+    unsigned int state = 0u;
+
+    for (state = 0u; state < ALGO_SPEEDRUN_STATE_COUNT; state++)
+    {
+        speedRunDist[state] = ALGO_SPEEDRUN_UNREACHED;
+        speedRunHeapPos[state] = ALGO_SPEEDRUN_NOT_QUEUED;
+    }
+    speedRunHeapCount = 0u;
+}
+
+/**
+* Time to drive a distance from rest to rest w/ the acceleration limit
+*
+* Accelerates to top speed and brakes back down, or brakes half way when the
+* drive is too short to reach top speed.
+*
+* \param[in] p_model    Motion model
+* \param[in] distanceMm Length of the drive
+* \retval Time in microseconds
+*/
+static uint32_t algo_SpeedRunDriveUs(const algo_speedrun_model_t* p_model,
+    float distanceMm)
+{
+    float speed = (float)p_model->maxSpeedMmPerS;
+    float accel = (float)p_model->accelMmPerS2;
+    float seconds = 0.0f;
+
+    /* speeding up and braking both take speed^2 / (2 * accel) */
+    if (distanceMm >= ((speed * speed) / accel))
+        seconds = (distanceMm / speed) + (speed / accel);
+    else
+        seconds = 2.0f * sqrtf(distanceMm / accel);
+
+    return (uint32_t)(seconds * 1000000.0f);
+}
+
+/**
+* Time of a straight or diagonal primitive, learned or from the model
+*
+* A length not learned yet takes the model time scaled by how far the
+* model was off at the nearest learned length of the same kind, so the
+* search does not favour lengths just because the model gets them wrong.
+*
+* \param[in] p_model Motion model
+* \param[in] type    ALGO_PRIM_STRAIGHT or ALGO_PRIM_DIAGONAL
+* \param[in] count   Half squares or half steps
+* \retval Time in microseconds
+*/
+static uint32_t algo_SpeedRunRunUs(const algo_speedrun_model_t* p_model,
+    unsigned int type, unsigned int count)
+{
+    uint32_t learnedUs = 0u;
+    unsigned int near = 0u;
+    unsigned int d = 0u;
+
+    if (algo_CostModelGetUs(p_model->p_costs, type, count, &learnedUs))
+        return learnedUs;
+
+    if ((p_model->p_costs != NULL) && (count > 0u))
+    {
+        for (d = 1u; d < ALGO_COSTMODEL_MAX_COUNT; d++)
+        {
+            near = count + d;
+            if (algo_CostModelGetUs(p_model->p_costs, type, near, &learnedUs))
+                break;
+            near = count - d;
+            if ((count > d)
+                && algo_CostModelGetUs(p_model->p_costs, type, near, &learnedUs))
+                break;
+        }
+        if (d < ALGO_COSTMODEL_MAX_COUNT)
+            return (uint32_t)((float)algo_SpeedRunModelRunUs(p_model, type, count)
+                * (float)learnedUs
+                / (float)algo_SpeedRunModelRunUs(p_model, type, near));
+    }
+
+    return algo_SpeedRunModelRunUs(p_model, type, count);
+}
+
+/**
+* Time of a straight or diagonal primitive under the motion model alone
+*
+* \param[in] p_model Motion model
+* \param[in] type    ALGO_PRIM_STRAIGHT or ALGO_PRIM_DIAGONAL
+* \param[in] count   Half squares or half steps
+* \retval Time in microseconds
+*/
+static uint32_t algo_SpeedRunModelRunUs(const algo_speedrun_model_t* p_model,
+    unsigned int type, unsigned int count)
+{
+    if (type == ALGO_PRIM_DIAGONAL)
+        return algo_SpeedRunDriveUs(p_model, (float)count
+            * (float)p_model->cellMm * ALGO_SPEEDRUN_HALF_STEP_PER_CELL);
+
+    return algo_SpeedRunDriveUs(p_model,
+        (float)count * (float)p_model->cellMm * 0.5f);
+}
+
+/**
+* Time of a turn in place, learned or from the model
+*
+* \param[in] p_model Motion model
+* \param[in] type    ALGO_PRIM_TURN_*, left and right cost the same
+* \retval Time in microseconds
+*/
+static uint32_t algo_SpeedRunTurnTimeUs(const algo_speedrun_model_t* p_model,
+    unsigned int type)
+{
+    uint32_t timeUs = 0u;
+
+    if (algo_CostModelGetUs(p_model->p_costs, type, 0u, &timeUs))
+        return timeUs;
+
+    switch (type)
+    {
+        case ALGO_PRIM_TURN_LEFT_45:
+        case ALGO_PRIM_TURN_RIGHT_45:
+            return p_model->turn45Us;
+        case ALGO_PRIM_TURN_180:
+            return p_model->turn180Us;
+    }
+
+    return p_model->turn90Us;
+}
+
+/**
+* Copy of a motion model w/ the learned turn times in place of its own, so
+* the search loops read them straight from the model
+*
+* \param[in]  p_model    Motion model
+* \param[out] p_resolved Copy w/ the turns resolved
+* \retval None
+*/
+static void algo_SpeedRunResolveTurns(const algo_speedrun_model_t* p_model,
+    algo_speedrun_model_t* p_resolved)
+{
+    *p_resolved = *p_model;
+    p_resolved->turn45Us = algo_SpeedRunTurnTimeUs(p_model,
+        ALGO_PRIM_TURN_LEFT_45);
+    p_resolved->turn90Us = algo_SpeedRunTurnTimeUs(p_model,
+        ALGO_PRIM_TURN_LEFT_90);
+    p_resolved->turn180Us = algo_SpeedRunTurnTimeUs(p_model,
+        ALGO_PRIM_TURN_180);
+}
+
+/**
+* Whether a wall has been seen and is open
+*
+* \param[in] p_map Maze map
+* \param[in] x     Cell column
+* \param[in] y     Cell row
+* \param[in] dir   Side of the cell (NORTH, SOUTH, EAST, WEST)
+* \retval TRUE if the mouse can drive through
+*/
+static bool algo_SpeedRunIsOpen(const algo_maze_map_t* p_map, unsigned int x,
+    unsigned int y, unsigned int dir)
+{
+    return algo_MazeMapIsWallKnown(p_map, x, y, dir)
+        && !algo_MazeMapHasWall(p_map, x, y, dir);
+}
+
+/**
+* Offer every straight leg from a cell in one heading to the search
+*
+* \param[in] p_map     Maze map
+* \param[in] x         Column the leg starts in
+* \param[in] y         Row the leg starts in
+* \param[in] dir       Heading of the leg
+* \param[in] baseUs    Time to the start of the leg, incl. the turn into it
+* \param[in] fromState State the leg starts from
+* \retval None
+*/
+static void algo_SpeedRunRelaxLegs(const algo_maze_map_t* p_map,
+    unsigned int x, unsigned int y, unsigned int dir, uint32_t baseUs,
+    uint16_t fromState)
+{
+    unsigned int cells = 0u;
+
+    while (algo_SpeedRunIsOpen(p_map, x, y, dir))
+    {
+        if (dir == NORTH)
+            y++;
+        else if (dir == SOUTH)
+            y--;
+        else if (dir == EAST)
+            x++;
+        else
+            x--;
+        cells++;
+
+        algo_SpeedRunRelax(
+            (uint16_t)ALGO_SPEEDRUN_STATE(ALGO_MAZE_IDX(x, y), ALGO_SPEEDRUN_AXIS(dir)),
+            baseUs + speedRunStraightUs[cells], fromState);
+    }
+}
+
+/**
+* Lower the time of a state if this way there is faster
+*
+* \param[in] state     State reached
+* \param[in] timeUs    Time to the state this way
+* \param[in] fromState State it was reached from
+* \retval None
+*/
+static void algo_SpeedRunRelax(uint16_t state, uint32_t timeUs,
+    uint16_t fromState)
+{
+    if ((speedRunHeapPos[state] == ALGO_SPEEDRUN_SETTLED)
+        || (timeUs >= speedRunDist[state]))
+        return;
+
+    speedRunDist[state] = timeUs;
+    speedRunPrev[state] = fromState;
+
+    if (speedRunHeapPos[state] == ALGO_SPEEDRUN_NOT_QUEUED)
+    {
+        speedRunHeap[speedRunHeapCount] = state;
+        speedRunHeapPos[state] = speedRunHeapCount;
+        speedRunHeapCount++;
+    }
+    algo_SpeedRunHeapUp(speedRunHeapPos[state]);
+}
+
+/**
+* Take the fastest state off the heap and mark it settled
+*
+* \param None
+* \retval State
+*/
+static uint16_t algo_SpeedRunHeapPop(void)
+{
+    uint16_t state = speedRunHeap[0];
+
+    speedRunHeapCount--;
+    if (speedRunHeapCount > 0u)
+    {
+        algo_SpeedRunHeapSwap(0u, speedRunHeapCount);
+        algo_SpeedRunHeapDown(0u);
+    }
+    speedRunHeapPos[state] = ALGO_SPEEDRUN_SETTLED;
+
+    return state;
+}
+
+/**
+* Move a heap entry up until its parent is faster
+*
+* \param[in] pos Heap position of the entry
+* \retval None
+*/
+static void algo_SpeedRunHeapUp(uint16_t pos)
+{
+    uint16_t parent = 0u;
+
+    while (pos > 0u)
+    {
+        parent = (uint16_t)((pos - 1u) >> 1);
+        if (speedRunDist[speedRunHeap[parent]] <= speedRunDist[speedRunHeap[pos]])
+            break;
+        algo_SpeedRunHeapSwap(parent, pos);
+        pos = parent;
+    }
+}
+
+/**
+* Move a heap entry down until both children are slower
+*
+* \param[in] pos Heap position of the entry
+* \retval None
+*/
+static void algo_SpeedRunHeapDown(uint16_t pos)
+{
+    uint16_t child = 0u;
+
+    while (((pos << 1) + 1u) < speedRunHeapCount)
+    {
+        child = (uint16_t)((pos << 1) + 1u);
+        if (((child + 1u) < speedRunHeapCount)
+            && (speedRunDist[speedRunHeap[child + 1u]] < speedRunDist[speedRunHeap[child]]))
+            child++;
+        if (speedRunDist[speedRunHeap[pos]] <= speedRunDist[speedRunHeap[child]])
+            break;
+        algo_SpeedRunHeapSwap(pos, child);
+        pos = child;
+    }
+}
+
+/**
+* Swap two heap entries and keep their positions up to date
+*
+* \param[in] a Heap position
+* \param[in] b Heap position
+* \retval None
+*/
+static void algo_SpeedRunHeapSwap(uint16_t a, uint16_t b)
+{
+    uint16_t state = speedRunHeap[a];
+
+    speedRunHeap[a] = speedRunHeap[b];
+    speedRunHeap[b] = state;
+    speedRunHeapPos[speedRunHeap[a]] = a;
+    speedRunHeapPos[speedRunHeap[b]] = b;
+}
+
+/**
+* Walk the search back from the goal and write the legs out in order
+*
+* \param[in]  goalState State the search reached the goal in
+* \param[out] p_route   Route to fill in
+* \retval None
+*/
+static void algo_SpeedRunBuildRoute(uint16_t goalState,
+    algo_speedrun_route_t* p_route)
+{
+    uint16_t state = goalState;
+    unsigned int legCount = 0u;
+    unsigned int fromX = 0u;
+    unsigned int fromY = 0u;
+    unsigned int toX = 0u;
+    unsigned int toY = 0u;
+    algo_speedrun_leg_t* p_leg = NULL;
+
+    for (state = goalState; state != ALGO_SPEEDRUN_FROM_START;
+        state = speedRunPrev[state])
+        legCount++;
+
+    p_route->legCount = (uint16_t)legCount;
+    for (state = goalState; state != ALGO_SPEEDRUN_FROM_START;
+        state = speedRunPrev[state])
+    {
+        toX = ALGO_MAZE_IDX_X(ALGO_SPEEDRUN_STATE_IDX(state));
+        toY = ALGO_MAZE_IDX_Y(ALGO_SPEEDRUN_STATE_IDX(state));
+        if (speedRunPrev[state] == ALGO_SPEEDRUN_FROM_START)
+        {
+            fromX = ALGO_MAZE_START_X;
+            fromY = ALGO_MAZE_START_Y;
+        }
+        else
+        {
+            fromX = ALGO_MAZE_IDX_X(ALGO_SPEEDRUN_STATE_IDX(speedRunPrev[state]));
+            fromY = ALGO_MAZE_IDX_Y(ALGO_SPEEDRUN_STATE_IDX(speedRunPrev[state]));
+        }
+
+        p_leg = &p_route->legs[--legCount];
+        if (toY > fromY)
+        {
+            p_leg->heading = NORTH;
+            p_leg->cells = (uint8_t)(toY - fromY);
+        }
+        else if (toY < fromY)
+        {
+            p_leg->heading = SOUTH;
+            p_leg->cells = (uint8_t)(fromY - toY);
+        }
+        else if (toX > fromX)
+        {
+            p_leg->heading = EAST;
+            p_leg->cells = (uint8_t)(toX - fromX);
+        }
+        else
+        {
+            p_leg->heading = WEST;
+            p_leg->cells = (uint8_t)(fromX - toX);
+        }
+    }
+}
+
+#if ALGO_SPEEDRUN_DIAGONAL_ENABLE
+/**
+* Whether the mouse can drive onto a half square point
+*
+* Cell centres always can, wall gaps when the wall is known to be open, the
+* posts and the outer walls never.
+*
+* \param[in] p_map Maze map
+* \param[in] u     Half square column
+* \param[in] v     Half square row
+* \retval TRUE if the point can be driven onto
+*/
+static bool algo_SpeedRunIsPassable(const algo_maze_map_t* p_map, int u, int v)
+{
+    if ((u <= 0) || (v <= 0) || (u >= (int)(2u * ALGO_MAZE_WIDTH))
+        || (v >= (int)(2u * ALGO_MAZE_HEIGHT)))
+        return FALSE;
+
+    if ((u & 1) && (v & 1))
+        return TRUE;
+    if (u & 1)
+        return algo_SpeedRunIsOpen(p_map, (unsigned int)(u >> 1),
+            (unsigned int)((v >> 1) - 1), NORTH);
+    if (v & 1)
+        return algo_SpeedRunIsOpen(p_map, (unsigned int)((u >> 1) - 1),
+            (unsigned int)(v >> 1), EAST);
+
+    return FALSE;
+}
+
+/**
+* Search state of arriving at a cell centre or wall gap in a heading
+*
+* \param[in] u       Half square column
+* \param[in] v       Half square row
+* \param[in] heading Heading the point is driven onto in
+* \retval State
+*/
+static uint16_t algo_SpeedRunPointState(int u, int v, unsigned int heading)
+{
+    unsigned int x = (unsigned int)(u >> 1);
+    unsigned int y = (unsigned int)(v >> 1);
+
+    if ((u & 1) && (v & 1))
+        return (uint16_t)ALGO_SPEEDRUN_STATE(ALGO_MAZE_IDX(x, y),
+            (speedRunStepU[heading] != 0));
+    if (u & 1)
+        return (uint16_t)(ALGO_SPEEDRUN_H_GAP_BASE
+            + ALGO_SPEEDRUN_STATE(ALGO_MAZE_IDX(x, y - 1u), (speedRunStepV[heading] < 0)));
+
+    return (uint16_t)(ALGO_SPEEDRUN_V_GAP_BASE
+        + ALGO_SPEEDRUN_STATE(ALGO_MAZE_IDX(x - 1u, y), (speedRunStepU[heading] < 0)));
+}
+
+/**
+* Cell centre or wall gap of a search state and the heading through it
+*
+* Cell states only keep the axis, they give back north or east.
+*
+* \param[in]  state State
+* \param[out] p_u   Half square column
+* \param[out] p_v   Half square row
+* \retval Heading of the state
+*/
+static unsigned int algo_SpeedRunStatePoint(uint16_t state, int* p_u, int* p_v)
+{
+    unsigned int idx = 0u;
+    unsigned int way = state & 1u;
+
+    if (state < ALGO_SPEEDRUN_H_GAP_BASE)
+    {
+        idx = ALGO_SPEEDRUN_STATE_IDX(state);
+        *p_u = (int)(2u * ALGO_MAZE_IDX_X(idx)) + 1;
+        *p_v = (int)(2u * ALGO_MAZE_IDX_Y(idx)) + 1;
+        return way ? ALGO_SPEEDRUN_H8_EAST : ALGO_SPEEDRUN_H8_NORTH;
+    }
+
+    if (state < ALGO_SPEEDRUN_V_GAP_BASE)
+    {
+        idx = ALGO_SPEEDRUN_STATE_IDX(state - ALGO_SPEEDRUN_H_GAP_BASE);
+        *p_u = (int)(2u * ALGO_MAZE_IDX_X(idx)) + 1;
+        *p_v = (int)(2u * ALGO_MAZE_IDX_Y(idx)) + 2;
+        return way ? ALGO_SPEEDRUN_H8_SOUTH : ALGO_SPEEDRUN_H8_NORTH;
+    }
+
+    idx = ALGO_SPEEDRUN_STATE_IDX(state - ALGO_SPEEDRUN_V_GAP_BASE);
+    *p_u = (int)(2u * ALGO_MAZE_IDX_X(idx)) + 2;
+    *p_v = (int)(2u * ALGO_MAZE_IDX_Y(idx)) + 1;
+    return way ? ALGO_SPEEDRUN_H8_WEST : ALGO_SPEEDRUN_H8_EAST;
+}
+
+/**
+* Offer every straight from a point in one heading to the search, and every
+* diagonal that turns off it in a wall gap
+*
+* \param[in] p_map     Maze map
+* \param[in] u         Half square column the straight starts on
+* \param[in] v         Half square row the straight starts on
+* \param[in] heading   Heading of the straight, north, east, south or west
+* \param[in] baseUs    Time to the start of the straight, incl. the turn into it
+* \param[in] p_model   Motion model for the turn onto a diagonal
+* \param[in] fromState State the straight starts from
+* \retval None
+*/
+static void algo_SpeedRunRelaxRuns(const algo_maze_map_t* p_map, int u, int v,
+    unsigned int heading, uint32_t baseUs, const algo_speedrun_model_t* p_model,
+    uint16_t fromState)
+{
+    unsigned int steps = 0u;
+
+    while (algo_SpeedRunIsPassable(p_map, u + speedRunStepU[heading],
+        v + speedRunStepV[heading]))
+    {
+        u += speedRunStepU[heading];
+        v += speedRunStepV[heading];
+        steps++;
+
+        if ((u & 1) && (v & 1))
+            algo_SpeedRunRelax(algo_SpeedRunPointState(u, v, heading),
+                baseUs + speedRunHalfUs[steps], fromState);
+        else
+        {
+            algo_SpeedRunRelaxDiagonal(p_map, u, v, ALGO_SPEEDRUN_H8_TURN(heading, 1u),
+                baseUs + speedRunHalfUs[steps] + p_model->turn45Us, fromState);
+            algo_SpeedRunRelaxDiagonal(p_map, u, v, ALGO_SPEEDRUN_H8_TURN(heading, 7u),
+                baseUs + speedRunHalfUs[steps] + p_model->turn45Us, fromState);
+        }
+    }
+}
+
+/**
+* Offer every diagonal from a wall gap in one heading to the search
+*
+* \param[in] p_map     Maze map
+* \param[in] u         Half square column of the gap
+* \param[in] v         Half square row of the gap
+* \param[in] heading   Diagonal heading
+* \param[in] baseUs    Time to the start of the diagonal, incl. the turn into it
+* \param[in] fromState State the diagonal starts from
+* \retval None
+*/
+static void algo_SpeedRunRelaxDiagonal(const algo_maze_map_t* p_map, int u,
+    int v, unsigned int heading, uint32_t baseUs, uint16_t fromState)
+{
+    unsigned int steps = 0u;
+
+    /* a half step from a gap always lands on a gap of the other kind */
+    while (algo_SpeedRunIsPassable(p_map, u + speedRunStepU[heading],
+        v + speedRunStepV[heading]))
+    {
+        u += speedRunStepU[heading];
+        v += speedRunStepV[heading];
+        steps++;
+
+        algo_SpeedRunRelax(algo_SpeedRunPointState(u, v, heading),
+            baseUs + speedRunDiagUs[steps], fromState);
+    }
+}
+
+/**
+* Split the run between two search states into a straight and a diagonal
+*
+* Runs are a straight, a diagonal, or a straight into a diagonal, so the
+* longer axis of the offset holds the straight.
+*
+* \param[in]  fromU      Half square column the run starts on
+* \param[in]  fromV      Half square row the run starts on
+* \param[in]  toU        Half square column the run ends on
+* \param[in]  toV        Half square row the run ends on
+* \param[out] p_headings Heading of each part
+* \param[out] p_steps    Half squares or half steps of each part
+* \retval Number of parts, 1 or 2
+*/
+static unsigned int algo_SpeedRunSplitRun(int fromU, int fromV, int toU,
+    int toV, unsigned int* p_headings, unsigned int* p_steps)
+{
+    int du = toU - fromU;
+    int dv = toV - fromV;
+    int adu = (du < 0) ? -du : du;
+    int adv = (dv < 0) ? -dv : dv;
+    unsigned int diagonal = 0u;
+    unsigned int parts = 0u;
+
+    if (adu != adv)
+    {
+        if (adv > adu)
+            p_headings[parts] = (dv > 0) ? ALGO_SPEEDRUN_H8_NORTH : ALGO_SPEEDRUN_H8_SOUTH;
+        else
+            p_headings[parts] = (du > 0) ? ALGO_SPEEDRUN_H8_EAST : ALGO_SPEEDRUN_H8_WEST;
+        p_steps[parts] = (unsigned int)((adv > adu) ? (adv - adu) : (adu - adv));
+        parts++;
+    }
+
+    if ((adu != 0) && (adv != 0))
+    {
+        if (dv > 0)
+            diagonal = (du > 0) ? 1u : 7u;
+        else
+            diagonal = (du > 0) ? 3u : 5u;
+        p_headings[parts] = diagonal;
+        p_steps[parts] = (unsigned int)((adu < adv) ? adu : adv);
+        parts++;
+    }
+
+    return parts;
+}
+
+/**
+* Walk the search back from the goal and write the primitives out in order
+*
+* The primitives are written from the back of the list and moved to the
+* front at the end.
+*
+* \param[in]  goalState State the search reached the goal in
+* \param[out] p_prims   Primitive list to fill in
+* \retval TRUE if the route fit the list
+*/
+static bool algo_SpeedRunBuildPrims(uint16_t goalState,
+    algo_prim_list_t* p_prims)
+{
+    uint16_t state = goalState;
+    uint16_t from = 0u;
+    uint16_t pos = ALGO_PRIM_LIST_MAX;
+    unsigned int headings[2];
+    unsigned int steps[2];
+    unsigned int parts = 0u;
+    unsigned int inHeading = 0u;
+    unsigned int i = 0u;
+    int fromU = 0;
+    int fromV = 0;
+    int toU = 0;
+    int toV = 0;
+    int beforeU = 0;
+    int beforeV = 0;
+
+    for (state = goalState; state != ALGO_SPEEDRUN_FROM_START;
+        state = speedRunPrev[state])
+    {
+        from = speedRunPrev[state];
+        algo_SpeedRunStatePoint(state, &toU, &toV);
+        if (from == ALGO_SPEEDRUN_FROM_START)
+        {
+            fromU = (int)(2u * ALGO_MAZE_START_X) + 1;
+            fromV = (int)(2u * ALGO_MAZE_START_Y) + 1;
+            inHeading = speedRunHeading8[ALGO_MAZE_START_HEADING];
+        }
+        else
+        {
+            /* the heading coming in is the end of the run before */
+            algo_SpeedRunStatePoint(from, &fromU, &fromV);
+            if (speedRunPrev[from] == ALGO_SPEEDRUN_FROM_START)
+            {
+                beforeU = (int)(2u * ALGO_MAZE_START_X) + 1;
+                beforeV = (int)(2u * ALGO_MAZE_START_Y) + 1;
+            }
+            else
+                algo_SpeedRunStatePoint(speedRunPrev[from], &beforeU, &beforeV);
+            parts = algo_SpeedRunSplitRun(beforeU, beforeV, fromU, fromV,
+                headings, steps);
+            inHeading = headings[parts - 1u];
+        }
+
+        /* parts go on back to front */
+        parts = algo_SpeedRunSplitRun(fromU, fromV, toU, toV, headings, steps);
+        for (i = parts; i > 0u; i--)
+        {
+            if (!algo_SpeedRunPushPrim(p_prims, &pos, (headings[i - 1u] & 1u)
+                ? ALGO_PRIM_DIAGONAL : ALGO_PRIM_STRAIGHT, steps[i - 1u]))
+                return FALSE;
+            if (!algo_SpeedRunPushTurn(p_prims, &pos,
+                (i > 1u) ? headings[i - 2u] : inHeading, headings[i - 1u]))
+                return FALSE;
+        }
+    }
+
+    p_prims->count = (uint16_t)(ALGO_PRIM_LIST_MAX - pos);
+    for (i = 0u; i < p_prims->count; i++)
+        p_prims->prims[i] = p_prims->prims[pos + i];
+
+    return TRUE;
+}
+
+/**
+* Put a primitive in front of the ones already written
+*
+* \param[in,out] p_prims Primitive list
+* \param[in,out] p_pos   First written slot
+* \param[in]     type    algo_prim_type_t
+* \param[in]     count   Half squares or half steps of a drive
+* \retval FALSE if the list is full
+*/
+static bool algo_SpeedRunPushPrim(algo_prim_list_t* p_prims, uint16_t* p_pos,
+    unsigned int type, unsigned int count)
+{
+    if (*p_pos == 0u)
+        return FALSE;
+
+    (*p_pos)--;
+    p_prims->prims[*p_pos].type = (uint8_t)type;
+    p_prims->prims[*p_pos].count = (uint8_t)count;
+
+    return TRUE;
+}
+
+/**
+* Put the turns between two headings in front of the ones already written
+*
+* \param[in,out] p_prims     Primitive list
+* \param[in,out] p_pos       First written slot
+* \param[in]     fromHeading Heading before the turn
+* \param[in]     toHeading   Heading after the turn
+* \retval FALSE if the list is full
+*/
+static bool algo_SpeedRunPushTurn(algo_prim_list_t* p_prims, uint16_t* p_pos,
+    unsigned int fromHeading, unsigned int toHeading)
+{
+    /* clockwise 45 degree steps, 4 is turning around */
+    switch (ALGO_SPEEDRUN_H8_TURN(toHeading, 8u - fromHeading))
+    {
+        case 1u:
+            return algo_SpeedRunPushPrim(p_prims, p_pos, ALGO_PRIM_TURN_RIGHT_45, 0u);
+        case 2u:
+            return algo_SpeedRunPushPrim(p_prims, p_pos, ALGO_PRIM_TURN_RIGHT_90, 0u);
+        case 3u:
+            return algo_SpeedRunPushPrim(p_prims, p_pos, ALGO_PRIM_TURN_RIGHT_45, 0u)
+                && algo_SpeedRunPushPrim(p_prims, p_pos, ALGO_PRIM_TURN_RIGHT_90, 0u);
+        case 4u:
+            return algo_SpeedRunPushPrim(p_prims, p_pos, ALGO_PRIM_TURN_180, 0u);
+        case 5u:
+            return algo_SpeedRunPushPrim(p_prims, p_pos, ALGO_PRIM_TURN_LEFT_45, 0u)
+                && algo_SpeedRunPushPrim(p_prims, p_pos, ALGO_PRIM_TURN_LEFT_90, 0u);
+        case 6u:
+            return algo_SpeedRunPushPrim(p_prims, p_pos, ALGO_PRIM_TURN_LEFT_90, 0u);
+        case 7u:
+            return algo_SpeedRunPushPrim(p_prims, p_pos, ALGO_PRIM_TURN_LEFT_45, 0u);
+    }
+
+    return TRUE;
+}
+#endif
@@ -0,0 +1,125 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : speedrun_algo.h
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : algo layer
+*
+* This is the header file for the speed run planner.
+*
+* The planner looks for the route w/ the lowest estimated run time instead of
+* the fewest cells. A route is a list of legs, each one a straight run of
+* cells in one heading w/ a turn in place before it.
+*
+* The diagonal planner also drives through the wall gaps, cutting staircases
+* into 45 degree diagonals from gap to gap, and hands back a list of motion
+* primitives instead of legs.
+*
+* The algo layer defines all mouse maze solving algorithms as the second most
+* highest layer to be called directly in main.
+*-----------------------------------------------------------------------------*/
+
+#ifndef SPEEDRUN_ALGO_H_
+#define SPEEDRUN_ALGO_H_
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdint.h>
+#include "micromouse_dimensions.h"
+#include "algo/algo.h"
+#include "algo/mazemap_algo.h"
+#include "algo/primitive_algo.h"
+#include "algo/costmodel_algo.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+/* 1 = build in the diagonal planner, it needs three times the search state */
+#ifndef ALGO_SPEEDRUN_DIAGONAL_ENABLE
+#define ALGO_SPEEDRUN_DIAGONAL_ENABLE   (1)
+#endif
+
+/* every leg turns, so a route never has more legs than the maze has cells */
+#define ALGO_SPEEDRUN_MAX_LEGS          (ALGO_MAZE_CELL_COUNT)
+
+/* longest straight possible in the maze */
+#define ALGO_SPEEDRUN_MAX_STRAIGHT \
+    ((ALGO_MAZE_WIDTH > ALGO_MAZE_HEIGHT) ? ALGO_MAZE_WIDTH : ALGO_MAZE_HEIGHT)
+
+/* two states per cell, one per axis the mouse came in on, and w/ diagonals
+   two per wall gap, north walls first and then east walls */
+#if ALGO_SPEEDRUN_DIAGONAL_ENABLE
+#define ALGO_SPEEDRUN_STATE_COUNT   (ALGO_MAZE_CELL_COUNT * 6u)
+#else
+#define ALGO_SPEEDRUN_STATE_COUNT   (ALGO_MAZE_CELL_COUNT * 2u)
+#endif
+
+/* default motion model- estimates, tune against timed runs */
+/* maze square = wall + pillar */
+#define ALGO_SPEEDRUN_CELL_MM \
+    (MCI_MAZE_WALL_LENGTH_MM + MCI_MAZE_PILLAR_WIDTH_MM)
+#define ALGO_SPEEDRUN_MAX_SPEED_MM_PER_S    (500u)
+#define ALGO_SPEEDRUN_ACCEL_MM_PER_S2       (1000u)
+/* in place turns incl. the settle time before the next straight */
+#define ALGO_SPEEDRUN_TURN_45_US            (200000u)
+#define ALGO_SPEEDRUN_TURN_90_US            (350000u)
+#define ALGO_SPEEDRUN_TURN_180_US           (700000u)
+
+typedef struct
+{
+    uint32_t cellMm;            /* length of a maze square */
+    uint32_t maxSpeedMmPerS;    /* top speed on straights */
+    uint32_t accelMmPerS2;      /* acceleration and braking on straights */
+    uint32_t turn45Us;          /* 45 degree turn in place */
+    uint32_t turn90Us;          /* 90 degree turn in place */
+    uint32_t turn180Us;         /* 180 degree turn in place */
+    /* learned times that take over from the above, NULL for none */
+    const algo_cost_table_t* p_costs;
+} algo_speedrun_model_t;
+
+typedef struct
+{
+    uint8_t heading;            /* NORTH, SOUTH, EAST, WEST */
+    uint8_t cells;              /* cells driven straight */
+} algo_speedrun_leg_t;
+
+typedef struct
+{
+    uint8_t startX;
+    uint8_t startY;
+    uint8_t startHeading;
+    uint16_t legCount;
+    algo_speedrun_leg_t legs[ALGO_SPEEDRUN_MAX_LEGS];
+    uint32_t estimatedTimeUs;   /* run time the model expects */
+} algo_speedrun_route_t;
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+void algo_SpeedRunGetDefaultModel(algo_speedrun_model_t* p_model);
+bool algo_SpeedRunPlan(const algo_maze_map_t* p_map,
+    const algo_speedrun_model_t* p_model, algo_speedrun_route_t* p_route);
+uint32_t algo_SpeedRunEstimateUs(const algo_speedrun_model_t* p_model,
+    const algo_speedrun_route_t* p_route);
+uint32_t algo_SpeedRunStraightUs(const algo_speedrun_model_t* p_model,
+    unsigned int cells);
+uint32_t algo_SpeedRunTurnUs(const algo_speedrun_model_t* p_model,
+    unsigned int fromHeading, unsigned int toHeading);
+uint32_t algo_SpeedRunPrimUs(const algo_speedrun_model_t* p_model,
+    const algo_prim_t* p_prim);
+bool algo_SpeedRunCompileRoute(const algo_speedrun_model_t* p_model,
+    const algo_speedrun_route_t* p_route, algo_prim_list_t* p_prims);
+uint32_t algo_SpeedRunEstimatePrimsUs(const algo_speedrun_model_t* p_model,
+    const algo_prim_list_t* p_prims);
+#if ALGO_SPEEDRUN_DIAGONAL_ENABLE
+bool algo_SpeedRunPlanDiagonal(const algo_maze_map_t* p_map,
+    const algo_speedrun_model_t* p_model, algo_prim_list_t* p_prims);
+#endif
+
+#endif /* SPEEDRUN_ALGO_H_ */
@@ -0,0 +1,112 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : strategy_algo.c
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : algo layer
+*
+* This is the source file for the exploration strategy interface.
+*
+* The algo layer defines all mouse maze solving algorithms as the second most
+* highest layer to be called directly in main.
+*-----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdint.h>
+#include "algo/algo.h"
+#include "algo/frontier_algo.h"
+#include "algo/wallfollower_algo.h"
+#include "algo/strategy_algo.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+static algo_strategy_id_t selectedStrategy = ALGO_STRATEGY_DEFAULT;
+
+/*----------------------------------------------------------------------------*/
+/*                    Private (Static) Function Prototype                     */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+/**
+* Pick the strategy traverseCell() explores w/, it takes over from the next
+* step on using the maze map as it is
+*
+* \param[in] id Strategy
+* \retval FALSE if there is no such strategy
+*/
+bool algo_StrategySelect(algo_strategy_id_t id)
+{
+    if (id >= ALGO_STRATEGY_COUNT)
+        return FALSE;
+
+    selectedStrategy = id;
+    return TRUE;
+}
+
+/**
+* Strategy traverseCell() explores w/
+*
+* \param None
+* \retval Strategy
+*/
+algo_strategy_id_t algo_StrategyGetSelectedId(void)
+{
+    return selectedStrategy;
+}
+
+/**
+* Handler of the strategy traverseCell() explores w/
+*
+* \param None
+* \retval Strategy handler
+*/
+const algo_strategy_t* algo_StrategyGetSelected(void)
+{
+    return algo_StrategyGet(selectedStrategy);
+}
+
+/**
+* Handler of a strategy
+*
+* \param[in] id Strategy
+* \retval Strategy handler, NULL if there is no such strategy
+*/
+const algo_strategy_t* algo_StrategyGet(algo_strategy_id_t id)
+{
+    switch (id)
+    {
+        case ALGO_STRATEGY_FLOOD_FILL:
+            return getFloodFillStrategy();
+        case ALGO_STRATEGY_FRONTIER:
+            return algo_FrontierGetStrategy();
+        case ALGO_STRATEGY_LEFT_WALL:
+            return algo_WallFollowerGetStrategy(TRUE);
+        case ALGO_STRATEGY_RIGHT_WALL:
+            return algo_WallFollowerGetStrategy(FALSE);
+        default:
+            break;
+    }
+
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+/*                           Local Shared Functions                           */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                         Private (Static) Functions                         */
+/*----------------------------------------------------------------------------*/
+/* None */
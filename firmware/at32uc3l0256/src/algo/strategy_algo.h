@@ -0,0 +1,94 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : strategy_algo.h
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : algo layer
+*
+* This is the header file for the exploration strategy interface.
+*
+* traverseCell() in algo.c drives the mouse and keeps the maze map; which
+* cells it visits and when it stops is up to the strategy selected here.
+* Each step it:
+*
+*   - reads the walls of the cell the mouse is in the first time there,
+*     records them in the maze map and tells the strategy
+*   - asks the strategy where to drive next, one cell or a whole route of
+*     cell moves
+*   - stops once the strategy says exploring is done, or has no move left
+*
+* A strategy only plans, it never drives or reads the sensors, so new ones
+* plug in w/ one handler and an entry in algo_strategy_id_t.
+*
+* The algo layer defines all mouse maze solving algorithms as the second most
+* highest layer to be called directly in main.
+*-----------------------------------------------------------------------------*/
+
+#ifndef STRATEGY_ALGO_H_
+#define STRATEGY_ALGO_H_
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdint.h>
+#include "algo/algo.h"
+#include "algo/mazemap_algo.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+/* strategy traverseCell() uses until another one is selected */
+#ifndef ALGO_STRATEGY_DEFAULT
+#define ALGO_STRATEGY_DEFAULT       ALGO_STRATEGY_FLOOD_FILL
+#endif
+
+/* a route never drives through a cell twice */
+#define ALGO_STRATEGY_MAX_MOVES     (ALGO_MAZE_CELL_COUNT)
+
+/* exploration strategy enumeration */
+typedef enum
+{
+    ALGO_STRATEGY_FLOOD_FILL = 0u,  /* towards the goal, see algo.c */
+    ALGO_STRATEGY_FRONTIER,         /* every reachable cell, nearest first */
+    ALGO_STRATEGY_LEFT_WALL,        /* keep a hand on the left wall */
+    ALGO_STRATEGY_RIGHT_WALL,       /* keep a hand on the right wall */
+    ALGO_STRATEGY_COUNT
+} algo_strategy_id_t;
+
+/* exploration strategy contract- used to create strategies */
+typedef struct
+{
+    const char* p_name;
+    /* start exploring the map as it is, blank or restored from flash, w/
+       the mouse at the start */
+    void (*algo_StrategyInit)(const algo_maze_map_t* p_map);
+    /* walls around cell (x, y) were just recorded; inferred is TRUE if
+       walls elsewhere were worked out from them as well */
+    void (*algo_StrategyWallUpdate)(const algo_maze_map_t* p_map,
+        unsigned int x, unsigned int y, bool inferred);
+    /* cell moves to drive next from the mouse pose, as NORTH, SOUTH, EAST
+       or WEST; FALSE if there is nowhere left to go */
+    bool (*algo_StrategyChooseMoves)(const algo_maze_map_t* p_map,
+        unsigned int x, unsigned int y, unsigned int heading,
+        uint8_t* p_moves, unsigned int* p_moveCount);
+    /* TRUE once exploring is over w/ the mouse at this pose */
+    bool (*algo_StrategyIsDone)(const algo_maze_map_t* p_map,
+        unsigned int x, unsigned int y, unsigned int heading);
+} algo_strategy_t;
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+bool algo_StrategySelect(algo_strategy_id_t id);
+algo_strategy_id_t algo_StrategyGetSelectedId(void);
+const algo_strategy_t* algo_StrategyGetSelected(void);
+const algo_strategy_t* algo_StrategyGet(algo_strategy_id_t id);
+/* flood fill strategy, algo.c */
+const algo_strategy_t* getFloodFillStrategy(void);
+
+#endif /* STRATEGY_ALGO_H_ */
@@ -0,0 +1,265 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : wallbelief_algo.c
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : algo layer
+*
+* This is the source file for the wall belief map.
+*
+* Evidence is a signed byte per wall inside the maze, stored like the maze
+* map's wall bits: the north wall of a cell and the east wall of a cell.
+* Walls the map knows w/o any readings, from inference or a restored map,
+* start out at the commit threshold, so one stray reading cannot undo them.
+*
+* The algo layer defines all mouse maze solving algorithms as the second most
+* highest layer to be called directly in main.
+*-----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <string.h>
+#include "algo/algo.h"
+#include "algo/mazemap_algo.h"
+#include "algo/wallbelief_algo.h"
+#include "algo/arena_algo.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                               Debug Switches                               */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+/* evidence for the wall north and east of every cell, positive for a wall */
+static int8_t* const beliefNorth = algoArena.beliefNorth;
+static int8_t* const beliefEast = algoArena.beliefEast;
+
+static algo_wallbelief_config_t beliefConfig =
+{
+    .commit = ALGO_WALLBELIEF_COMMIT,
+    .maxReads = ALGO_WALLBELIEF_MAX_READS,
+    .limit = ALGO_WALLBELIEF_LIMIT,
+};
+
+/*----------------------------------------------------------------------------*/
+/*                    Private (Static) Function Prototype                     */
+/*----------------------------------------------------------------------------*/
+static int8_t* algo_WallBeliefGetSlot(unsigned int x, unsigned int y,
+    unsigned int dir);
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+/**
+* Default thresholds, tune against the sensor noise of the mouse
+*
+* \param[out] p_config Thresholds
+* \retval None
+*/
+void algo_WallBeliefGetDefaultConfig(algo_wallbelief_config_t* p_config)
+{
+    p_config->commit = ALGO_WALLBELIEF_COMMIT;
+    p_config->maxReads = ALGO_WALLBELIEF_MAX_READS;
+    p_config->limit = ALGO_WALLBELIEF_LIMIT;
+}
+
+/**
+* Change the thresholds, for walls read from now on
+*
+* A commit threshold, read limit and evidence limit of 1 takes every wall
+* from a single reading, as the mouse did before, and a later reading that
+* disagrees takes it back to unknown.
+*
+* \param[in] p_config Thresholds, out of range values are clamped
+* \retval None
+*/
+void algo_WallBeliefSetConfig(const algo_wallbelief_config_t* p_config)
+{
+    beliefConfig = *p_config;
+    if (beliefConfig.commit == 0u)
+        beliefConfig.commit = 1u;
+    if (beliefConfig.commit > INT8_MAX)
+        beliefConfig.commit = INT8_MAX;
+    if (beliefConfig.maxReads == 0u)
+        beliefConfig.maxReads = 1u;
+    if (beliefConfig.limit < beliefConfig.commit)
+        beliefConfig.limit = beliefConfig.commit;
+    if (beliefConfig.limit > INT8_MAX)
+        beliefConfig.limit = INT8_MAX;
+}
+
+/**
+* Thresholds in use
+*
+* \param None
+* \retval Thresholds
+*/
+const algo_wallbelief_config_t* algo_WallBeliefGetConfig(void)
+{
+    return &beliefConfig;
+}
+
+/**
+* Forget every reading, for a new maze or a map restored from flash
+*
+* \param None
+* \retval None
+*/
+void algo_WallBeliefClear(void)
+{
+    memset(beliefNorth, 0, sizeof(algoArena.beliefNorth));
+    memset(beliefEast, 0, sizeof(algoArena.beliefEast));
+}
+
+/**
+* Count one reading of a wall and bring the maze map in line w/ the evidence
+*
+* \param[in,out] p_map    Maze map
+* \param[in]     x        Cell column
+* \param[in]     y        Cell row
+* \param[in]     dir      Side of the cell (NORTH, SOUTH, EAST, WEST)
+* \param[in]     wallSeen TRUE if the reading saw a wall
+* \retval TRUE if the map changed: the wall was committed, taken back to a
+*         guess, or flipped
+*/
+bool algo_WallBeliefAdd(algo_maze_map_t* p_map, unsigned int x,
+    unsigned int y, unsigned int dir, bool wallSeen)
+{
+    int8_t* p_slot = algo_WallBeliefGetSlot(x, y, dir);
+    bool wasKnown = FALSE;
+    bool wasWall = FALSE;
+    int evidence = 0;
+
+    if (p_slot == NULL)
+        return FALSE;
+
+    wasKnown = algo_MazeMapIsWallKnown(p_map, x, y, dir);
+    wasWall = algo_MazeMapHasWall(p_map, x, y, dir);
+
+    evidence = *p_slot;
+    if (wasKnown && (evidence == 0))
+        evidence = wasWall ? beliefConfig.commit : -(int)beliefConfig.commit;
+
+    evidence += wallSeen ? 1 : -1;
+    if (evidence > (int)beliefConfig.limit)
+        evidence = beliefConfig.limit;
+    if (evidence < -(int)beliefConfig.limit)
+        evidence = -(int)beliefConfig.limit;
+    *p_slot = (int8_t)evidence;
+
+    algo_WallBeliefApply(p_map, x, y, dir);
+
+    return (algo_MazeMapIsWallKnown(p_map, x, y, dir) != wasKnown)
+        || (algo_MazeMapHasWall(p_map, x, y, dir) != wasWall);
+}
+
+/**
+* Record a wall there is no doubt about, e.g. the gap the mouse just drove
+* through
+*
+* \param[in,out] p_map   Maze map
+* \param[in]     x       Cell column
+* \param[in]     y       Cell row
+* \param[in]     dir     Side of the cell (NORTH, SOUTH, EAST, WEST)
+* \param[in]     present TRUE if there is a wall
+* \retval None
+*/
+void algo_WallBeliefSetCertain(algo_maze_map_t* p_map, unsigned int x,
+    unsigned int y, unsigned int dir, bool present)
+{
+    int8_t* p_slot = algo_WallBeliefGetSlot(x, y, dir);
+
+    if (p_slot != NULL)
+        *p_slot = (int8_t)(present ? (int)beliefConfig.limit : -(int)beliefConfig.limit);
+    algo_MazeMapSetWall(p_map, x, y, dir, present);
+}
+
+/**
+* Write the evidence of a wall into the maze map: known from the commit
+* threshold on, a guess below it, unknown and open w/o any evidence
+*
+* \param[in,out] p_map Maze map
+* \param[in]     x     Cell column
+* \param[in]     y     Cell row
+* \param[in]     dir   Side of the cell (NORTH, SOUTH, EAST, WEST)
+* \retval None
+*/
+void algo_WallBeliefApply(algo_maze_map_t* p_map, unsigned int x,
+    unsigned int y, unsigned int dir)
+{
+    int evidence = algo_WallBeliefGetEvidence(x, y, dir);
+    int commit = (int)beliefConfig.commit;
+
+    if ((evidence >= commit) || (evidence <= -commit))
+        algo_MazeMapSetWall(p_map, x, y, dir, evidence > 0);
+    else
+        algo_MazeMapGuessWall(p_map, x, y, dir, evidence > 0);
+}
+
+/**
+* Evidence for a wall
+*
+* \param[in] x   Cell column
+* \param[in] y   Cell row
+* \param[in] dir Side of the cell (NORTH, SOUTH, EAST, WEST)
+* \retval Readings that saw a wall less readings that did not, clamped to
+*         the limit, 0 for outer walls
+*/
+int algo_WallBeliefGetEvidence(unsigned int x, unsigned int y,
+    unsigned int dir)
+{
+    int8_t* p_slot = algo_WallBeliefGetSlot(x, y, dir);
+
+    return (p_slot != NULL) ? *p_slot : 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/*                           Local Shared Functions                           */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                         Private (Static) Functions                         */
+/*----------------------------------------------------------------------------*/
+/**
+* Evidence slot of a wall, shared by the cells on either side
+*
+* \param[in] x   Cell column
+* \param[in] y   Cell row
+* \param[in] dir Side of the cell (NORTH, SOUTH, EAST, WEST)
+* \retval Slot, NULL for the outer walls
+*/
+static int8_t* algo_WallBeliefGetSlot(unsigned int x, unsigned int y,
+    unsigned int dir)
+{
+    switch (dir)
+    {
+        case NORTH:
+            if (y + 1u >= ALGO_MAZE_HEIGHT)
+                return NULL;
+            return &beliefNorth[ALGO_MAZE_IDX(x, y)];
+        case SOUTH:
+            if (y == 0u)
+                return NULL;
+            return &beliefNorth[ALGO_MAZE_IDX(x, y - 1u)];
+        case EAST:
+            if (x + 1u >= ALGO_MAZE_WIDTH)
+                return NULL;
+            return &beliefEast[ALGO_MAZE_IDX(x, y)];
+        case WEST:
+            if (x == 0u)
+                return NULL;
+            return &beliefEast[ALGO_MAZE_IDX(x - 1u, y)];
+    }
+
+    return NULL;
+}
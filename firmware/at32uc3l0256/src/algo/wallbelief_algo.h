@@ -0,0 +1,80 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : wallbelief_algo.h
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : algo layer
+*
+* This is the header file for the wall belief map.
+*
+* One IR reading decides nothing on its own. Every wall keeps a signed
+* evidence count instead, one up for each reading that saw a wall and one
+* down for each that did not, and the maze map takes the wall as known only
+* once the count reaches the commit threshold either way. Below it the map
+* holds the wall as a guess, which only steers the order cells are explored
+* in. The optimistic flood, the dead end pruning and the proof take a
+* guessed wall as open, so a wrong guess can not hide a shorter route,
+* while the frontier routes and the speed run, which only drive through
+* walls known to be open, keep clear of it.
+*
+* The count stops at a limit, so readings that go against a committed wall
+* can still take it back to a guess or flip it.
+*
+* The algo layer defines all mouse maze solving algorithms as the second most
+* highest layer to be called directly in main.
+*-----------------------------------------------------------------------------*/
+
+#ifndef WALLBELIEF_ALGO_H_
+#define WALLBELIEF_ALGO_H_
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdint.h>
+#include "algo/algo.h"
+#include "algo/mazemap_algo.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+/* default thresholds- readings agreeing to commit a wall, most readings
+   taken of one wall standing in a cell, and where the count stops */
+#ifndef ALGO_WALLBELIEF_COMMIT
+#define ALGO_WALLBELIEF_COMMIT      (3)
+#endif
+#ifndef ALGO_WALLBELIEF_MAX_READS
+#define ALGO_WALLBELIEF_MAX_READS   (7)
+#endif
+#ifndef ALGO_WALLBELIEF_LIMIT
+#define ALGO_WALLBELIEF_LIMIT       (6)
+#endif
+
+typedef struct
+{
+    uint8_t commit;     /* evidence to take a wall as known, 1 or more */
+    uint8_t maxReads;   /* readings of a wall per stop in a cell */
+    uint8_t limit;      /* evidence stops here, commit or more */
+} algo_wallbelief_config_t;
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+void algo_WallBeliefGetDefaultConfig(algo_wallbelief_config_t* p_config);
+void algo_WallBeliefSetConfig(const algo_wallbelief_config_t* p_config);
+const algo_wallbelief_config_t* algo_WallBeliefGetConfig(void);
+void algo_WallBeliefClear(void);
+bool algo_WallBeliefAdd(algo_maze_map_t* p_map, unsigned int x,
+    unsigned int y, unsigned int dir, bool wallSeen);
+void algo_WallBeliefSetCertain(algo_maze_map_t* p_map, unsigned int x,
+    unsigned int y, unsigned int dir, bool present);
+void algo_WallBeliefApply(algo_maze_map_t* p_map, unsigned int x,
+    unsigned int y, unsigned int dir);
+int algo_WallBeliefGetEvidence(unsigned int x, unsigned int y,
+    unsigned int dir);
+
+#endif /* WALLBELIEF_ALGO_H_ */
@@ -14,6 +14,7 @@
 /*----------------------------------------------------------------------------*/
 /*                               Include Files                                */
 /*----------------------------------------------------------------------------*/
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 #include "micromouse_dimensions.h"
@@ -21,6 +22,9 @@
 #include "mouse_hardware_interface/clock_mhi.h"
 #include "mouse_control_interface/walldetection_mci.h"
 #include "mouse_control_interface/movement_mci.h"
+#include "algo/algo.h"
+#include "algo/mazemap_algo.h"
+#include "algo/strategy_algo.h"
 #include "algo/wallfollower_algo.h"
 
 /*----------------------------------------------------------------------------*/
@@ -37,12 +41,55 @@
 /*----------------------------------------------------------------------------*/
 /*                              Global Variables                              */
 /*----------------------------------------------------------------------------*/
-/* None */
+/* heading to the left, right and back of each heading, NORTH, SOUTH, EAST,
+   WEST order */
+static const uint8_t wallFollowerLeftOf[4] = { WEST, EAST, NORTH, SOUTH };
+static const uint8_t wallFollowerRightOf[4] = { EAST, WEST, SOUTH, NORTH };
+static const uint8_t wallFollowerBackOf[4] = { SOUTH, NORTH, WEST, EAST };
+
+/* cell moves made, and where the first one ended; a wall follower that
+   gets there facing the same way again goes round in circles */
+static unsigned int wallFollowerMoves = 0u;
+static unsigned int wallFollowerFirstX = 0u;
+static unsigned int wallFollowerFirstY = 0u;
+static unsigned int wallFollowerFirstHeading = 0u;
 
 /*----------------------------------------------------------------------------*/
 /*                    Private (Static) Function Prototype                     */
 /*----------------------------------------------------------------------------*/
-/* None */
+static void algo_WallFollowerInit(const algo_maze_map_t* p_map);
+static void algo_WallFollowerWallUpdate(const algo_maze_map_t* p_map,
+    unsigned int x, unsigned int y, bool inferred);
+static bool algo_WallFollowerChooseLeft(const algo_maze_map_t* p_map,
+    unsigned int x, unsigned int y, unsigned int heading,
+    uint8_t* p_moves, unsigned int* p_moveCount);
+static bool algo_WallFollowerChooseRight(const algo_maze_map_t* p_map,
+    unsigned int x, unsigned int y, unsigned int heading,
+    uint8_t* p_moves, unsigned int* p_moveCount);
+static bool algo_WallFollowerChoose(const algo_maze_map_t* p_map,
+    unsigned int x, unsigned int y, unsigned int heading,
+    const uint8_t* p_turnOrder, uint8_t* p_moves, unsigned int* p_moveCount);
+static bool algo_WallFollowerIsDone(const algo_maze_map_t* p_map,
+    unsigned int x, unsigned int y, unsigned int heading);
+
+/* exploration strategy handlers, here after the prototypes they point to */
+static const algo_strategy_t leftWallStrategy =
+{
+    .p_name = "left wall",
+    .algo_StrategyInit = algo_WallFollowerInit,
+    .algo_StrategyWallUpdate = algo_WallFollowerWallUpdate,
+    .algo_StrategyChooseMoves = algo_WallFollowerChooseLeft,
+    .algo_StrategyIsDone = algo_WallFollowerIsDone,
+};
+
+static const algo_strategy_t rightWallStrategy =
+{
+    .p_name = "right wall",
+    .algo_StrategyInit = algo_WallFollowerInit,
+    .algo_StrategyWallUpdate = algo_WallFollowerWallUpdate,
+    .algo_StrategyChooseMoves = algo_WallFollowerChooseRight,
+    .algo_StrategyIsDone = algo_WallFollowerIsDone,
+};
 
 /*----------------------------------------------------------------------------*/
 /*                       Public (Exportable) Functions                        */
@@ -61,13 +108,11 @@ void algo_LeftWallFollow()
     if (mci_CheckLeftWall() == MCI_WALL_NOT_FOUND)
     {
         mci_TurnLeft90DegreesPID();
-        mhi_DelayMs(100);
     }
     while (mci_CheckFrontWall() != MCI_WALL_NOT_FOUND)
     {
 		mci_AdjustToFrontWall();
         mci_TurnRight90DegreesPID();
-        mhi_DelayMs(100);
     }
 }
 
@@ -85,16 +130,25 @@ void algo_RightWallFollow()
     if (mci_CheckRightWall() == MCI_WALL_NOT_FOUND)
     {
         mci_TurnRight90DegreesPID();
-        mhi_DelayMs(100);
     }
     while (mci_CheckFrontWall() != MCI_WALL_NOT_FOUND)
     {
 		mci_AdjustToFrontWall();
         mci_TurnLeft90DegreesPID();
-        mhi_DelayMs(100);
     }
 }
 
+/**
+* Wall follower exploration strategy
+*
+* \param[in] leftHand TRUE to follow the left wall, FALSE the right
+* \retval Strategy handler
+*/
+const algo_strategy_t* algo_WallFollowerGetStrategy(bool leftHand)
+{
+    return leftHand ? &leftWallStrategy : &rightWallStrategy;
+}
+
 /*----------------------------------------------------------------------------*/
 /*                           Local Shared Functions                           */
 /*----------------------------------------------------------------------------*/
@@ -103,4 +157,135 @@ void algo_RightWallFollow()
 /*----------------------------------------------------------------------------*/
 /*                         Private (Static) Functions                         */
 /*----------------------------------------------------------------------------*/
-/* None */
\ No newline at end of file
+/**
+* Start following from the start cell
+*
+* \param[in] p_map Maze map, not needed
+* \retval None
+*/
+static void algo_WallFollowerInit(const algo_maze_map_t* p_map)
+{
+    (void)p_map;
+    wallFollowerMoves = 0u;
+}
+
+/**
+* Nothing to update, wall followers only look at the cell they are in
+*/
+static void algo_WallFollowerWallUpdate(const algo_maze_map_t* p_map,
+    unsigned int x, unsigned int y, bool inferred)
+{
+    (void)p_map;
+    (void)x;
+    (void)y;
+    (void)inferred;
+}
+
+/**
+* Left hand rule: left if open, else straight on, else right, else back
+*/
+static bool algo_WallFollowerChooseLeft(const algo_maze_map_t* p_map,
+    unsigned int x, unsigned int y, unsigned int heading,
+    uint8_t* p_moves, unsigned int* p_moveCount)
+{
+    const uint8_t turnOrder[4] =
+    {
+        wallFollowerLeftOf[heading], (uint8_t)heading,
+        wallFollowerRightOf[heading], wallFollowerBackOf[heading]
+    };
+
+    return algo_WallFollowerChoose(p_map, x, y, heading, turnOrder, p_moves,
+        p_moveCount);
+}
+
+/**
+* Right hand rule: right if open, else straight on, else left, else back
+*/
+static bool algo_WallFollowerChooseRight(const algo_maze_map_t* p_map,
+    unsigned int x, unsigned int y, unsigned int heading,
+    uint8_t* p_moves, unsigned int* p_moveCount)
+{
+    const uint8_t turnOrder[4] =
+    {
+        wallFollowerRightOf[heading], (uint8_t)heading,
+        wallFollowerLeftOf[heading], wallFollowerBackOf[heading]
+    };
+
+    return algo_WallFollowerChoose(p_map, x, y, heading, turnOrder, p_moves,
+        p_moveCount);
+}
+
+/**
+* Move to the first open side in turn order
+*
+* \param[in]  p_map       Maze map, the walls of the mouse's cell are known
+* \param[in]  x           Column of the mouse
+* \param[in]  y           Row of the mouse
+* \param[in]  heading     Heading of the mouse
+* \param[in]  p_turnOrder Headings to try, best first
+* \param[out] p_moves     The one cell move
+* \param[out] p_moveCount 1
+* \retval FALSE if the cell is walled in
+*/
+static bool algo_WallFollowerChoose(const algo_maze_map_t* p_map,
+    unsigned int x, unsigned int y, unsigned int heading,
+    const uint8_t* p_turnOrder, uint8_t* p_moves, unsigned int* p_moveCount)
+{
+    unsigned int i = 0u;
+
+    (void)heading;
+    *p_moveCount = 0u;
+    while ((i < 4u) && algo_MazeMapHasWall(p_map, x, y, p_turnOrder[i]))
+        i++;
+    if (i == 4u)
+        return FALSE;
+
+    p_moves[0] = p_turnOrder[i];
+    *p_moveCount = 1u;
+
+    if (wallFollowerMoves++ == 0u)
+    {
+        wallFollowerFirstX = x;
+        wallFollowerFirstY = y;
+        wallFollowerFirstHeading = p_moves[0];
+        switch (p_moves[0])
+        {
+            case NORTH:
+                wallFollowerFirstY++;
+                break;
+            case SOUTH:
+                wallFollowerFirstY--;
+                break;
+            case EAST:
+                wallFollowerFirstX++;
+                break;
+            default:
+                wallFollowerFirstX--;
+                break;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+* Done in the goal, or back where its first move took it facing the same
+* way, the wall it follows goes round w/o touching the goal
+*
+* \param[in] p_map   Maze map, not needed
+* \param[in] x       Column of the mouse
+* \param[in] y       Row of the mouse
+* \param[in] heading Heading of the mouse
+* \retval TRUE if there is no point going on
+*/
+static bool algo_WallFollowerIsDone(const algo_maze_map_t* p_map,
+    unsigned int x, unsigned int y, unsigned int heading)
+{
+    (void)p_map;
+
+    if (ALGO_MAZE_IS_GOAL(x, y))
+        return TRUE;
+
+    return (wallFollowerMoves > 1u) && (x == wallFollowerFirstX)
+        && (y == wallFollowerFirstY) && (heading == wallFollowerFirstHeading);
+}
\ No newline at end of file
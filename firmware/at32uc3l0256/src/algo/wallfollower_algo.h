@@ -7,6 +7,12 @@
 *
 * This is the header file for mouse wall follower algorithm.
 *
+* The wall followers are also exploration strategies for traverseCell(),
+* see strategy_algo.h. As strategies they plan from the maze map instead of
+* reading the sensors, and stop in the goal or once they are back in the
+* cell their first move took them to facing the same way, which means the
+* wall they follow does not lead to the goal.
+*
 * The algo layer defines all mouse maze solving algorithms as the second most
 * highest layer to be called directly in main.
 *-----------------------------------------------------------------------------*/
@@ -14,6 +20,12 @@
 #ifndef WALLFOLLOWER_ALGO_H_
 #define WALLFOLLOWER_ALGO_H_
 
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdbool.h>
+#include "algo/strategy_algo.h"
+
 /*----------------------------------------------------------------------------*/
 /*                                Definitions                                 */
 /*----------------------------------------------------------------------------*/
@@ -29,5 +41,6 @@
 /*----------------------------------------------------------------------------*/
 void algo_LeftWallFollow();
 void algo_RightWallFollow();
+const algo_strategy_t* algo_WallFollowerGetStrategy(bool leftHand);
 
 #endif /* WALLFOLLOWER_ALGO_H_ */
\ No newline at end of file
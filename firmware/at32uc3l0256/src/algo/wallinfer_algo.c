@@ -0,0 +1,342 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : wallinfer_algo.c
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : algo layer
+*
+* This is the source file for maze rule wall inference.
+*
+* New walls can only settle the posts at their two ends and the goal
+* outline, so inference starts at the four corner posts of the cell just
+* seen and keeps a stack of posts to check, pushing the end posts of every
+* wall it infers until nothing more follows.
+*
+* Posts are numbered by the cell to their south west: post (px, py) is the
+* north east corner of cell (px - 1, py - 1).
+*
+* The algo layer defines all mouse maze solving algorithms as the second most
+* highest layer to be called directly in main.
+*-----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdint.h>
+#include "algo/algo.h"
+#include "algo/mazemap_algo.h"
+#include "algo/wallinfer_algo.h"
+#include "algo/arena_algo.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+/* walls on the outline of the goal rectangle */
+#define ALGO_WALLINFER_GOAL_SIDES \
+    (2u * ((ALGO_MAZE_GOAL_X_MAX - ALGO_MAZE_GOAL_X_MIN + 1u) \
+    + (ALGO_MAZE_GOAL_Y_MAX - ALGO_MAZE_GOAL_Y_MIN + 1u)))
+
+/*----------------------------------------------------------------------------*/
+/*                               Debug Switches                               */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+/* posts waiting to be checked, a bit per post marks the ones on the stack */
+static uint16_t* const inferPostStack = algoArena.inferPostStack;
+static unsigned int inferPostTop = 0u;
+static algo_maze_row_t* const inferPostQueued = algoArena.inferPostQueued;
+
+/* walls inferred and cells completed by the last call */
+static unsigned int inferWallCount = 0u;
+static unsigned int inferCellsCompleted = 0u;
+
+/*----------------------------------------------------------------------------*/
+/*                    Private (Static) Function Prototype                     */
+/*----------------------------------------------------------------------------*/
+static void algo_WallInferQueuePost(unsigned int px, unsigned int py);
+static void algo_WallInferPost(algo_maze_map_t* p_map, unsigned int px,
+    unsigned int py);
+#if ALGO_WALLINFER_GOAL_ENABLE
+static void algo_WallInferGoal(algo_maze_map_t* p_map);
+static void algo_WallInferGoalSide(unsigned int side, unsigned int* p_x,
+    unsigned int* p_y, unsigned int* p_dir);
+#endif
+static void algo_WallInferSet(algo_maze_map_t* p_map, unsigned int x,
+    unsigned int y, unsigned int dir, bool present);
+static void algo_WallInferComplete(algo_maze_map_t* p_map, unsigned int x,
+    unsigned int y);
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+/**
+* Infer every wall the maze rules settle after a cell's walls were seen
+*
+* \param[in,out] p_map Walls discovered so far, inferred walls are added
+* \param[in]     x     Column of the cell that was just seen
+* \param[in]     y     Row of the cell that was just seen
+* \retval Number of walls inferred
+*/
+unsigned int algo_WallInferAround(algo_maze_map_t* p_map, unsigned int x,
+    unsigned int y)
+{
+    unsigned int post = 0u;
+    unsigned int px = 0u;
+    unsigned int py = 0u;
+
+    inferWallCount = 0u;
+    inferCellsCompleted = 0u;
+
+    /* the walls just seen may have been the last ones a neighbor needed */
+    if (y + 1u < ALGO_MAZE_HEIGHT)
+        algo_WallInferComplete(p_map, x, y + 1u);
+    if (y > 0u)
+        algo_WallInferComplete(p_map, x, y - 1u);
+    if (x + 1u < ALGO_MAZE_WIDTH)
+        algo_WallInferComplete(p_map, x + 1u, y);
+    if (x > 0u)
+        algo_WallInferComplete(p_map, x - 1u, y);
+
+    algo_WallInferQueuePost(x, y);
+    algo_WallInferQueuePost(x + 1u, y);
+    algo_WallInferQueuePost(x, y + 1u);
+    algo_WallInferQueuePost(x + 1u, y + 1u);
+
+    do
+    {
+        while (inferPostTop > 0u)
+        {
+            post = inferPostStack[--inferPostTop];
+            px = (post % (ALGO_MAZE_WIDTH - 1u)) + 1u;
+            py = (post / (ALGO_MAZE_WIDTH - 1u)) + 1u;
+            inferPostQueued[py] &= (algo_maze_row_t)~ALGO_MAZE_ROW_BIT(px - 1u);
+            algo_WallInferPost(p_map, px, py);
+        }
+
+#if ALGO_WALLINFER_GOAL_ENABLE
+        algo_WallInferGoal(p_map);
+#endif
+    } while (inferPostTop > 0u);
+
+    return inferWallCount;
+}
+
+/**
+* Number of cells the last inference left w/ every wall known
+*
+* \param None
+* \retval Cells marked visited w/o being visited
+*/
+unsigned int algo_WallInferGetCellsCompleted(void)
+{
+    return inferCellsCompleted;
+}
+
+/*----------------------------------------------------------------------------*/
+/*                         Private (Static) Functions                         */
+/*----------------------------------------------------------------------------*/
+/**
+* Push a post onto the stack unless the post rule cannot use it
+*
+* \param[in] px Post column, 0 on the west boundary
+* \param[in] py Post row, 0 on the south boundary
+* \retval None
+*/
+static void algo_WallInferQueuePost(unsigned int px, unsigned int py)
+{
+#if ALGO_WALLINFER_POST_ENABLE
+    /* boundary posts always have the outer wall */
+    if ((px == 0u) || (px >= ALGO_MAZE_WIDTH)
+        || (py == 0u) || (py >= ALGO_MAZE_HEIGHT))
+        return;
+
+    /* the post in the middle of the goal is the one allowed w/o walls */
+    if ((px > ALGO_MAZE_GOAL_X_MIN) && (px <= ALGO_MAZE_GOAL_X_MAX)
+        && (py > ALGO_MAZE_GOAL_Y_MIN) && (py <= ALGO_MAZE_GOAL_Y_MAX))
+        return;
+
+    if (inferPostQueued[py] & ALGO_MAZE_ROW_BIT(px - 1u))
+        return;
+
+    inferPostQueued[py] |= ALGO_MAZE_ROW_BIT(px - 1u);
+    inferPostStack[inferPostTop++] =
+        (uint16_t)(((py - 1u) * (ALGO_MAZE_WIDTH - 1u)) + (px - 1u));
+#else
+    (void)px;
+    (void)py;
+#endif
+}
+
+/**
+* Put a wall on the last arm of a post whose other three arms are open
+*
+* \param[in,out] p_map Walls discovered so far
+* \param[in]     px    Post column
+* \param[in]     py    Post row
+* \retval None
+*/
+static void algo_WallInferPost(algo_maze_map_t* p_map, unsigned int px,
+    unsigned int py)
+{
+    /* arms north, south, east, west as the side of a cell next to them */
+    const unsigned int armX[4] = { px - 1u, px - 1u, px, px - 1u };
+    const unsigned int armY[4] = { py, py - 1u, py - 1u, py - 1u };
+    const unsigned int armDir[4] = { EAST, EAST, NORTH, NORTH };
+    unsigned int unknownArm = 4u;
+    unsigned int arm = 0u;
+
+    for (arm = 0u; arm < 4u; arm++)
+    {
+        if (!algo_MazeMapIsWallKnown(p_map, armX[arm], armY[arm], armDir[arm]))
+        {
+            if (unknownArm != 4u)
+                return;
+            unknownArm = arm;
+        }
+        else if (algo_MazeMapHasWall(p_map, armX[arm], armY[arm], armDir[arm]))
+            return;
+    }
+
+    if (unknownArm != 4u)
+        algo_WallInferSet(p_map, armX[unknownArm], armY[unknownArm],
+            armDir[unknownArm], TRUE);
+}
+
+#if ALGO_WALLINFER_GOAL_ENABLE
+/**
+* Close the goal outline once the entrance is known, or open the entrance
+* once it is the only wall of the outline left unknown
+*
+* \param[in,out] p_map Walls discovered so far
+* \retval None
+*/
+static void algo_WallInferGoal(algo_maze_map_t* p_map)
+{
+    unsigned int openCount = 0u;
+    unsigned int unknownCount = 0u;
+    unsigned int side = 0u;
+    unsigned int x = 0u;
+    unsigned int y = 0u;
+    unsigned int dir = 0u;
+
+    for (side = 0u; side < ALGO_WALLINFER_GOAL_SIDES; side++)
+    {
+        algo_WallInferGoalSide(side, &x, &y, &dir);
+        if (!algo_MazeMapIsWallKnown(p_map, x, y, dir))
+            unknownCount++;
+        else if (!algo_MazeMapHasWall(p_map, x, y, dir))
+            openCount++;
+    }
+
+    if ((unknownCount == 0u) || (openCount > 1u)
+        || ((openCount == 0u) && (unknownCount > 1u)))
+        return;
+
+    for (side = 0u; side < ALGO_WALLINFER_GOAL_SIDES; side++)
+    {
+        algo_WallInferGoalSide(side, &x, &y, &dir);
+        if (!algo_MazeMapIsWallKnown(p_map, x, y, dir))
+            algo_WallInferSet(p_map, x, y, dir, (openCount == 1u));
+    }
+}
+
+/**
+* Goal cell and side of one wall of the goal outline
+*
+* \param[in]  side  Wall of the outline, 0 to ALGO_WALLINFER_GOAL_SIDES - 1
+* \param[out] p_x   Column of the goal cell
+* \param[out] p_y   Row of the goal cell
+* \param[out] p_dir Side of the goal cell facing out
+* \retval None
+*/
+static void algo_WallInferGoalSide(unsigned int side, unsigned int* p_x,
+    unsigned int* p_y, unsigned int* p_dir)
+{
+    const unsigned int width = ALGO_MAZE_GOAL_X_MAX - ALGO_MAZE_GOAL_X_MIN + 1u;
+
+    if (side < (2u * width))
+    {
+        *p_x = ALGO_MAZE_GOAL_X_MIN + (side >> 1);
+        *p_y = (side & 1u) ? ALGO_MAZE_GOAL_Y_MAX : ALGO_MAZE_GOAL_Y_MIN;
+        *p_dir = (side & 1u) ? NORTH : SOUTH;
+    }
+    else
+    {
+        side -= 2u * width;
+        *p_x = (side & 1u) ? ALGO_MAZE_GOAL_X_MAX : ALGO_MAZE_GOAL_X_MIN;
+        *p_y = ALGO_MAZE_GOAL_Y_MIN + (side >> 1);
+        *p_dir = (side & 1u) ? EAST : WEST;
+    }
+}
+#endif
+
+/**
+* Record an inferred wall and queue what it might settle next
+*
+* \param[in,out] p_map   Walls discovered so far
+* \param[in]     x       Cell column
+* \param[in]     y       Cell row
+* \param[in]     dir     Side of the cell (NORTH, SOUTH, EAST, WEST)
+* \param[in]     present TRUE for a wall, FALSE for an opening
+* \retval None
+*/
+static void algo_WallInferSet(algo_maze_map_t* p_map, unsigned int x,
+    unsigned int y, unsigned int dir, bool present)
+{
+    algo_MazeMapSetWall(p_map, x, y, dir, present);
+    inferWallCount++;
+
+    /* posts at both ends of the wall, and the cell on its far side */
+    switch (dir)
+    {
+        case NORTH:
+            algo_WallInferQueuePost(x, y + 1u);
+            algo_WallInferQueuePost(x + 1u, y + 1u);
+            algo_WallInferComplete(p_map, x, y + 1u);
+            break;
+        case SOUTH:
+            algo_WallInferQueuePost(x, y);
+            algo_WallInferQueuePost(x + 1u, y);
+            algo_WallInferComplete(p_map, x, y - 1u);
+            break;
+        case EAST:
+            algo_WallInferQueuePost(x + 1u, y);
+            algo_WallInferQueuePost(x + 1u, y + 1u);
+            algo_WallInferComplete(p_map, x + 1u, y);
+            break;
+        default:
+            algo_WallInferQueuePost(x, y);
+            algo_WallInferQueuePost(x, y + 1u);
+            algo_WallInferComplete(p_map, x - 1u, y);
+            break;
+    }
+    algo_WallInferComplete(p_map, x, y);
+}
+
+/**
+* Mark a cell visited once all its walls are known
+*
+* Goal cells are left to be driven into, reaching the goal is what stops
+* exploring when exploring until proven is switched off.
+*
+* \param[in,out] p_map Walls discovered so far
+* \param[in]     x     Cell column
+* \param[in]     y     Cell row
+* \retval None
+*/
+static void algo_WallInferComplete(algo_maze_map_t* p_map, unsigned int x,
+    unsigned int y)
+{
+    if (algo_MazeMapIsVisited(p_map, x, y) || ALGO_MAZE_IS_GOAL(x, y)
+        || !algo_MazeMapIsWallKnown(p_map, x, y, NORTH)
+        || !algo_MazeMapIsWallKnown(p_map, x, y, SOUTH)
+        || !algo_MazeMapIsWallKnown(p_map, x, y, EAST)
+        || !algo_MazeMapIsWallKnown(p_map, x, y, WEST))
+        return;
+
+    algo_MazeMapSetVisited(p_map, x, y);
+    inferCellsCompleted++;
+}
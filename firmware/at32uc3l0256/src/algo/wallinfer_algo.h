@@ -0,0 +1,71 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : wallinfer_algo.h
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : algo layer
+*
+* This is the header file for maze rule wall inference.
+*
+* Competition mazes follow rules that pin down walls the sensors have not
+* seen yet:
+*
+*   - every post has at least one wall attached, except the post in the
+*     middle of the goal, so a post w/ three arms known to be open has a
+*     wall on the fourth
+*   - the goal has exactly one entrance, so once it is found the rest of the
+*     goal's outline is walls, and once all but one of the outline are
+*     known walls the last one is the entrance
+*   - the outer boundary is closed, the maze map already reads it that way
+*
+* Inferred walls are recorded as known, just like walls the sensors saw. A
+* cell whose walls all end up known is marked visited, there is nothing
+* left for the mouse to find out there.
+*
+* The algo layer defines all mouse maze solving algorithms as the second most
+* highest layer to be called directly in main.
+*-----------------------------------------------------------------------------*/
+
+#ifndef WALLINFER_ALGO_H_
+#define WALLINFER_ALGO_H_
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdint.h>
+#include "algo/algo.h"
+#include "algo/mazemap_algo.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+/* 1 = use the post rule */
+#ifndef ALGO_WALLINFER_POST_ENABLE
+#define ALGO_WALLINFER_POST_ENABLE      (1)
+#endif
+
+/* 1 = use the goal entrance rule, on by default for a 2x2 goal only, test
+   mazes w/ other goals need not follow it */
+#ifndef ALGO_WALLINFER_GOAL_ENABLE
+#define ALGO_WALLINFER_GOAL_ENABLE \
+    ((ALGO_MAZE_GOAL_X_MAX - ALGO_MAZE_GOAL_X_MIN == 1u) \
+    && (ALGO_MAZE_GOAL_Y_MAX - ALGO_MAZE_GOAL_Y_MIN == 1u))
+#endif
+
+/* posts not on the outer boundary, the only ones the post rule can use */
+#define ALGO_WALLINFER_POST_COUNT \
+    ((ALGO_MAZE_WIDTH - 1u) * (ALGO_MAZE_HEIGHT - 1u))
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+unsigned int algo_WallInferAround(algo_maze_map_t* p_map, unsigned int x,
+    unsigned int y);
+unsigned int algo_WallInferGetCellsCompleted(void);
+
+#endif /* WALLINFER_ALGO_H_ */
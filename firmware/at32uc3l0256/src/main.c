@@ -26,6 +26,8 @@
 
 #include "algo/algo.h"
 #include "algo/wallfollower_algo.h"
+#include "algo/strategy_algo.h"
+#include "algo/runmanager_algo.h"
 
 /*----------------------------------------------------------------------------*/
 /*                                Definitions                                 */
@@ -68,51 +70,20 @@ int main (void)
 {   
     /* initialize mouse */
     mci_InitializeMouse();
-        
+    
+    /* explore w/ the flood fill strategy, see algo/strategy_algo.h */
+    algo_StrategySelect(ALGO_STRATEGY_FLOOD_FILL);
+    /* pick the starting mode w/ the config button, then explore, drive
+       back and speed run until the time is up, see algo/runmanager_algo.h */
+    algo_RunStart(algo_RunSelectMode());
+
     /* infinite while loop */
-	
-	mhi_DelayMs(2000);
-	mci_MoveForwardNSquares(4);
-// 	mci_MoveForwardHalfMazeSquarePid();
-// 	mhi_DelayMs(2000);
+    while(1)
+    {
+        mhi_CheckLowBattery();
 
-/* 	mci_MoveForwardHalfMazeSquarePid();*/
-// 	mci_MoveForward1MazeSquarePid();
-// 	mhi_DelayMs(1000);
-// 	mci_MoveForwardHalfMazeSquarePid();
-// 	mhi_DelayMs(1000);
-// 	mci_TurnRight45Degrees();
-// 	mhi_DelayMs(1000);
-// 	mci_MoveForwardHalfMazeSquarePid();
-// 	mhi_DelayMs(1000);
-// 	mci_TurnRight90Degrees();
-// 	mhi_DelayMs(1000);
-// 	mci_MoveForwardHalfMazeSquarePid();
-// 	mhi_DelayMs(1000);
-// 	mci_MoveForwardHalfMazeSquarePid();
-// 	mhi_DelayMs(1000);
-// 	mci_TurnLeft90Degrees();
-// 	mhi_DelayMs(1000);
-// 	mci_MoveForwardHalfMazeSquarePid();
-// 	mhi_DelayMs(1000);
-// 	mci_MoveForwardHalfMazeSquarePid();
-// 	mhi_DelayMs(1000);
-// 	mci_TurnRight90Degrees();
-// 	mhi_DelayMs(1000);
-// 	mci_MoveForwardHalfMazeSquarePid();
-// 	mhi_DelayMs(1000);
-// 	mci_TurnRight45Degrees();
-// 	mhi_DelayMs(1000);
-// 	mci_MoveForwardHalfMazeSquarePid();
-//     while(1)
-//     {
-//         mhi_CheckLowBattery();
-//         
-// 		traverseCell();
-// // 		if(mci_CheckFrontWall()){
-// // 			mci_AdjustToFrontWall();
-// // 		}
-// 		
-//     }
+        if (!algo_RunStep())
+            mci_DelayMs(100);
+    }
 }
 
@@ -0,0 +1,877 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : control_mci.c
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : mouse control interface layer
+*
+* This is the source file for the mouse motion control loop under the mouse
+* control interface.
+*
+* Encoder 1 and motor 1 are the left wheel, encoder 2 and motor 2 the right
+* wheel. Every move is measured from the edge counts it started at, and
+* the pose is moved on by them every tick, so the encoders are never
+* cleared.
+*
+* The profile of the move is only stepped by the loop, and only started w/
+* interrupts off, so it is kept out of the volatile state. The same goes
+* for the queued moves, only their counts are read w/ interrupts on.
+*
+* The mouse control interface uses the mouse hardware interface to define high
+* level micromouse functionality.
+*-----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "shared_functions/constrain_sf.h"
+#include "mouse_hardware_interface/usart_mhi.h"
+#include "mouse_hardware_interface/timer_mhi.h"
+#include "mouse_hardware_interface/motors_mhi.h"
+#include "mouse_hardware_interface/interrupts_mhi.h"
+#include "mouse_control_interface/profile_mci.h"
+#include "mouse_control_interface/control_mci.h"
+#include "mouse_control_interface/odometry_mci.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+/* what the loop is driving */
+typedef enum
+{
+    MCI_CONTROL_IDLE = 0u,      /* motors left alone */
+    MCI_CONTROL_STRAIGHT,       /* drive a distance, hold the heading or */
+                                /* the curvature of an arc */
+    MCI_CONTROL_ROTATE          /* turn in place */
+} mci_control_mode_t;
+
+/* setpoint the moves hand the loop, and the state the loop keeps */
+typedef struct
+{
+    mci_control_mode_t mode;
+    mci_control_mode_t moveMode;    /* of the last move, idle or not */
+    bool anchored;              /* the next move starts from the last */
+                                /* one's end setpoint */
+    bool done;                  /* profile ended, or settled at rest */
+    int32_t startEncoder1;      /* edge counts the move started from */
+    int32_t startEncoder2;
+    int32_t rotateDirection;    /* 1 right, -1 left */
+    int32_t curvatureQ16;       /* arc: wheels apart per edge driven */
+    mci_control_gains_t gains;  /* heading, or the turn on the spot */
+    int32_t steering;           /* side wall offset to the heading */
+    int32_t distance;           /* both wheels summed since the start */
+    int32_t prevPositionError;
+    int32_t prevError;
+    uint32_t settleTicks;       /* ticks since the profile ended at rest */
+    bool queuedMove;            /* from the queue, counted once done */
+    int32_t endVelocity;        /* queued move: if the next one chains on */
+} mci_control_state_t;
+
+/* moves waiting behind the one under way, a ring filled by the foreground */
+/* and emptied by the tick task */
+typedef struct
+{
+    mci_control_command_t commands[MCI_CONTROL_QUEUE_LENGTH];
+    volatile uint32_t head;     /* next to start */
+    volatile uint32_t count;
+    volatile uint32_t started;
+    volatile uint32_t finished;
+    volatile uint32_t stops;    /* times moves were dropped */
+    volatile uint8_t tag;       /* of the move last started */
+} mci_control_queue_t;
+
+/*----------------------------------------------------------------------------*/
+/*                               Debug Switches                               */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+/* shared w/ the tick task, only changed w/ interrupts off */
+static volatile mci_control_state_t control =
+{
+    .mode = MCI_CONTROL_IDLE,
+    .moveMode = MCI_CONTROL_IDLE,
+    .anchored = false,
+    .done = true,
+};
+/* profile of the move, stepped by the tick task */
+static mci_profile_t controlProfile;
+/* queued moves, see mci_ControlPush() */
+static mci_control_queue_t controlQueue;
+/* control ticks per second */
+static uint32_t controlRateHz = 1000u;
+
+/*----------------------------------------------------------------------------*/
+/*                    Private (Static) Function Prototype                     */
+/*----------------------------------------------------------------------------*/
+static void mci_ControlStart(mci_control_mode_t mode,
+    const mci_profile_params_t* p_profile, int32_t rotateDirection,
+    int32_t curvatureQ16, const mci_control_gains_t* p_gains);
+static void mci_ControlBegin(mci_control_mode_t mode,
+    const mci_profile_params_t* p_profile, int32_t rotateDirection,
+    int32_t curvatureQ16, const mci_control_gains_t* p_gains);
+static void mci_ControlNext(void);
+static bool mci_ControlChainsOn(void);
+static void mci_ControlFinish(void);
+static void mci_ControlDropQueue(void);
+static void mci_ControlTask(void);
+static void mci_ControlStraight(int32_t encoder1, int32_t encoder2);
+static void mci_ControlRotate(int32_t encoder1, int32_t encoder2);
+static int32_t mci_ControlTravel(int32_t position);
+static int32_t mci_ControlFeedforward(int32_t velocity);
+static int32_t mci_ControlPd(const mci_control_gains_t* p_gains,
+    int32_t error, int32_t dError);
+static void mci_ControlSetWheelSpeeds(int32_t leftSpeed, int32_t rightSpeed);
+static void mci_ControlStopWheels(void);
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+/**
+* Start the control loop on the timer counter tick
+*
+* The timer counter has to be initialized first.
+*
+* \param None
+* \retval None
+*/
+void mci_InitControl(void)
+{
+    controlRateHz = mhi_GetTimerTickRateHz();
+    mci_InitOdometry(mhi_GetEncoder1EdgeCount(), mhi_GetEncoder2EdgeCount());
+    mhi_SetTimerTickTask(mci_ControlTask);
+    mhi_ClearTimerTickStats();
+}
+
+/**
+* Drive straight ahead, holding the heading the move starts w/
+*
+* The start velocity of the profile is the velocity the last move is still
+* running at, whatever the profile says.
+*
+* \param[in] p_profile Profile in both wheels' edges summed
+* \param[in] p_gains   Heading PD gains
+* \retval None
+*/
+void mci_ControlStartStraight(const mci_profile_params_t* p_profile,
+    const mci_control_gains_t* p_gains)
+{
+    mci_ControlStart(MCI_CONTROL_STRAIGHT, p_profile, 1, 0, p_gains);
+}
+
+/**
+* Drive an arc, the outer wheel ahead of the inner one by the curvature
+*
+* An arc of radius r between wheels b apart has a curvature of b / 2r: the
+* outer wheel drives (1 + b / 2r) of the centre's distance, the inner wheel
+* (1 - b / 2r). The heading gains hold the wheels to it.
+*
+* \param[in] p_profile    Profile in both wheels' edges summed
+* \param[in] curvatureQ16 b / 2r in 1/65536, positive to the right
+* \param[in] p_gains      Heading PD gains
+* \retval None
+*/
+void mci_ControlStartArc(const mci_profile_params_t* p_profile,
+    int32_t curvatureQ16, const mci_control_gains_t* p_gains)
+{
+    mci_ControlStart(MCI_CONTROL_STRAIGHT, p_profile, 1, curvatureQ16,
+        p_gains);
+}
+
+/**
+* Turn in place, the wheels in opposite directions
+*
+* \param[in] p_profile Profile in both wheels' edges summed, so twice the
+*                      edges of each wheel
+* \param[in] right     true to turn right
+* \param[in] p_gains   PD gains keeping the turn on the spot
+* \retval None
+*/
+void mci_ControlStartRotate(const mci_profile_params_t* p_profile,
+    bool right, const mci_control_gains_t* p_gains)
+{
+    mci_ControlStart(MCI_CONTROL_ROTATE, p_profile, right ? 1 : -1, 0,
+        p_gains);
+}
+
+/**
+* Queue a move to start as soon as the moves before it are done
+*
+* The loop starts it the tick the last profile ends, from the setpoint that
+* one ended on, see control_mci.h. A move started w/ mci_ControlStart*()
+* or mci_ControlStop() drops the queue.
+*
+* \param[in] p_command Move to queue
+* \retval true if queued, false if the queue is full
+*/
+bool mci_ControlPush(const mci_control_command_t* p_command)
+{
+    bool pushed = false;
+
+    mhi_DisableGlobalInterrupts();
+
+    if (controlQueue.count < MCI_CONTROL_QUEUE_LENGTH)
+    {
+        controlQueue.commands[(controlQueue.head + controlQueue.count)
+            % MCI_CONTROL_QUEUE_LENGTH] = *p_command;
+        controlQueue.count++;
+        pushed = true;
+    }
+
+    mhi_EnableGlobalInterrupts();
+
+    return pushed;
+}
+
+/**
+* Where the loop is w/ the queued moves, e.g. to look ahead from
+*
+* \param[out] p_state Queue state, distances in both wheels' edges summed
+* \retval None
+*/
+void mci_GetControlQueueState(mci_control_queue_state_t* p_state)
+{
+    uint32_t i = 0u;
+    const mci_control_command_t* p_command = NULL;
+
+    mhi_DisableGlobalInterrupts();
+
+    p_state->queued = controlQueue.count;
+    p_state->started = controlQueue.started;
+    p_state->finished = controlQueue.finished;
+    p_state->stops = controlQueue.stops;
+    p_state->tag = controlQueue.tag;
+    p_state->remaining = 0;
+    if (control.mode == MCI_CONTROL_STRAIGHT)
+    {
+        p_state->remaining = controlProfile.params.distance
+            - mci_ProfileGetPosition(&controlProfile);
+    }
+    p_state->queuedDistance = 0;
+    for (i = 0u; i < controlQueue.count; i++)
+    {
+        p_command = &controlQueue.commands[(controlQueue.head + i)
+            % MCI_CONTROL_QUEUE_LENGTH];
+        if (p_command->type != MCI_CONTROL_COMMAND_ROTATE)
+        {
+            p_state->queuedDistance += p_command->profile.distance;
+        }
+    }
+
+    mhi_EnableGlobalInterrupts();
+}
+
+/**
+* Hand a straight move the side wall steering, in heading edges
+*
+* \param[in] steering Offset to the heading error, positive steers right
+* \retval None
+*/
+void mci_ControlSetSteering(int32_t steering)
+{
+    control.steering = steering;
+}
+
+/**
+* Stop the move now, e.g. for a wall in front, and drop the queued ones
+*
+* The next move starts from where the wheels are, not where this one was
+* headed.
+*
+* \param None
+* \retval None
+*/
+void mci_ControlStop(void)
+{
+    mhi_DisableGlobalInterrupts();
+
+    mci_ControlDropQueue();
+    control.mode = MCI_CONTROL_IDLE;
+    control.anchored = false;
+    control.done = true;
+    mci_ControlStopWheels();
+
+    mhi_EnableGlobalInterrupts();
+}
+
+/**
+* Whether the last move is done
+*
+* \param None
+* \retval true once the move and every queued one has reached its target or
+*         was stopped, a move that ends w/ a velocity is still running at it
+*/
+bool mci_ControlIsDone(void)
+{
+    return control.done && (controlQueue.count == 0u);
+}
+
+/**
+* Wait for the last move to finish
+*
+* \param None
+* \retval None
+*/
+void mci_ControlWait(void)
+{
+    while (!mci_ControlIsDone())
+    {
+        asm("NOP");
+    }
+}
+
+/**
+* Distance driven since the move started
+*
+* \param None
+* \retval Both wheels' edges summed
+*/
+int32_t mci_ControlGetDistance(void)
+{
+    return control.distance;
+}
+
+/**
+* Velocity a wheel PWM drives at, by the feedforward of the loop
+*
+* \param[in] speed PWM
+* \retval Edges per second of one wheel, 0 below the offset
+*/
+int32_t mci_ControlSpeedToVelocity(uint16_t speed)
+{
+    if (speed <= MCI_CONTROL_SPEED_OFFSET)
+        return 0;
+
+    return (((int32_t)speed - MCI_CONTROL_SPEED_OFFSET) * 256)
+        / MCI_CONTROL_VELOCITY_FF_Q8;
+}
+
+/**
+* Control ticks per second
+*
+* \param None
+* \retval Hz
+*/
+uint32_t mci_ControlGetRateHz(void)
+{
+    return controlRateHz;
+}
+
+/**
+* Timing of the control loop
+*
+* \param[out] p_stats Timing since the stats were last cleared
+* \retval None
+*/
+void mci_GetControlStats(mci_control_stats_t* p_stats)
+{
+    mhi_timer_tick_stats_t tickStats;
+
+    mhi_GetTimerTickStats(&tickStats);
+
+    p_stats->rateHz = controlRateHz;
+    p_stats->tickCount = tickStats.tickCount;
+    p_stats->overrunCount = tickStats.overrunCount;
+    p_stats->maxLatencyNs = tickStats.maxLatencyNs;
+    p_stats->jitterNs = tickStats.jitterNs;
+    p_stats->maxRunNs = tickStats.maxRunNs;
+}
+
+/**
+* Restart timing of the control loop
+*
+* \param None
+* \retval None
+*/
+void mci_ClearControlStats(void)
+{
+    mhi_ClearTimerTickStats();
+}
+
+/**
+* Print timing of the control loop
+*
+* \param None
+* \retval None
+*/
+void mci_PrintControlStats(void)
+{
+    mci_control_stats_t stats;
+
+    mci_GetControlStats(&stats);
+
+    mhi_PrintString("control ");
+    mhi_PrintInt(stats.rateHz);
+    mhi_PrintString(" Hz, ticks ");
+    mhi_PrintInt(stats.tickCount);
+    mhi_PrintString(", overruns ");
+    mhi_PrintInt(stats.overrunCount);
+    mhi_PrintString(", jitter ");
+    mhi_PrintInt(stats.jitterNs);
+    mhi_PrintString(" ns, max latency ");
+    mhi_PrintInt(stats.maxLatencyNs);
+    mhi_PrintString(" ns, max run ");
+    mhi_PrintInt(stats.maxRunNs);
+    mhi_PrintString(" ns\r\n");
+}
+
+/*----------------------------------------------------------------------------*/
+/*                           Local Shared Functions                           */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                         Private (Static) Functions                         */
+/*----------------------------------------------------------------------------*/
+/**
+* Hand the loop a move now, dropping the queued ones
+*
+* \param[in] mode            Straight or rotate
+* \param[in] p_profile       Profile in both wheels' edges summed
+* \param[in] rotateDirection 1 right, -1 left
+* \param[in] curvatureQ16    Arc of a straight move, 0 to drive straight
+* \param[in] p_gains         Heading or on the spot PD gains
+* \retval None
+*/
+static void mci_ControlStart(mci_control_mode_t mode,
+    const mci_profile_params_t* p_profile, int32_t rotateDirection,
+    int32_t curvatureQ16, const mci_control_gains_t* p_gains)
+{
+    mhi_DisableGlobalInterrupts();
+
+    mci_ControlDropQueue();
+    mci_ControlBegin(mode, p_profile, rotateDirection, curvatureQ16,
+        p_gains);
+
+    mhi_EnableGlobalInterrupts();
+}
+
+/**
+* Start a move, w/ interrupts off or from the tick task
+*
+* A move of the same kind as one still moving, at its end velocity or on
+* the way, starts from the setpoint that one got to, w/ its velocity. The
+* rest of the last move is dropped. A move after one whose profile ended at
+* rest starts from that one's end setpoint as well, whatever its kind and
+* however long ago, so what the wheels are behind or over carries over.
+* Only a move after mci_ControlStop() starts from where the wheels are.
+*
+* \param[in] mode            Straight or rotate
+* \param[in] p_profile       Profile in both wheels' edges summed
+* \param[in] rotateDirection 1 right, -1 left
+* \param[in] curvatureQ16    Arc of a straight move, 0 to drive straight
+* \param[in] p_gains         Heading or on the spot PD gains
+* \retval None
+*/
+static void mci_ControlBegin(mci_control_mode_t mode,
+    const mci_profile_params_t* p_profile, int32_t rotateDirection,
+    int32_t curvatureQ16, const mci_control_gains_t* p_gains)
+{
+    mci_profile_params_t params = *p_profile;
+    int32_t velocity = mci_ProfileGetVelocity(&controlProfile);
+    bool sameKind = (control.mode == mode)
+        && (control.rotateDirection == rotateDirection);
+    int32_t position = 0;
+    int32_t apart = 0;
+
+    if (control.anchored
+        && ((velocity > 0) ? sameKind : mci_ProfileIsDone(&controlProfile)))
+    {
+        /* chain on from the setpoint, split between the wheels as the */
+        /* last move drove it */
+        position = mci_ProfileGetPosition(&controlProfile);
+        if (control.moveMode == MCI_CONTROL_STRAIGHT)
+        {
+            apart = (int32_t)(((int64_t)position * control.curvatureQ16)
+                >> 17);
+            control.startEncoder1 += (position / 2) + apart;
+            control.startEncoder2 += (position / 2) - apart;
+        }
+        else
+        {
+            control.startEncoder1 += control.rotateDirection
+                * (position / 2);
+            control.startEncoder2 -= control.rotateDirection
+                * (position / 2);
+        }
+        params.startVelocity = velocity;
+        if (!sameKind)
+        {
+            control.prevPositionError = 0;
+            control.prevError = 0;
+        }
+    }
+    else
+    {
+        control.startEncoder1 = (int32_t)mhi_GetEncoder1EdgeCount();
+        control.startEncoder2 = (int32_t)mhi_GetEncoder2EdgeCount();
+        control.prevPositionError = 0;
+        control.prevError = 0;
+        params.startVelocity = 0;
+    }
+
+    mci_ProfileStart(&controlProfile, &params, controlRateHz);
+    control.rotateDirection = rotateDirection;
+    control.curvatureQ16 = curvatureQ16;
+    control.gains = *p_gains;
+    control.steering = 0;
+    control.distance = 0;
+    control.settleTicks = 0u;
+    control.done = false;
+    control.mode = mode;
+    control.moveMode = mode;
+    control.anchored = true;
+}
+
+/**
+* Start the next queued move, from the tick task
+*
+* \param None
+* \retval None
+*/
+static void mci_ControlNext(void)
+{
+    const mci_control_command_t* p_command
+        = &controlQueue.commands[controlQueue.head];
+
+    /* the move under way is done w/, settled or not */
+    mci_ControlFinish();
+
+    if (p_command->type == MCI_CONTROL_COMMAND_ROTATE)
+    {
+        mci_ControlBegin(MCI_CONTROL_ROTATE, &p_command->profile,
+            p_command->right ? 1 : -1, 0, &p_command->gains);
+    }
+    else
+    {
+        mci_ControlBegin(MCI_CONTROL_STRAIGHT, &p_command->profile, 1,
+            (p_command->type == MCI_CONTROL_COMMAND_ARC)
+            ? p_command->curvatureQ16 : 0, &p_command->gains);
+    }
+    control.queuedMove = true;
+    control.endVelocity = p_command->profile.endVelocity;
+    controlQueue.tag = p_command->tag;
+
+    controlQueue.head = (controlQueue.head + 1u) % MCI_CONTROL_QUEUE_LENGTH;
+    controlQueue.count--;
+    controlQueue.started++;
+}
+
+/**
+* Whether the next queued move carries on the velocity of the one under way
+*
+* \param None
+* \retval true if there is one and it is of the same kind
+*/
+static bool mci_ControlChainsOn(void)
+{
+    const mci_control_command_t* p_command
+        = &controlQueue.commands[controlQueue.head];
+
+    if (controlQueue.count == 0u)
+    {
+        return false;
+    }
+    if (p_command->type == MCI_CONTROL_COMMAND_ROTATE)
+    {
+        return (control.mode == MCI_CONTROL_ROTATE)
+            && (control.rotateDirection == (p_command->right ? 1 : -1));
+    }
+
+    return control.mode == MCI_CONTROL_STRAIGHT;
+}
+
+/**
+* Count a queued move done, once
+*
+* \param None
+* \retval None
+*/
+static void mci_ControlFinish(void)
+{
+    if (control.queuedMove)
+    {
+        control.queuedMove = false;
+        controlQueue.finished++;
+    }
+}
+
+/**
+* Drop the queued moves, w/ interrupts off; the one under way counts as
+* finished, the ones waiting as a stop, see control_mci.h
+*
+* \param None
+* \retval None
+*/
+static void mci_ControlDropQueue(void)
+{
+    if (control.queuedMove || (controlQueue.count != 0u))
+    {
+        controlQueue.stops++;
+    }
+    controlQueue.count = 0u;
+    mci_ControlFinish();
+}
+
+/**
+* Control loop, run by the timer counter interrupt every tick
+*
+* \param None
+* \retval None
+*/
+static void mci_ControlTask(void)
+{
+    uint32_t edges1 = mhi_GetEncoder1EdgeCount();
+    uint32_t edges2 = mhi_GetEncoder2EdgeCount();
+    int32_t encoder1 = 0;
+    int32_t encoder2 = 0;
+
+    /* the pose moves on whatever the loop drives, even by hand */
+    mci_UpdateOdometry(edges1, edges2);
+
+    /* a queued move starts the tick the last profile ends */
+    if ((controlQueue.count != 0u) && ((control.mode == MCI_CONTROL_IDLE)
+        || mci_ProfileIsDone(&controlProfile)))
+    {
+        mci_ControlNext();
+    }
+
+    if (control.mode == MCI_CONTROL_IDLE)
+    {
+        return;
+    }
+
+    encoder1 = (int32_t)edges1 - control.startEncoder1;
+    encoder2 = (int32_t)edges2 - control.startEncoder2;
+    control.distance = encoder1 + encoder2;
+
+    /* a queued move only keeps a velocity for a move to carry it into */
+    if (control.queuedMove)
+    {
+        mci_ProfileSetEndVelocity(&controlProfile,
+            mci_ControlChainsOn() ? control.endVelocity : 0);
+    }
+    mci_ProfileStep(&controlProfile);
+
+    if (control.mode == MCI_CONTROL_STRAIGHT)
+    {
+        mci_ControlStraight(encoder1, encoder2);
+    }
+    else
+    {
+        mci_ControlRotate(encoder1, encoder2);
+    }
+}
+
+/**
+* One tick of a straight move
+*
+* \param[in] encoder1 Left wheel edges since the start
+* \param[in] encoder2 Right wheel edges since the start
+* \retval None
+*/
+static void mci_ControlStraight(int32_t encoder1, int32_t encoder2)
+{
+    mci_control_gains_t gains = control.gains;
+    int32_t velocity = mci_ProfileGetVelocity(&controlProfile);
+    int32_t travel = 0;
+    int32_t apart = 0;
+    int32_t error = 0;
+    int32_t output = 0;
+
+    travel = mci_ControlTravel(encoder1 + encoder2);
+    if (control.mode == MCI_CONTROL_IDLE)
+    {
+        return;
+    }
+
+    /* heading error off the arc, w/ the side wall steering on top */
+    apart = (int32_t)(((int64_t)(encoder1 + encoder2) * control.curvatureQ16)
+        >> 16);
+    error = (encoder2 - encoder1) + apart + control.steering;
+    output = mci_ControlPd(&gains, error, error - control.prevError);
+    control.prevError = error;
+
+    /* on an arc the outer wheel runs faster */
+    apart = (int32_t)(((int64_t)velocity * control.curvatureQ16) >> 17);
+    mci_ControlSetWheelSpeeds(
+        mci_ControlFeedforward((velocity / 2) + apart) + travel + output,
+        mci_ControlFeedforward((velocity / 2) - apart) + travel - output);
+}
+
+/**
+* One tick of a turn in place
+*
+* \param[in] encoder1 Left wheel edges since the start
+* \param[in] encoder2 Right wheel edges since the start
+* \retval None
+*/
+static void mci_ControlRotate(int32_t encoder1, int32_t encoder2)
+{
+    mci_control_gains_t gains = control.gains;
+    int32_t travel = 0;
+    int32_t error = 0;
+    int32_t output = 0;
+
+    /* the left wheel goes forward for a right turn */
+    travel = mci_ControlTravel(control.rotateDirection
+        * (encoder1 - encoder2));
+    if (control.mode == MCI_CONTROL_IDLE)
+    {
+        return;
+    }
+
+    /* both wheels back off whatever the turn drifted forward */
+    error = encoder1 + encoder2;
+    output = mci_ControlPd(&gains, error, error - control.prevError);
+    control.prevError = error;
+
+    travel += mci_ControlFeedforward(mci_ProfileGetVelocity(&controlProfile)
+        / 2);
+    mci_ControlSetWheelSpeeds((control.rotateDirection * travel) - output,
+        (-control.rotateDirection * travel) - output);
+}
+
+/**
+* PWM each wheel needs on top of the feedforward to keep up w/ the profile,
+* ends the move once it settles
+*
+* \param[in] position Both wheels' edges summed along the move
+* \retval PWM, 0 once the move has ended or runs on at its end velocity
+*/
+static int32_t mci_ControlTravel(int32_t position)
+{
+    int32_t positionError = mci_ProfileGetPosition(&controlProfile) - position;
+    int32_t velocity = mci_ProfileGetVelocity(&controlProfile);
+    int32_t output = 0;
+
+    if (mci_ProfileIsDone(&controlProfile))
+    {
+        if (velocity > 0)
+        {
+            /* carry on at the end velocity until the next move */
+            mci_ControlFinish();
+            control.done = true;
+            return 0;
+        }
+
+        /* at rest, settle on the position */
+        control.settleTicks++;
+        if (((positionError <= MCI_CONTROL_SETTLE_EDGES)
+            && (positionError >= -MCI_CONTROL_SETTLE_EDGES))
+            || (control.settleTicks
+            >= ((MCI_CONTROL_SETTLE_MS * controlRateHz) / 1000u)))
+        {
+            mci_ControlStopWheels();
+            mci_ControlFinish();
+            control.mode = MCI_CONTROL_IDLE;
+            control.done = true;
+            return 0;
+        }
+    }
+
+    output = ((MCI_CONTROL_POSITION_KP_Q8 * positionError)
+        + ((MCI_CONTROL_POSITION_KD_Q8
+        * (positionError - control.prevPositionError)
+        * (int32_t)controlRateHz) / 1000)) / 256;
+    control.prevPositionError = positionError;
+
+    return output;
+}
+
+/**
+* PWM a wheel needs to run at a velocity
+*
+* \param[in] velocity Edges per second of one wheel
+* \retval PWM
+*/
+static int32_t mci_ControlFeedforward(int32_t velocity)
+{
+    if (velocity == 0)
+        return 0;
+
+    return ((velocity > 0) ? MCI_CONTROL_SPEED_OFFSET
+        : -MCI_CONTROL_SPEED_OFFSET)
+        + ((MCI_CONTROL_VELOCITY_FF_Q8 * velocity) / 256);
+}
+
+/**
+* PD output of a set of gains
+*
+* The derivative is scaled to per ms by the tick rate, so the gains do not
+* depend on it.
+*
+* \param[in] p_gains PD gains
+* \param[in] error   Error this tick
+* \param[in] dError  Change of the error since the last tick
+* \retval PWM
+*/
+static int32_t mci_ControlPd(const mci_control_gains_t* p_gains,
+    int32_t error, int32_t dError)
+{
+    return ((p_gains->kpQ8 * error)
+        + ((p_gains->kdQ8 * dError * (int32_t)controlRateHz) / 1000))
+        / 256;
+}
+
+/**
+* Set both wheels, negative speeds drive backward
+*
+* \param[in] leftSpeed  Motor 1 PWM
+* \param[in] rightSpeed Motor 2 PWM
+* \retval None
+*/
+static void mci_ControlSetWheelSpeeds(int32_t leftSpeed, int32_t rightSpeed)
+{
+    leftSpeed = sf_constrain(leftSpeed, MCI_CONTROL_MAX_SPEED,
+        -MCI_CONTROL_MAX_SPEED);
+    rightSpeed = sf_constrain(rightSpeed, MCI_CONTROL_MAX_SPEED,
+        -MCI_CONTROL_MAX_SPEED);
+
+    if (leftSpeed == 0)
+    {
+        mhi_StopWheelMotor1();
+    }
+    else if (leftSpeed < 0)
+    {
+        mhi_SetWheelMotor1Speed((uint16_t)(-leftSpeed));
+        mhi_StartWheelMotor1Backward();
+    }
+    else
+    {
+        mhi_SetWheelMotor1Speed((uint16_t)leftSpeed);
+        mhi_StartWheelMotor1Forward();
+    }
+
+    if (rightSpeed == 0)
+    {
+        mhi_StopWheelMotor2();
+    }
+    else if (rightSpeed < 0)
+    {
+        mhi_SetWheelMotor2Speed((uint16_t)(-rightSpeed));
+        mhi_StartWheelMotor2Backward();
+    }
+    else
+    {
+        mhi_SetWheelMotor2Speed((uint16_t)rightSpeed);
+        mhi_StartWheelMotor2Forward();
+    }
+}
+
+/**
+* Stop both wheels
+*
+* \param None
+* \retval None
+*/
+static void mci_ControlStopWheels(void)
+{
+    mhi_StopWheelMotor1();
+    mhi_StopWheelMotor2();
+}
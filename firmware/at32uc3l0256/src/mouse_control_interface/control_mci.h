@@ -0,0 +1,163 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : control_mci.h
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : mouse control interface layer
+*
+* This is the header file for the mouse motion control loop under the mouse
+* control interface.
+*
+* The control loop runs from the timer counter interrupt, once every tick of
+* MM_TIMER_COUNTER_TICK_HZ, so every derivative term sees the same dt no
+* matter what the moves do in between. The moves only hand it setpoints, a
+* distance to drive or an angle to turn, then wait for it to finish. The
+* side wall steering is read by the moves and handed to the loop as an
+* offset to the heading, since the IR sensors share the ADC w/ the rest of
+* the foreground.
+*
+* Each move runs a motion profile, see profile_mci.h, in both wheels' edges
+* summed: the distance for a straight, the wheels' edges apart for a turn.
+* Every tick the loop steps the profile and drives the wheels at the PWM the
+* velocity setpoint takes, plus a PD on how far the wheels are behind the
+* position setpoint. The move's own gains hold the heading of a straight or
+* keep a turn on the spot.
+*
+* A move that ends w/ a velocity carries on at it until the next move of
+* the same kind starts from where the last one should have ended, so the
+* velocity and any distance behind carry over; a move started while the
+* last one is still under way takes over from its setpoint. Straights and
+* arcs are the same kind. A move that ends at rest settles on its
+* position, then stops the wheels. The next move still starts from that
+* position, not from where the wheels settled, so what a move is left
+* short or over carries into the next one; only mci_ControlStop() drops
+* it. The loop also moves the pose on every tick, see odometry_mci.h.
+*
+* Moves can also be queued, see mci_ControlPush(), for the loop to start
+* each one the tick the last one's profile ends, w/o waiting on the
+* foreground. A queued move starts from the setpoint the last one ended
+* on, so what the wheels are still behind carries over instead of being
+* settled out first. It ends at its end velocity only if the move queued
+* behind it by then is of the same kind, and brakes to rest otherwise, so
+* the queue running dry never leaves the mouse driving on. Pushing to a
+* full queue fails straight away; the loop never waits on the queue.
+*
+* A move started w/ mci_ControlStart*() or mci_ControlStop() drops the
+* queue. The queued move under way then counts as finished, so finished
+* always catches up w/ started once the loop is idle. The moves still
+* waiting never start and are never counted; the queue state's stop count
+* goes up instead, so whoever waits on its moves to finish has to leave
+* once that count changes.
+*
+* Gains are in 1/256. The derivative gain is per edge per ms, so a gain
+* tuned at one tick rate holds at another.
+*
+* The mouse control interface uses the mouse hardware interface to define high
+* level micromouse functionality.
+*-----------------------------------------------------------------------------*/
+
+#ifndef CONTROL_MCI_H_
+#define CONTROL_MCI_H_
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+/* highest PWM the loop drives a wheel at */
+#define MCI_CONTROL_MAX_SPEED    (255)
+
+/* wheel PWM for a velocity: offset + velocity * feedforward, the offset */
+/* gets the wheels turning at all, the feedforward in 1/256 PWM per edge/s */
+/* Untuned guess: PWM 140 for about 160 edges/s, 400 mm/s */
+#define MCI_CONTROL_SPEED_OFFSET       (100)
+#define MCI_CONTROL_VELOCITY_FF_Q8     (64)
+
+/* PD on the distance behind the position setpoint, in 1/256 */
+#define MCI_CONTROL_POSITION_KP_Q8     (1024)
+#define MCI_CONTROL_POSITION_KD_Q8     (256)
+
+/* a move at rest is done this close to its position, or after this long */
+#define MCI_CONTROL_SETTLE_EDGES       (1)
+#define MCI_CONTROL_SETTLE_MS          (150)
+
+/* moves the loop holds queued behind the one under way */
+#define MCI_CONTROL_QUEUE_LENGTH       (8u)
+
+/* PD gains in 1/256, the derivative per edge per ms */
+typedef struct
+{
+    int32_t kpQ8;
+    int32_t kdQ8;
+} mci_control_gains_t;
+
+/* kinds of queued move */
+typedef enum
+{
+    MCI_CONTROL_COMMAND_STRAIGHT = 0u,
+    MCI_CONTROL_COMMAND_ARC,
+    MCI_CONTROL_COMMAND_ROTATE
+} mci_control_command_type_t;
+
+/* move queued for the loop, see mci_ControlPush() */
+typedef struct
+{
+    mci_control_command_type_t type;
+    mci_profile_params_t profile;  /* both wheels' edges summed, the start */
+                                   /* velocity is what the last move left */
+    int32_t curvatureQ16;          /* arc: b / 2r in 1/65536, + right */
+    bool right;                    /* rotate: true to turn right */
+    mci_control_gains_t gains;     /* heading, or the turn on the spot */
+    uint8_t tag;                   /* the caller's, handed back below */
+} mci_control_command_t;
+
+/* where the loop is w/ the queued moves */
+typedef struct
+{
+    uint32_t queued;           /* waiting behind the move under way */
+    uint32_t started;          /* queued moves started since power up */
+    uint32_t finished;         /* queued moves done since power up */
+    uint32_t stops;            /* times the queue was dropped */
+    int32_t remaining;         /* left of the straight or arc under way */
+    int32_t queuedDistance;    /* of the straights and arcs waiting */
+    uint8_t tag;               /* of the queued move last started */
+} mci_control_queue_state_t;
+
+/* timing of the control loop since the stats were cleared */
+typedef struct
+{
+    uint32_t rateHz;           /* control ticks per second */
+    uint32_t tickCount;        /* ticks measured */
+    uint32_t overrunCount;     /* ticks the loop ran into the next one */
+    uint32_t maxLatencyNs;     /* tick to loop start, longest */
+    uint32_t jitterNs;         /* spread of the loop start */
+    uint32_t maxRunNs;         /* loop run time, longest */
+} mci_control_stats_t;
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+void mci_InitControl(void);
+void mci_ControlStartStraight(const mci_profile_params_t* p_profile,
+    const mci_control_gains_t* p_gains);
+void mci_ControlStartArc(const mci_profile_params_t* p_profile,
+    int32_t curvatureQ16, const mci_control_gains_t* p_gains);
+void mci_ControlStartRotate(const mci_profile_params_t* p_profile,
+    bool right, const mci_control_gains_t* p_gains);
+bool mci_ControlPush(const mci_control_command_t* p_command);
+void mci_GetControlQueueState(mci_control_queue_state_t* p_state);
+void mci_ControlSetSteering(int32_t steering);
+void mci_ControlStop(void);
+bool mci_ControlIsDone(void);
+void mci_ControlWait(void);
+int32_t mci_ControlGetDistance(void);
+int32_t mci_ControlSpeedToVelocity(uint16_t speed);
+uint32_t mci_ControlGetRateHz(void);
+void mci_GetControlStats(mci_control_stats_t* p_stats);
+void mci_ClearControlStats(void);
+void mci_PrintControlStats(void);
+
+#endif /* CONTROL_MCI_H_ */
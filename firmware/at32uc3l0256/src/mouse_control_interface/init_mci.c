@@ -25,6 +25,8 @@
 #include "mouse_hardware_interface/power_mhi.h"
 #include "mouse_hardware_interface/irsensors_mhi.h"
 #include "mouse_hardware_interface/motors_mhi.h"
+#include "mouse_control_interface/profile_mci.h"
+#include "mouse_control_interface/control_mci.h"
 #include "mouse_control_interface/init_mci.h"
 
 /*----------------------------------------------------------------------------*/
@@ -75,6 +77,9 @@ void mci_InitializeMouse(void)
     mhi_InitWheelMotors();
     mhi_InitVacuumMotor();
     
+    /* run the motion control loop on the timer counter tick */
+    mci_InitControl();
+    
     /* enable global interrupts */
     mhi_EnableGlobalInterrupts();
     
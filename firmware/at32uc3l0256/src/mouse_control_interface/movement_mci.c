@@ -8,6 +8,31 @@
 * This is the header file for mouse movement under the mouse control
 * interface.
 *
+* The moves hand their setpoints to the control loop in control_mci.c, which
+* drives the motors from the timer counter interrupt at a fixed rate. Each
+* move is a motion profile up to the velocity of its speed profile PWM and
+* back down to rest at its target. While
+* a straight move drives, the move reads the side walls and hands the loop
+* the steering, and the 1 square move checks the walls ahead as well.
+*
+* The 1 square move can turn off into the square beside the one it drives
+* into w/o stopping: its midpoint task sets the search turn, and the move
+* takes it as an arc from the wall gap it is in to the one at the side,
+* then drives the half square on to the centre. The arc and the half
+* square chain on from the straight at the forward speed.
+*
+* The mci_Queue*() moves are handed to the control loop's queue and return
+* straight away, see control_mci.h: the loop drives them back to back and
+* carries the velocity from one straight or arc into the next. The caller
+* keeps calling mci_RunMotionQueue(), which steers the straight under way
+* off the side walls. The blocking moves queue themselves and wait.
+*
+* Every move is a target relative to where the last one should have ended,
+* on the wheels' edge counts the pose is worked out from, see
+* odometry_mci.h, so whatever a move is left short or over is made up by
+* the next one. Only a stop, squaring up to a wall or putting the mouse
+* down in the start cell starts the moves over from where the wheels are.
+*
 * The mouse control interface uses the mouse hardware interface to define high
 * level micromouse functionality.
 *-----------------------------------------------------------------------------*/
@@ -15,25 +40,56 @@
 /*----------------------------------------------------------------------------*/
 /*                               Include Files                                */
 /*----------------------------------------------------------------------------*/
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <math.h>
 #include "micromouse_dimensions.h"
-#include "shared_functions/constrain_sf.h"
 #include "mouse_hardware_interface/leds_mhi.h"
 #include "mouse_hardware_interface/usart_mhi.h"
 #include "mouse_hardware_interface/irsensors_mhi.h"
 #include "mouse_control_interface/walldetection_mci.h"
 #include "mouse_hardware_interface/motors_mhi.h"
 #include "mouse_hardware_interface/interrupts_mhi.h"
+#include "mouse_hardware_interface/timer_mhi.h"
+#include "mouse_control_interface/profile_mci.h"
+#include "mouse_control_interface/control_mci.h"
+#include "mouse_control_interface/odometry_mci.h"
 #include "mouse_control_interface/movement_mci.h"
 #include "mouse_control_interface/walldetection_mci.h"
 
 /*----------------------------------------------------------------------------*/
 /*                                Definitions                                 */
 /*----------------------------------------------------------------------------*/
-/* None */
+/* side wall steering of a straight move, gains per ms like the control loop */
+typedef struct
+{
+    float kpBoth;           /* both side walls in view */
+    float kdBoth;
+    float kpSide;           /* one side wall in view */
+    float kdSide;
+    int32_t sideOffset;     /* added to the threshold w/ one wall in view */
+    int32_t sideBoost;      /* error scale when too far from that wall */
+    int32_t leftScale;      /* error scale, left wall alone */
+    int32_t rightScale;     /* error scale, right wall alone */
+    bool useBothWalls;      /* steer between both walls */
+} mci_steering_t;
+
+/* steering error last handed to the loop */
+typedef struct
+{
+    int32_t prevError;
+    uint32_t prevTimerCount;
+} mci_steering_state_t;
+
+/* steering of a queued move, its control command tag */
+typedef enum
+{
+    MCI_MOVE_STEER_NONE = 0u,       /* turns and arcs */
+    MCI_MOVE_STEER_HALF_SQUARE,
+    MCI_MOVE_STEER_DIAGONAL
+} mci_move_steer_t;
 
 /*----------------------------------------------------------------------------*/
 /*                               Debug Switches                               */
@@ -44,12 +100,94 @@
 /*----------------------------------------------------------------------------*/
 /*                              Global Variables                              */
 /*----------------------------------------------------------------------------*/
-/* None */
+/* run once by the next 1 square move, see mci_SetMoveMidpointTask() */
+static mci_move_task_t moveMidpointTask = NULL;
+/* set by the midpoint task, see mci_SetMoveSearchTurn() */
+static mci_search_turn_t moveSearchTurn = MCI_SEARCH_TURN_NONE;
+/* PWM the moves cruise at, see mci_SetSpeedProfile() */
+static mci_speed_profile_t speedProfile =
+{
+    .forwardSpeed = MCI_FORWARD_FAST_SPEED,
+    .turnSpeed = MCI_TURN_SPEED,
+};
+
+/* heading PD of the straight moves: kp 2, kd 0.2 */
+static const mci_control_gains_t straightGains =
+{
+    .kpQ8 = 512,
+    .kdQ8 = 51,
+};
+/* PD keeping the turns on the spot: kp 1, kd 0.25 */
+static const mci_control_gains_t turnGains =
+{
+    .kpQ8 = 256,
+    .kdQ8 = 64,
+};
+
+/* 1 square move: pushed hard off a lone wall */
+static const mci_steering_t squareSteering =
+{
+    .kpBoth = 0.1f,
+    .kdBoth = 0.01f,
+    .kpSide = 0.1f,
+    .kdSide = 0.01f,
+    .sideOffset = 60,
+    .sideBoost = 5,
+    .leftScale = 2,
+    .rightScale = 3,
+    .useBothWalls = true,
+};
+/* half square moves */
+static const mci_steering_t halfSquareSteering =
+{
+    .kpBoth = 0.05f,
+    .kdBoth = 0.01f,
+    .kpSide = 0.5f,
+    .kdSide = 5.0f,
+    .sideOffset = 0,
+    .sideBoost = 1,
+    .leftScale = 1,
+    .rightScale = 1,
+    .useBothWalls = true,
+};
+/* diagonals: one side wall is in view at a time */
+static const mci_steering_t diagonalSteering =
+{
+    .kpBoth = 0.0f,
+    .kdBoth = 0.0f,
+    .kpSide = 0.1f,
+    .kdSide = 5.0f,
+    .sideOffset = 0,
+    .sideBoost = 1,
+    .leftScale = 2,
+    .rightScale = 2,
+    .useBothWalls = false,
+};
+
+/* steering of each queued move, by its tag */
+static const mci_steering_t* const queueSteering[] =
+{
+    [MCI_MOVE_STEER_NONE] = NULL,
+    [MCI_MOVE_STEER_HALF_SQUARE] = &halfSquareSteering,
+    [MCI_MOVE_STEER_DIAGONAL] = &diagonalSteering,
+};
+/* queued move mci_RunMotionQueue() steers, counted by the loop */
+static uint32_t queueSteeringMove = 0u;
+static mci_steering_state_t queueSteeringState;
 
 /*----------------------------------------------------------------------------*/
 /*                    Private (Static) Function Prototype                     */
 /*----------------------------------------------------------------------------*/
-/* None */
+static void mci_GetStraightProfile(int32_t distanceEdges,
+    mci_profile_params_t* p_profile);
+static void mci_Rotate(int32_t wheelEdges, bool right);
+static void mci_SearchTurn(bool right);
+static void mci_DriveStraight(int32_t distanceEdges, mci_move_steer_t steer);
+static bool mci_QueueStraight(int32_t distanceEdges, mci_move_steer_t steer);
+static bool mci_QueueRotate(int32_t wheelEdges, bool right);
+static void mci_StartSteering(mci_steering_state_t* p_state);
+static void mci_UpdateSteering(const mci_steering_t* p_steering,
+    mci_steering_state_t* p_state);
 
 /*----------------------------------------------------------------------------*/
 /*                       Public (Exportable) Functions                        */
@@ -64,70 +202,15 @@
 */
 void mci_MoveForward1Revolution(void)
 {
-    uint32_t rightDone = 0u;
-    uint32_t leftDone = 0u;
-    
-    /* reset encoder counts */
-    mhi_ClearEncoder1EdgeCount();
-    mhi_ClearEncoder2EdgeCount();
-    
-    /* set speed and start in forward direction */
-    mhi_SetWheelMotor1Speed(MCI_MINIMUM_SPEED);
-    mhi_StartWheelMotor1Forward();
-    mhi_SetWheelMotor2Speed(MCI_MINIMUM_SPEED);
-    mhi_StartWheelMotor2Forward();
+    mci_profile_params_t profile;
     
-    /* keep moving motors until encoder edge counts are reached */
-    while((!rightDone) || (!leftDone))
-    {
-        /* right motor */
-        if ((!rightDone) && (mhi_GetEncoder1EdgeCount() >= MCI_WHEEL_MOTOR_EDGES_PER_REVOLUTION))
-        {
-            mhi_StopWheelMotor1();
-            rightDone = 1u;
-            mhi_PrintString("stopped motor 1: ");
-            mhi_PrintInt(mhi_GetEncoder1EdgeCount());
-            mhi_PrintString("\r\n");
-        }
-        else if (mhi_GetEncoder1EdgeCount() >= (MCI_WHEEL_MOTOR_EDGES_PER_REVOLUTION / 3))
-        {
-            mhi_SetWheelMotor1Speed(MCI_FORWARD_FAST_SPEED);
-        }
-        else if (mhi_GetEncoder1EdgeCount() >= ((MCI_WHEEL_MOTOR_EDGES_PER_REVOLUTION / 3) * 2))
-        {
-            mhi_SetWheelMotor1Speed(MCI_MINIMUM_SPEED);
-        }
-        
-        /* left motor */
-        if ((!leftDone) && (mhi_GetEncoder2EdgeCount() >= MCI_WHEEL_MOTOR_EDGES_PER_REVOLUTION))
-        {
-            mhi_StopWheelMotor2();
-            leftDone = 1u;
-            mhi_PrintString("stopped motor 2: ");
-            mhi_PrintInt(mhi_GetEncoder2EdgeCount());
-            mhi_PrintString("\r\n");
-        }
-        else if (mhi_GetEncoder2EdgeCount() >= (MCI_WHEEL_MOTOR_EDGES_PER_REVOLUTION / 3))
-        {
-            mhi_SetWheelMotor2Speed(MCI_FORWARD_FAST_SPEED);
-        }
-        else if (mhi_GetEncoder2EdgeCount() >= ((MCI_WHEEL_MOTOR_EDGES_PER_REVOLUTION / 3) * 2))
-        {
-            mhi_SetWheelMotor2Speed(MCI_MINIMUM_SPEED);
-        }
-    }
+    mci_GetStraightProfile(MCI_WHEEL_MOTOR_EDGES_PER_REVOLUTION * 2, &profile);
+    mci_ControlStartStraight(&profile, &straightGains);
+    mci_ControlWait();
     
     mhi_PrintString("final: ");
-    mhi_PrintInt(mhi_GetEncoder1EdgeCount());
-    mhi_PrintString(" ");
-    mhi_PrintInt(mhi_GetEncoder2EdgeCount());
+    mhi_PrintInt((uint32_t)mci_ControlGetDistance());
     mhi_PrintString("\r\n");
-    
-    /* clear encoder edge counts and set motor speeds to 0 */
-    mhi_ClearEncoder1EdgeCount();
-    mhi_ClearEncoder2EdgeCount();
-    mhi_SetWheelMotor1Speed(0);
-    mhi_SetWheelMotor2Speed(0);
 }
 
 
@@ -139,83 +222,31 @@ void mci_MoveForward1Revolution(void)
 */
 void mci_MoveForward1MazeSquarePid(void)
 {
-    /* initialize encoder PID constants (integral term not needed) */
-    float kp = 2;      /* proportional term */
-    float kd = 0.2;    /* derivative term */
-    
-    /* initialize sensor PD constants */
-    float kpSensor = 0.1;
-    float kdSensor = 0.01;
-    
-    /* initialize left sensor PD constants */
-    float kpSensorL = 0.1; // was 5
-    float kdSensorL = 0.01;
-    
-    /* initialize right sensor PD constants */
-    float kpSensorR = 0.1; // was 5
-    float kdSensorR = 0.01;
-    
-    /* other encoder PID variables */
-    int32_t initialPosition = mhi_GetEncoder1EdgeCount() + mhi_GetEncoder2EdgeCount();
-    int32_t targetPosition = initialPosition + (MCI_WHEEL_MOTOR_EDGES_PER_MAZE_SQUARE * 2);
-    int32_t targetAngle = 0;
-    int32_t prevError = 0;
-    float error = 0;
-    float dError = 0;
-    
-    /* other sensor PD variables */
-    int32_t output = 0;
-    int32_t outputSensors = 0;
-    int32_t prevErrorSensors = 0;
-    int32_t errorSensors = 0;
-    int32_t dErrorSensors = 0;
-    
-    /* other left sensor PD variables */
-    int32_t errorSensorLeft = 0;
-    
-    /* other right sensor PD variables */
-    int32_t errorSensorRight = 0;
-    
-    /* new motor speeds provided all PDs */
-    int32_t newLeftSpeed = 0;
-    int32_t newRightSpeed = 0;
-    
-    /* IR sensor variables */
-    uint32_t ir2Reading = 0u;
-    uint32_t ir3Reading = 0u;
-    
-    /* local wall presence variables */
-    mci_wall_presence_t leftWall = MCI_CANNOT_READ_WALL;
-    mci_wall_presence_t rightWall = MCI_CANNOT_READ_WALL;
-    
-    /* configure both motors to move forward at base speed */
-    mhi_SetWheelMotor1Speed(MCI_FORWARD_FAST_SPEED);
-    mhi_SetWheelMotor2Speed(MCI_FORWARD_FAST_SPEED);
-    mhi_StartWheelMotor1Forward();
-    mhi_StartWheelMotor2Forward();
+    int32_t targetPosition = MCI_WHEEL_MOTOR_EDGES_PER_MAZE_SQUARE * 2;
+    mci_profile_params_t profile;
+    mci_steering_state_t steeringState;
     
     /* allow wall updates on start */
     mci_SetLeftWallUpdateAvailable();
     mci_SetRightWallUpdateAvailable();
     
-    /* set up target and initial position */
-    mhi_ClearEncoder1EdgeCount();
-    mhi_ClearEncoder2EdgeCount();
-    initialPosition = mhi_GetEncoder1EdgeCount() + mhi_GetEncoder2EdgeCount();
-    targetPosition = initialPosition + (MCI_WHEEL_MOTOR_EDGES_PER_MAZE_SQUARE * 2);
+    /* hand the move to the control loop */
+    mci_GetStraightProfile(targetPosition, &profile);
+    mci_StartSteering(&steeringState);
+    mci_ControlStartStraight(&profile, &straightGains);
     
-    
-    /* main control loop */
-    while ((mhi_GetEncoder1EdgeCount() + mhi_GetEncoder2EdgeCount()) < targetPosition)
+    /* read the walls while the control loop drives */
+    while (!mci_ControlIsDone())
     {
         /* stop if there's a wall in front */
         if (((mhi_ReadIr1() + mhi_ReadIr4()) / 2) >= MCI_FRONT_WALL_TOO_CLOSE_THRESHOLD_RAW_30MM_HARD_CODED)
         {
+            mci_ControlStop();
             break;
         }
         
         /* prevent wall updates if moved more than 50% */
-        if ( (mhi_GetEncoder1EdgeCount() + mhi_GetEncoder2EdgeCount()) > ((uint32_t)(targetPosition / 2)) )
+        if (mci_ControlGetDistance() > (targetPosition / 2))
         {
             mci_SetLeftWallUpdateUnavailable();
             mci_SetRightWallUpdateUnavailable();
@@ -225,183 +256,46 @@ void mci_MoveForward1MazeSquarePid(void)
         mci_CheckLeftWall();
         mci_CheckRightWall();
         
-        /* check for walls for PID move forward */
-        leftWall = mci_CheckLeftWallMoveForwardPid();
-        rightWall = mci_CheckRightWallMoveForwardPid();
-        
-        //output error sensors
-        if ((leftWall == MCI_WALL_FOUND) && (rightWall == MCI_WALL_FOUND))
-        {   
-            mhi_ClearD2Led();
-            mhi_ClearD3Led();
-            mhi_SetD1Led();
-            
-            /* read left wall sensor */
-            ir2Reading = mhi_ReadIr2();
-            
-            /* read right wall sensor */
-            ir3Reading = mhi_ReadIr3();
-            
-            // Error with the sensors
-            errorSensorLeft =  MCI_LEFT_SENSOR_READING_THRESHOLD_RAW - ir2Reading;
-            errorSensorRight = MCI_RIGHT_SENSOR_READING_THRESHOLD_RAW - ir3Reading;
-            errorSensors =  errorSensorRight - errorSensorLeft;
-            dErrorSensors = errorSensors - prevErrorSensors;
-            
-            // Current way of trying to add a pid controller to the mouse using the sensors going to aggregate with the other output
-            outputSensors = (kpSensor * errorSensors) + (kdSensor * dErrorSensors);
-            
-            prevErrorSensors = errorSensors;
-        }
-        
-        else if ((leftWall == MCI_WALL_FOUND) && (rightWall != MCI_WALL_FOUND)) 
-        {   
-            mhi_ClearD1Led();
-            mhi_ClearD3Led();
-            mhi_SetD2Led();
-            
-            //Read left one
-            ir2Reading = mhi_ReadIr2();
-             
-            //error with just left sensor
-            errorSensorLeft = (MCI_LEFT_SENSOR_READING_THRESHOLD_RAW+60) - ir2Reading;//gets larger as closer so if 100-81 means we close to left wall negative we push
-            if(errorSensorLeft>0){
- 			errorSensorLeft*=5;
-	 		}
-			errorSensors = -errorSensorLeft * 2;
-			if(errorSensors<0){
-				mhi_PrintString("ir2: ");
-				mhi_PrintInt((uint32_t)ir2Reading);
-				mhi_PrintString("\t");
-				mhi_PrintString("errorSensors: -");
-				mhi_PrintInt((uint32_t)abs(errorSensors));
-				mhi_PrintString("\r\n");
-			}
-			else{
-				mhi_PrintString("ir2: ");
-				mhi_PrintInt((uint32_t)ir2Reading);
-				mhi_PrintString("\t");
-				mhi_PrintString("errorSensors: ");
-				mhi_PrintInt((uint32_t)abs(errorSensors));
-				mhi_PrintString("\r\n");
-			}
-            dErrorSensors = errorSensors - prevErrorSensors;
-            outputSensors = (kpSensorL * errorSensors) + (kdSensorL * dErrorSensors);
-            // 			 if(targetAngle - (g_sbu_mm_Motor1EncoderEdgeCount - g_sbu_mm_Motor2EncoderEdgeCount) < -45){
-            // 				outputSensors*=-1;
-            // 			 }
-            prevErrorSensors = errorSensors;
-        }
-         
-        else if ((rightWall == MCI_WALL_FOUND) && (leftWall != MCI_WALL_FOUND))
+        /* side walls are latched past 50%, hand the spare time to the task */
+        if ((moveMidpointTask != NULL)
+            && (mci_ControlGetDistance() > (targetPosition / 2)))
         {
-            mhi_ClearD1Led();
-            mhi_ClearD2Led();
-            mhi_SetD3Led();
+            mci_move_task_t task = moveMidpointTask;
             
-            //Read Right one
-            ir3Reading = mhi_ReadIr3();
-             
-            errorSensorRight = (MCI_RIGHT_SENSOR_READING_THRESHOLD_RAW+60) - ir3Reading; //if negative means close to right wall we push
- 			if(errorSensorRight>0){
- 				errorSensorRight*=5;
- 			}
-            errorSensors = errorSensorRight * 3;
-			if(errorSensors<0){
- 				mhi_PrintString("ir3: ");
- 				mhi_PrintInt((uint32_t)ir3Reading);
- 				mhi_PrintString("\t");
- 				mhi_PrintString("errorSensors: -");
- 				mhi_PrintInt((uint32_t)abs(errorSensors));
- 				mhi_PrintString("\r\n");	
-			}
-			else{
- 				mhi_PrintString("ir3: ");
- 				mhi_PrintInt((uint32_t)ir3Reading);
- 				mhi_PrintString("\t");
- 				mhi_PrintString("errorSensors: ");
- 				mhi_PrintInt((uint32_t)abs(errorSensors));
- 				mhi_PrintString("\r\n");
-			}
-			
-            //errorSensors = errorSensorRight;
-            dErrorSensors = errorSensors - prevErrorSensors;
-			
-            outputSensors = (kpSensorR * errorSensors) + (kdSensorR * dErrorSensors);
-            // 			  if(targetAngle - (g_sbu_mm_Motor1EncoderEdgeCount - g_sbu_mm_Motor2EncoderEdgeCount) < 45){
-            // 				  outputSensors*=-1;
-            // 			  }
-            prevErrorSensors = errorSensors;
-// 			if(outputSensors < 0)
-// 				mhi_PrintString("OutputSensors: -");
-// 			else
-// 				mhi_PrintString("OutputSensors: ");
-// 			mhi_PrintInt(abs(outputSensors));
-        }
-        
-        else 
-        {
-            outputSensors = 0;
-            prevErrorSensors = 0;
-        }
-        
-        /* calculate error (for proportional term) */
-        error = targetAngle - ((int32_t)mhi_GetEncoder1EdgeCount() - (int32_t)mhi_GetEncoder2EdgeCount());
-        
-        /* calculate difference in error (for the derivative term) */
-		error += outputSensors;
-        dError = error - prevError;
-        prevError = error;
-        
-        /* calculate PID output */
-        output = (kp * error) + (kd * dError);
-        
-        /* calculate new speeds */
-        newLeftSpeed = sf_constrain(MCI_MINIMUM_SPEED + output, 255, -255);
-        newRightSpeed = sf_constrain(MCI_MINIMUM_SPEED - output, 255, -255);
-//         if(newLeftSpeed < 0)
-// 			mhi_PrintString("newLeftSpeed: -");
-// 		else
-// 			mhi_PrintString("newLeftSpeed: ");
-//          mhi_PrintInt(abs(newLeftSpeed));
-//          mhi_PrintString("\r\n");
-// 		 
-// 		 if(newRightSpeed < 0)
-// 			mhi_PrintString("newRightSpeed: -");
-// 		 else
-// 			mhi_PrintString("newRightSpeed: ");
-//          mhi_PrintInt(abs(newRightSpeed));
-//          mhi_PrintString("\r\n");
-//         
-        /* set new motor speeds */
-        if (newLeftSpeed < 0)
-        {
-            mhi_SetWheelMotor1Speed((uint16_t)abs(newLeftSpeed));
-            mhi_StartWheelMotor1Backward();
-        }
-        else
-        {
-            mhi_SetWheelMotor1Speed((uint16_t)newLeftSpeed);
-            mhi_StartWheelMotor1Forward();
+            moveMidpointTask = NULL;
+            task();
+            
+            /* the task may have the move turn off, it is in the gap now */
+            if (moveSearchTurn != MCI_SEARCH_TURN_NONE)
+            {
+                break;
+            }
         }
         
-        if (newRightSpeed < 0)
-        {
-            mhi_SetWheelMotor2Speed((uint16_t)abs(newRightSpeed));
-            mhi_StartWheelMotor2Backward();
-        }
-        else
-        {
-            mhi_SetWheelMotor2Speed((uint16_t)newRightSpeed);
-            mhi_StartWheelMotor2Forward();
-        }
+        /* steer off the side walls */
+        mci_UpdateSteering(&squareSteering, &steeringState);
+    }
+    
+    /* a move stopped short by a front wall never got to the task */
+    moveMidpointTask = NULL;
+    
+    if (moveSearchTurn == MCI_SEARCH_TURN_RIGHT)
+    {
+        mci_SearchTurnRight90Degrees();
+    }
+    else if (moveSearchTurn == MCI_SEARCH_TURN_LEFT)
+    {
+        mci_SearchTurnLeft90Degrees();
     }
+    else
+    {
+        return;
+    }
+    moveSearchTurn = MCI_SEARCH_TURN_NONE;
     
-    /* clear encoder edge counts and set motor speeds to 0 */
-    mhi_StopWheelMotor1();
-    mhi_StopWheelMotor2();
-    mhi_ClearEncoder1EdgeCount();
-    mhi_ClearEncoder2EdgeCount();    
+    /* on to the centre of the square at the side */
+    mci_DriveStraight(MCI_WHEEL_MOTOR_EDGES_PER_HALF_SQUARE,
+        MCI_MOVE_STEER_HALF_SQUARE);
 }
 
 /**
@@ -412,45 +306,10 @@ void mci_MoveForward1MazeSquarePid(void)
 */
 void mci_TurnRight90Degrees(void)
 {
-    uint32_t rightDone = 0u;
-    uint32_t leftDone = 0u;
-    
-    /* reset encoder counts */
-    mhi_ClearEncoder1EdgeCount();
-    mhi_ClearEncoder2EdgeCount();
-    
-    /* set motor directions and speeds */
-    mhi_SetWheelMotor1Speed(MCI_TURN_SPEED);
-    mhi_SetWheelMotor2Speed(MCI_TURN_SPEED);
-    mhi_StartWheelMotor1Forward();
-    mhi_StartWheelMotor2Backward();
-    
-    /* keep moving motors until encoder edge counts are reached */
-    while ((!rightDone) || (!leftDone))
-    {      
-        if ((!rightDone) && (mhi_GetEncoder1EdgeCount() == 
-            MCI_WHEEL_MOTOR_EDGES_PER_90_DEGREE_TURN_RIGHT))
-        {
-            mhi_StopWheelMotor1();
-            rightDone = 1u;
-        }
-        if ((!leftDone) && (mhi_GetEncoder2EdgeCount() == 
-            (-MCI_WHEEL_MOTOR_EDGES_PER_90_DEGREE_TURN_RIGHT)))
-        {
-            mhi_StopWheelMotor2();
-            leftDone = 1u;
-        }
-    }
+    mci_Rotate(MCI_WHEEL_MOTOR_EDGES_PER_90_DEGREE_TURN_RIGHT, true);
     
     /* update wall presences */
     mci_UpdateWallPresenceRightTurn();
-    
-    
-    /* clear encoder edge counts and set motor speeds to 0 */
-    mhi_StopWheelMotor1();
-    mhi_StopWheelMotor2();
-    mhi_ClearEncoder1EdgeCount();
-    mhi_ClearEncoder2EdgeCount();
 }
 
 /**
@@ -461,42 +320,10 @@ void mci_TurnRight90Degrees(void)
 */
 void mci_TurnLeft90Degrees(void)
 {
-    uint32_t rightDone = 0u;
-    uint32_t leftDone = 0u;
-    
-    /* reset encoder counts */
-    mhi_ClearEncoder1EdgeCount();
-    mhi_ClearEncoder2EdgeCount();
-    
-    /* set motor directions and speeds */
-    mhi_SetWheelMotor1Speed(MCI_TURN_SPEED);
-    mhi_SetWheelMotor2Speed(MCI_TURN_SPEED);
-    mhi_StartWheelMotor1Backward();
-    mhi_StartWheelMotor2Forward();
-    
-    /* keep moving motors until encoder edge counts are reached */
-    while ((!rightDone) || (!leftDone))
-    {    
-        if ((!rightDone) && (mhi_GetEncoder1EdgeCount() == (-MCI_WHEEL_MOTOR_EDGES_PER_90_DEGREE_TURN_LEFT)))
-        {
-            mhi_StopWheelMotor1();
-            rightDone = 1u;
-        }
-        if ((!leftDone) && (mhi_GetEncoder2EdgeCount() == MCI_WHEEL_MOTOR_EDGES_PER_90_DEGREE_TURN_LEFT))
-        {
-            mhi_StopWheelMotor2();
-            leftDone = 1u;
-        }
-    }
+    mci_Rotate(MCI_WHEEL_MOTOR_EDGES_PER_90_DEGREE_TURN_LEFT, false);
     
     /* update wall presences */
     mci_UpdateWallPresenceLeftTurn();
-    
-    /* clear encoder edge counts and set motor speeds to 0 */
-    mhi_StopWheelMotor1();
-    mhi_StopWheelMotor2();
-    mhi_ClearEncoder1EdgeCount();
-    mhi_ClearEncoder2EdgeCount();
 }
 
 /**
@@ -562,11 +389,35 @@ void mci_AdjustToFrontWall(void)
         }	
 //    }
     
-    /* clear encoder edge counts and set motor speeds to 0 */
-    mhi_ClearEncoder1EdgeCount();
-    mhi_ClearEncoder2EdgeCount();
+    /* set motor speeds to 0 */
     mhi_SetWheelMotor1Speed(0);
     mhi_SetWheelMotor2Speed(0);
+    
+    /* square w/ the wall: the next move starts from here, and the pose */
+    /* faces along the maze grid */
+    mci_ControlStop();
+    mci_AlignPoseHeading();
+}
+
+/**
+* The mouse was put down in the start cell, facing the way runs start
+*
+* The pose starts over at 0, and the next move from where the wheels are.
+*
+* \param None
+* \retval None
+*/
+void mci_PlaceAtStart(void)
+{
+    const mci_pose_t startPose =
+    {
+        .xUm = 0,
+        .yUm = 0,
+        .heading = 0u,
+    };
+    
+    mci_ControlStop();
+    mci_SetPose(&startPose);
 }
 
 /**
@@ -626,49 +477,17 @@ mci_wall_presence_t mci_CheckRightWallMoveForwardPid(void)
 }
 
 
+
 /** 
 * Rotate micromouse 45 degrees to the right 
 *
 * @param none
 * @return none
 */
-void mci_TurnRight45Degrees(void){
-	uint32_t rightDone = 0u;
-	uint32_t leftDone = 0u;
-	
-	/* reset encoder counts */
-	mhi_ClearEncoder1EdgeCount();
-	mhi_ClearEncoder2EdgeCount();
-	
-	/* set motor directions and speeds */
-	mhi_SetWheelMotor1Speed(MCI_TURN_SPEED);
-	mhi_SetWheelMotor2Speed(MCI_TURN_SPEED);
-	mhi_StartWheelMotor1Forward();
-	mhi_StartWheelMotor2Backward();
-	
-	/* keep moving motors until encoder edge counts are reached */
-	while ((!rightDone) || (!leftDone))
-	{
-		if ((!rightDone) && (mhi_GetEncoder1EdgeCount() == MCI_WHEEL_MOTOR_EDGES_PER_45_DEGREE_TURN_RIGHT))
-		{
-			mhi_StopWheelMotor1();
-			rightDone = 1u;
-		}
-		if ((!leftDone) && (mhi_GetEncoder2EdgeCount() == (-MCI_WHEEL_MOTOR_EDGES_PER_45_DEGREE_TURN_RIGHT)))
-		{
-			mhi_StopWheelMotor2();
-			leftDone = 1u;
-		}
-	}
-	
-	/* update wall presences */
-// 	mci_UpdateWallPresenceLeftTurn(); Leftover from 90 deg turn might not need to use since this will only be used during fast traversal
-	
-	/* clear encoder edge counts and set motor speeds to 0 */
-	mhi_StopWheelMotor1();
-	mhi_StopWheelMotor2();
-	mhi_ClearEncoder1EdgeCount();
-	mhi_ClearEncoder2EdgeCount();
+void mci_TurnRight45Degrees(void)
+{
+    /* no wall update, only used during fast traversal */
+    mci_Rotate(MCI_WHEEL_MOTOR_EDGES_PER_45_DEGREE_TURN_RIGHT, true);
 }
 
 /**
@@ -677,564 +496,382 @@ void mci_TurnRight45Degrees(void){
 * @param none
 * @return none
 */
-
-void mci_TurnLeft45Degrees(void){
-	uint32_t rightDone = 0u;
-	uint32_t leftDone = 0u;
-	    
-	/* reset encoder counts */
-	mhi_ClearEncoder1EdgeCount();
-	mhi_ClearEncoder2EdgeCount();
-	    
-	/* set motor directions and speeds */
-	mhi_SetWheelMotor1Speed(MCI_TURN_SPEED);
-	mhi_SetWheelMotor2Speed(MCI_TURN_SPEED);
-	mhi_StartWheelMotor1Backward();
-	mhi_StartWheelMotor2Forward();
-	    
-	/* keep moving motors until encoder edge counts are reached */
-	while ((!rightDone) || (!leftDone))
-	{
-		if ((!rightDone) && (mhi_GetEncoder1EdgeCount() == (-MCI_WHEEL_MOTOR_EDGES_PER_45_DEGREE_TURN_LEFT)))
-		{
-			mhi_StopWheelMotor1();
-			rightDone = 1u;
-		}
-		if ((!leftDone) && (mhi_GetEncoder2EdgeCount() == MCI_WHEEL_MOTOR_EDGES_PER_45_DEGREE_TURN_LEFT))
-		{
-			mhi_StopWheelMotor2();
-			leftDone = 1u;
-		}
-	}
-	    
-	/* update wall presences */
-// 	    mci_UpdateWallPresenceLeftTurn(); Left over from regular 90 deg turn
-	    
-	/* clear encoder edge counts and set motor speeds to 0 */
-	mhi_StopWheelMotor1();
-	mhi_StopWheelMotor2();
-	mhi_ClearEncoder1EdgeCount();
-	mhi_ClearEncoder2EdgeCount();
-	
+void mci_TurnLeft45Degrees(void)
+{
+    /* no wall update, only used during fast traversal */
+    mci_Rotate(MCI_WHEEL_MOTOR_EDGES_PER_45_DEGREE_TURN_LEFT, false);
 }
 
 //TODO work in progress for diagonal movement
 void mci_MoveCentertoCenterPid(void){
-	/* initialize encoder PID constants (integral term not needed) */
-	float kp = 2;      /* proportional term */
-	float kd = 0.2;    /* derivative term */
-	    
-	/* initialize sensor PD constants */
-	float kpSensor = 0.1; //might have been 0.05
-	float kdSensor = 0.01;
-	    
-	/* initialize left sensor PD constants */
-	float kpSensorL = 0.1; // was 5
-	float kdSensorL = 5;
-	    
-	/* initialize right sensor PD constants */
-	float kpSensorR = 0.1; // was 5
-	float kdSensorR = 5;
-	    
-	/* other encoder PID variables */
-	int32_t initialPosition = mhi_GetEncoder1EdgeCount() + mhi_GetEncoder2EdgeCount();
-	int32_t targetPosition = initialPosition + (112*2);
-	int32_t targetAngle = 0;
-	int32_t prevError = 0;
-	float error = 0;
-	float dError = 0;
-	    
-	/* other sensor PD variables */
-	int32_t output = 0;
-	int32_t outputSensors = 0;
-	int32_t prevErrorSensors = 0;
-	int32_t errorSensors = 0;
-	float dErrorSensors = 0;
-	    
-	/* other left sensor PD variables */
-	float errorSensorLeft = 0;
-	    
-	/* other right sensor PD variables */
-	float errorSensorRight = 0;
-	    
-	/* new motor speeds provided all PDs */
-	int32_t newLeftSpeed = 0;
-	int32_t newRightSpeed = 0;
-	    
-	/* IR sensor variables */
-	uint32_t ir2Reading = 0u;
-	uint32_t ir3Reading = 0u;
-	    
-	/* local wall presence variables */
-	mci_wall_presence_t leftWall = MCI_CANNOT_READ_WALL;
-	mci_wall_presence_t rightWall = MCI_CANNOT_READ_WALL;
-	    
-	/* configure both motors to move forward at base speed */
-	mhi_SetWheelMotor1Speed(MCI_FORWARD_FAST_SPEED);
-	mhi_SetWheelMotor2Speed(MCI_FORWARD_FAST_SPEED);
-	mhi_StartWheelMotor1Forward();
-	mhi_StartWheelMotor2Forward();
-	    
-	/*regular moveforward allow wall updates on start dont think this is needed for this function*/
-// 	mci_SetLeftWallUpdateAvailable();
-// 	mci_SetRightWallUpdateAvailable();
-	    
-	/* set up target and initial position */
-	mhi_ClearEncoder1EdgeCount();
-	mhi_ClearEncoder2EdgeCount();
-	initialPosition = mhi_GetEncoder1EdgeCount() + mhi_GetEncoder2EdgeCount();
-	targetPosition = initialPosition + (112*2);
-	    
-	    
-	/* main control loop */
-	while ((mhi_GetEncoder1EdgeCount() + mhi_GetEncoder2EdgeCount()) < targetPosition)
-	{		    
-		/* check for walls for PID move forward */
-		leftWall = mci_CheckLeftWallMoveForwardPid();
-		rightWall = mci_CheckRightWallMoveForwardPid();
-		    
-		//output error sensors
-		if ((leftWall == MCI_WALL_FOUND) && (rightWall != MCI_WALL_FOUND))
-		{
-			mhi_ClearD1Led();
-			mhi_ClearD3Led();
-			mhi_SetD2Led();
-			    
-			//Read left one
-			ir2Reading = mhi_ReadIr2();
-			    
-			//error with just left sensor
-			errorSensorLeft = MCI_LEFT_SENSOR_READING_THRESHOLD_RAW - ir2Reading;
-			errorSensors = -errorSensorLeft * 2;
-			dErrorSensors = errorSensors - prevErrorSensors;
-			outputSensors = (kpSensorL * errorSensors) + (kdSensorL * dErrorSensors);
-			prevErrorSensors = errorSensors;
-		}
-		    
-		else if ((rightWall == MCI_WALL_FOUND) && (leftWall != MCI_WALL_FOUND))
-		{
-			mhi_ClearD1Led();
-			mhi_ClearD2Led();
-			mhi_SetD3Led();
-			    
-			//Read Right one
-			ir3Reading = mhi_ReadIr3();
-			    
-			errorSensorRight = MCI_RIGHT_SENSOR_READING_THRESHOLD_RAW - ir3Reading;
-			errorSensors = errorSensorRight * 2;
-			dErrorSensors = errorSensors - prevErrorSensors;
-			outputSensors = (kpSensorR * errorSensors) + (kdSensorR * dErrorSensors);
-			prevErrorSensors = errorSensors;
-		}
-		    
-		else
-		{
-			outputSensors = 0;
-			prevErrorSensors = 0;
-		}
-		    
-		/* calculate error (for proportional term) */
-		error = targetAngle - ((int32_t)mhi_GetEncoder1EdgeCount() - (int32_t)mhi_GetEncoder2EdgeCount());
-		    
-		/* calculate difference in error (for the derivative term) */
-		error += outputSensors;
-		dError = error - prevError;
-		prevError = error;
-		    
-		/* calculate PID output */
-		output = (kp * error) + (kd * dError);
-		    
-		/* calculate new speeds */
-		newLeftSpeed = sf_constrain(MCI_MINIMUM_SPEED + output, 255, -255);
-		newRightSpeed = sf_constrain(MCI_MINIMUM_SPEED - output, 255, -255);
-		    
-		    
-		/* set new motor speeds */
-		if (newLeftSpeed < 0)
-		{
-			mhi_SetWheelMotor1Speed((uint16_t)abs(newLeftSpeed));
-			mhi_StartWheelMotor1Backward();
-		}
-		else
-		{
-			mhi_SetWheelMotor1Speed((uint16_t)newLeftSpeed);
-			mhi_StartWheelMotor1Forward();
-		}
-		    
-		if (newRightSpeed < 0)
-		{
-			mhi_SetWheelMotor2Speed((uint16_t)abs(newRightSpeed));
-			mhi_StartWheelMotor2Backward();
-		}
-		else
-		{
-			mhi_SetWheelMotor2Speed((uint16_t)newRightSpeed);
-			mhi_StartWheelMotor2Forward();
-		}
-	}
-	    
-	/* clear encoder edge counts and set motor speeds to 0 */
-	mhi_StopWheelMotor1();
-	mhi_StopWheelMotor2();
-	mhi_ClearEncoder1EdgeCount();
-	mhi_ClearEncoder2EdgeCount();
+	mci_MoveDiagonalNHalfSteps(2);
 }
 
-//TODO work in progress test in a long straight + deaccelerate on last square
-void mci_MoveForwardNSquares(int n){
-	/* initialize encoder PID constants (integral term not needed) */
-	float kp = 2;      /* proportional term */
-	float kd = 0.2;    /* derivative term */
-	
-	/* initialize sensor PD constants */
-	float kpSensor = 0.05;
-	float kdSensor = 0.01;
-	
-	/* initialize left sensor PD constants */
-	float kpSensorL = 0.5; // was 5
-	float kdSensorL = 5;
-	
-	/* initialize right sensor PD constants */
-	float kpSensorR = 0.5; // was 5
-	float kdSensorR = 5;
-	
-	/* other encoder PID variables */
-	int32_t initialPosition = mhi_GetEncoder1EdgeCount() + mhi_GetEncoder2EdgeCount();
-	int32_t targetPosition = initialPosition + ((MCI_WHEEL_MOTOR_EDGES_PER_MAZE_SQR_CONTINOUS*n)*2);
-	int32_t targetAngle = 0;
-	int32_t prevError = 0;
-	float error = 0;
-	float dError = 0;
-	
-	/* other sensor PD variables */
-	int32_t output = 0;
-	int32_t outputSensors = 0;
-	int32_t prevErrorSensors = 0;
-	int32_t errorSensors = 0;
-	float dErrorSensors = 0;
-	
-	/* other left sensor PD variables */
-	float errorSensorLeft = 0;
-	
-	/* other right sensor PD variables */
-	float errorSensorRight = 0;
-	
-	/* new motor speeds provided all PDs */
-	int32_t newLeftSpeed = 0;
-	int32_t newRightSpeed = 0;
-	
-	/* IR sensor variables */
-	uint32_t ir2Reading = 0u;
-	uint32_t ir3Reading = 0u;
-	
-	/* local wall presence variables */
-	mci_wall_presence_t leftWall = MCI_CANNOT_READ_WALL;
-	mci_wall_presence_t rightWall = MCI_CANNOT_READ_WALL;
-	
-	/* configure both motors to move forward at base speed */
-	mhi_SetWheelMotor1Speed(MCI_FORWARD_FAST_SPEED);
-	mhi_SetWheelMotor2Speed(MCI_FORWARD_FAST_SPEED);
-	mhi_StartWheelMotor1Forward();
-	mhi_StartWheelMotor2Forward();
-	
-	/* allow wall updates on start */
-	// 	mci_SetLeftWallUpdateAvailable();
-	// 	mci_SetRightWallUpdateAvailable();
-	
-	/* set up target and initial position */
-	mhi_ClearEncoder1EdgeCount();
-	mhi_ClearEncoder2EdgeCount();
-	initialPosition = mhi_GetEncoder1EdgeCount() + mhi_GetEncoder2EdgeCount();
-	targetPosition = initialPosition + ((MCI_WHEEL_MOTOR_EDGES_PER_MAZE_SQR_CONTINOUS*n)*2);
-	
-	
-	/* main control loop */
-	while ((mhi_GetEncoder1EdgeCount() + mhi_GetEncoder2EdgeCount()) < targetPosition)
-	{	
-		/* check for walls while moving diagonally for PID */
-		leftWall = mci_CheckLeftWallMoveForwardPid();
-		rightWall = mci_CheckRightWallMoveForwardPid();
-		
-		//output error sensors
-		if ((leftWall == MCI_WALL_FOUND) && (rightWall == MCI_WALL_FOUND))
-		{
-			mhi_ClearD2Led();
-			mhi_ClearD3Led();
-			mhi_SetD1Led();
-			
-			/* read left wall sensor */
-			ir2Reading = mhi_ReadIr2();
-			
-			/* read right wall sensor */
-			ir3Reading = mhi_ReadIr3();
-			
-			// Error with the sensors
-			errorSensorLeft =  MCI_LEFT_SENSOR_READING_THRESHOLD_RAW - ir2Reading;
-			errorSensorRight = MCI_RIGHT_SENSOR_READING_THRESHOLD_RAW - ir3Reading;
-			errorSensors =  errorSensorRight - errorSensorLeft;
-			dErrorSensors = errorSensors - prevErrorSensors;
-			
-			// Current way of trying to add a pid controller to the mouse using the sensors going to aggregate with the other output
-			outputSensors = (kpSensor * errorSensors) + (kdSensor * dErrorSensors);
-			
-			prevErrorSensors = errorSensors;
-		}
-		
-		else if ((leftWall == MCI_WALL_FOUND) && (rightWall != MCI_WALL_FOUND))
-		{
-			mhi_ClearD1Led();
-			mhi_ClearD3Led();
-			mhi_SetD2Led();
-			
-			//Read left one
-			ir2Reading = mhi_ReadIr2();
-			
-			//error with just left sensor
-			errorSensorLeft = MCI_LEFT_SENSOR_READING_THRESHOLD_RAW - ir2Reading;
-			//errorSensors = -errorSensorLeft * 2;
-			errorSensors = -errorSensorLeft;
-			dErrorSensors = errorSensors - prevErrorSensors;
-			outputSensors = (kpSensorL * errorSensors) + (kdSensorL * dErrorSensors);
-			// 			 if(targetAngle - (g_sbu_mm_Motor1EncoderEdgeCount - g_sbu_mm_Motor2EncoderEdgeCount) < -45){
-			// 				outputSensors*=-1;
-			// 			 }
-			prevErrorSensors = errorSensors;
-		}
-		
-		else if ((rightWall == MCI_WALL_FOUND) && (leftWall != MCI_WALL_FOUND))
-		{
-			mhi_ClearD1Led();
-			mhi_ClearD2Led();
-			mhi_SetD3Led();
-			
-			//Read Right one
-			ir3Reading = mhi_ReadIr3();
-			
-			errorSensorRight = MCI_RIGHT_SENSOR_READING_THRESHOLD_RAW - ir3Reading;
-			//errorSensors = errorSensorRight * 2;
-			errorSensors = errorSensorRight;
-			dErrorSensors = errorSensors - prevErrorSensors;
-			outputSensors = (kpSensorR * errorSensors) + (kdSensorR * dErrorSensors);
-			// 			  if(targetAngle - (g_sbu_mm_Motor1EncoderEdgeCount - g_sbu_mm_Motor2EncoderEdgeCount) < 45){
-			// 				  outputSensors*=-1;
-			// 			  }
-			prevErrorSensors = errorSensors;
-		}
-		
-		else
-		{
-			outputSensors = 0;
-			prevErrorSensors = 0;
-		}
-		
-		/* calculate error (for proportional term) */
-		error = targetAngle - ((int32_t)mhi_GetEncoder1EdgeCount() - (int32_t)mhi_GetEncoder2EdgeCount());
-		uint32_t distanceError = targetPosition - (mhi_GetEncoder1EdgeCount() + mhi_GetEncoder2EdgeCount());
-		/* Check to see if a less than one square is left to traverse to calculate error deceleration*/
-		if(distanceError < (MCI_WHEEL_MOTOR_EDGES_PER_MAZE_SQUARE+10)){
-			 distanceError/=((float)MCI_WHEEL_MOTOR_EDGES_PER_MAZE_SQUARE+10);
-		}
-		else{
-			distanceError = 1;
-		}
-		/* calculate difference in error (for the derivative term) */
-		error += outputSensors;
-		dError = error - prevError;
-		prevError = error;
-		
-		/* calculate PID output */
-		output = (kp * error) + (kd * dError);
-// 		output*=distanceError;
-		/* calculate new speeds */
-		newLeftSpeed = sf_constrain(MCI_MINIMUM_SPEED + output, 255, -255);
-		newRightSpeed = sf_constrain(MCI_MINIMUM_SPEED - output, 255, -255);
-		
-		
-		/* set new motor speeds */
-		if (newLeftSpeed < 0)
-		{
-			mhi_SetWheelMotor1Speed((uint16_t)abs(newLeftSpeed));
-			mhi_StartWheelMotor1Backward();
-		}
-		else
-		{
-			mhi_SetWheelMotor1Speed((uint16_t)newLeftSpeed);
-			mhi_StartWheelMotor1Forward();
-		}
-		
-		if (newRightSpeed < 0)
-		{
-			mhi_SetWheelMotor2Speed((uint16_t)abs(newRightSpeed));
-			mhi_StartWheelMotor2Backward();
-		}
-		else
-		{
-			mhi_SetWheelMotor2Speed((uint16_t)newRightSpeed);
-			mhi_StartWheelMotor2Forward();
-		}
-	}
-	
-	/* clear encoder edge counts and set motor speeds to 0 */
-	mhi_StopWheelMotor1();
-	mhi_StopWheelMotor2();
-	mhi_ClearEncoder1EdgeCount();
-	mhi_ClearEncoder2EdgeCount();
+/**
+* Move mouse along a diagonal, from wall gap to wall gap
+*
+* A half step is cell / sqrt(2), from the gap in one wall to the gap in the
+* next wall across the corner. Only one side wall is in view at a time on a
+* diagonal, so the sensor PD uses one side only.
+*
+* \param[in] n Number of half steps
+* \retval None
+*/
+void mci_MoveDiagonalNHalfSteps(int n)
+{
+    mci_DriveStraight(MCI_WHEEL_MOTOR_EDGES_PER_DIAGONAL_HALF_STEP * n * 2,
+        MCI_MOVE_STEER_DIAGONAL);
 }
 
 /**
-* Rotate mouse 90 degrees right with some deacceleeration
+* Queue half squares straight ahead, see mci_MoveForwardNHalfSquares()
+*
+* \param[in] n Number of half squares
+* \retval true if queued, false if the queue is full
+*/
+bool mci_QueueForwardNHalfSquares(int n)
+{
+    return mci_QueueStraight(MCI_WHEEL_MOTOR_EDGES_PER_HALF_SQUARE * n,
+        MCI_MOVE_STEER_HALF_SQUARE);
+}
+
+/**
+* Queue half steps on a diagonal, see mci_MoveDiagonalNHalfSteps()
+*
+* \param[in] n Number of half steps
+* \retval true if queued, false if the queue is full
+*/
+bool mci_QueueDiagonalNHalfSteps(int n)
+{
+    return mci_QueueStraight(MCI_WHEEL_MOTOR_EDGES_PER_DIAGONAL_HALF_STEP * n
+        * 2, MCI_MOVE_STEER_DIAGONAL);
+}
+
+/**
+* Queue a turn in place
+*
+* The side walls known are turned w/ the mouse when the turn is queued, so
+* the wall checks after it see them from the new heading.
+*
+* \param[in] degrees 45, 90, 135 or 180, negative to the left
+* \retval true if queued, false if the queue is full
+*/
+bool mci_QueueTurnDegrees(int degrees)
+{
+    bool right = (degrees > 0);
+    int32_t edges = right ? MCI_WHEEL_MOTOR_EDGES_PER_90_DEGREE_TURN_RIGHT_PID
+        : MCI_WHEEL_MOTOR_EDGES_PER_90_DEGREE_TURN_LEFT_PID;
+    int quarters = 0;
+
+    if (!mci_QueueRotate((edges * abs(degrees)) / 90, right))
+    {
+        return false;
+    }
+
+    for (quarters = abs(degrees) / 90; quarters > 0; quarters--)
+    {
+        if (right)
+        {
+            mci_UpdateWallPresenceRightTurn();
+        }
+        else
+        {
+            mci_UpdateWallPresenceLeftTurn();
+        }
+    }
+
+    return true;
+}
+
+/**
+* Queue a search turn arc, from the gap a square is entered by to the gap
+* at its side, see mci_SearchTurnRight90Degrees()
+*
+* \param[in] right true to turn right
+* \retval true if queued, false if the queue is full
+*/
+bool mci_QueueSearchTurn(bool right)
+{
+    int32_t velocity = mci_ControlSpeedToVelocity(speedProfile.forwardSpeed)
+        * 2;
+    mci_control_command_t command =
+    {
+        .type = MCI_CONTROL_COMMAND_ARC,
+        .profile =
+        {
+            .distance = MCI_MM_TO_EDGES(MCI_SEARCH_TURN_ARC_MM) * 2,
+            .maxVelocity = velocity,
+            .acceleration = MCI_MM_TO_EDGES(MCI_MOVE_ACCELERATION_MM_S2) * 2,
+            .jerk = MCI_MM_TO_EDGES(MCI_MOVE_JERK_MM_S3) * 2,
+            .startVelocity = 0,
+            .endVelocity = velocity,
+        },
+        .curvatureQ16 = right ? MCI_SEARCH_TURN_CURVATURE_Q16
+            : -MCI_SEARCH_TURN_CURVATURE_Q16,
+        .gains = straightGains,
+        .tag = MCI_MOVE_STEER_NONE,
+    };
+
+    if (!mci_ControlPush(&command))
+    {
+        return false;
+    }
+
+    if (right)
+    {
+        mci_UpdateWallPresenceRightTurn();
+    }
+    else
+    {
+        mci_UpdateWallPresenceLeftTurn();
+    }
+
+    return true;
+}
+
+/**
+* Steer the queued straight under way off the side walls, call it as often
+* as the foreground can while queued moves run
 *
 * \param None
-* \retval None
+* \retval true while queued moves are left to drive
 */
-void mci_TurnRight90DegreesPID(void){
-    uint32_t rightDone = 0u;
-    uint32_t leftDone = 0u;
-    float kp = 1;      /* proportional term */
-    float kd = 0.5;    /* derivative term */
-	int32_t targetAngle = 0;
-    int32_t prevErrorLeft = 0;
-	int32_t prevErrorRight = 0;
-    float errorLeft = 0;
-    float dErrorLeft = 0;
-	float errorRight = 0;
-    float dErrorRight = 0;
-	int32_t outputLeft = 0;
-	int32_t outputRight = 0;
-
-    /* reset encoder counts */
-    mhi_ClearEncoder1EdgeCount();
-    mhi_ClearEncoder2EdgeCount();
-    
-    /* set motor directions and speeds */
-    mhi_SetWheelMotor1Speed(MCI_TURN_SPEED);
-    mhi_SetWheelMotor2Speed(MCI_TURN_SPEED); //140 speed default
-    mhi_StartWheelMotor1Forward();
-    mhi_StartWheelMotor2Backward();
-    
-    /* keep moving motors until encoder edge counts are reached */
-    while ((!rightDone) || (!leftDone))
+bool mci_RunMotionQueue(void)
+{
+    mci_control_queue_state_t state;
+    const mci_steering_t* p_steering = NULL;
+
+    mci_GetControlQueueState(&state);
+    if (state.finished == state.started)
     {
-		errorRight = MCI_WHEEL_MOTOR_EDGES_PER_90_DEGREE_TURN_RIGHT_PID - (-1*mhi_GetEncoder1EdgeCount());
-		errorLeft = MCI_WHEEL_MOTOR_EDGES_PER_90_DEGREE_TURN_RIGHT_PID - (mhi_GetEncoder2EdgeCount());
-		dErrorRight = errorRight - prevErrorRight;
-		dErrorLeft = errorLeft - prevErrorLeft;
-		prevErrorRight = errorRight;
-		prevErrorLeft = errorLeft;
-		
+        return state.queued != 0u;
+    }
 
-		outputRight = (kp * errorRight) + (kd * dErrorRight);
-		outputLeft = (kp * errorLeft) + (kd * dErrorLeft);
-		int32_t newRightSpeed = 90 + outputRight;
-		int32_t newLeftSpeed = 90 + outputLeft;
-
-		mhi_SetWheelMotor1Speed((uint16_t)abs(newLeftSpeed));
-		mhi_StartWheelMotor1Forward();
-		mhi_SetWheelMotor2Speed((uint16_t)abs(newRightSpeed));
-		mhi_StartWheelMotor2Backward();
-
-
-	    if ((!rightDone) && (mhi_GetEncoder1EdgeCount() ==
-	    MCI_WHEEL_MOTOR_EDGES_PER_90_DEGREE_TURN_RIGHT_PID))
-	    {
-		    mhi_StopWheelMotor1();
-		    rightDone = 1u;
-	    }
-	    if ((!leftDone) && (mhi_GetEncoder2EdgeCount() ==
-	    (-MCI_WHEEL_MOTOR_EDGES_PER_90_DEGREE_TURN_RIGHT_PID)))
-	    {
-		    mhi_StopWheelMotor2();
-		    leftDone = 1u;
-	    }
+    /* a new move steers from no error */
+    if (state.started != queueSteeringMove)
+    {
+        queueSteeringMove = state.started;
+        mci_StartSteering(&queueSteeringState);
     }
+    p_steering = queueSteering[state.tag];
+    if (p_steering != NULL)
+    {
+        mci_UpdateSteering(p_steering, &queueSteeringState);
+    }
+
+    return true;
+}
+
+/**
+* Wait for the queued moves to finish, steering them
+*
+* \param None
+* \retval None
+*/
+void mci_WaitMotionQueue(void)
+{
+    while (mci_RunMotionQueue() || !mci_ControlIsDone())
+    {
+    }
+}
+
+/**
+* Queued moves done since power up, e.g. to time them as they finish
+*
+* \param None
+* \retval Moves
+*/
+uint32_t mci_GetMovesDone(void)
+{
+    mci_control_queue_state_t state;
+
+    mci_GetControlQueueState(&state);
+
+    return state.finished;
+}
+
+/**
+* Times the queue was dropped since power up, e.g. for whoever waits on
+* queued moves to leave once a stop dropped them, see control_mci.h
+*
+* \param None
+* \retval Stops
+*/
+uint32_t mci_GetMotionQueueStops(void)
+{
+    mci_control_queue_state_t state;
+
+    mci_GetControlQueueState(&state);
+
+    return state.stops;
+}
+
+/**
+* Distance left to drive in the queued straights and arcs, e.g. to look
+* ahead from
+*
+* \param None
+* \retval Of the move under way and the ones waiting, turns in place count 0
+*/
+int32_t mci_GetMotionRemainingMm(void)
+{
+    mci_control_queue_state_t state;
+
+    mci_GetControlQueueState(&state);
+
+    return ((state.remaining + state.queuedDistance) / 2)
+        * (MCI_MAZE_WALL_LENGTH_MM + MCI_MAZE_PILLAR_WIDTH_MM)
+        / MCI_WHEEL_MOTOR_EDGES_PER_MAZE_SQUARE;
+}
+
+/**
+* Hand the next 1 square move some work to do while it drives
+*
+* mci_MoveForward1MazeSquarePid() runs the task once, past the halfway mark
+* where the side walls of the square ahead are latched, then drops it. The
+* control loop runs on without it, but the move reads no walls until the
+* task returns, so it should still be short. A move stopped short by a front
+* wall drops the task w/o running it.
+*
+* \param[in] task Function to run, NULL for none
+* \retval None
+*/
+void mci_SetMoveMidpointTask(mci_move_task_t task)
+{
+    moveMidpointTask = task;
+}
+
+/**
+* Have the 1 square move under way turn off into a square to the side
+*
+* Only for its midpoint task: the move then takes the turn as an arc from
+* the gap it is in and stops in the centre of the square to the side of the
+* one ahead, w/o stopping in that one. The wall at the side has to be known
+* to be open.
+*
+* \param[in] turn Side to turn off to, MCI_SEARCH_TURN_NONE to stop ahead
+* \retval None
+*/
+void mci_SetMoveSearchTurn(mci_search_turn_t turn)
+{
+    moveSearchTurn = turn;
+}
+
+/**
+* Turn 90 degrees right on an arc, from the gap a square is entered by to
+* the gap at its right
+*
+* The mouse should be in the gap at the forward speed, it is left driving
+* on at it, so the next straight has to chain on.
+*
+* \param None
+* \retval None
+*/
+void mci_SearchTurnRight90Degrees(void)
+{
+    mci_SearchTurn(true);
     
     /* update wall presences */
     mci_UpdateWallPresenceRightTurn();
-    
-    
-    /* clear encoder edge counts and set motor speeds to 0 */
-    mhi_StopWheelMotor1();
-    mhi_StopWheelMotor2();
-    mhi_ClearEncoder1EdgeCount();
-    mhi_ClearEncoder2EdgeCount();
 }
 
 /**
-* Rotate mouse 90 degrees left with some deacceleration
+* Turn 90 degrees left on an arc, from the gap a square is entered by to
+* the gap at its left
+*
+* The mouse should be in the gap at the forward speed, it is left driving
+* on at it, so the next straight has to chain on.
 *
 * \param None
 * \retval None
 */
-void mci_TurnLeft90DegreesPID(void){
-    uint32_t rightDone = 0u;
-    uint32_t leftDone = 0u;
-    float kp = 1;      /* proportional term */
-    float kd = 0.5;    /* derivative term */
-	int32_t targetAngle = 0;
-    int32_t prevErrorLeft = 0;
-	int32_t prevErrorRight = 0;
-    float errorLeft = 0;
-    float dErrorLeft = 0;
-	float errorRight = 0;
-    float dErrorRight = 0;
-	int32_t outputLeft = 0;
-	int32_t outputRight = 0;
-
-    /* reset encoder counts */
-    mhi_ClearEncoder1EdgeCount();
-    mhi_ClearEncoder2EdgeCount();
+void mci_SearchTurnLeft90Degrees(void)
+{
+    mci_SearchTurn(false);
     
-    /* set motor directions and speeds */
-    mhi_SetWheelMotor1Speed(MCI_TURN_SPEED);
-    mhi_SetWheelMotor2Speed(MCI_TURN_SPEED); //140 speed default
-    mhi_StartWheelMotor1Backward();
-    mhi_StartWheelMotor2Forward();
+    /* update wall presences */
+    mci_UpdateWallPresenceLeftTurn();
+}
+
+/**
+* Set the PWM the moves cruise at from the next move on
+*
+* The PWM is turned into the max velocity of the move profiles by the
+* feedforward of the control loop, the forward speed stays at
+* MCI_MINIMUM_SPEED or above.
+*
+* \param[in] p_profile Forward and turn speed
+* \retval None
+*/
+void mci_SetSpeedProfile(const mci_speed_profile_t* p_profile)
+{
+    speedProfile = *p_profile;
+    if (speedProfile.forwardSpeed < MCI_MINIMUM_SPEED)
+        speedProfile.forwardSpeed = MCI_MINIMUM_SPEED;
+}
+
+/**
+* Speed profile in use
+*
+* \param None
+* \retval Forward and turn speed
+*/
+const mci_speed_profile_t* mci_GetSpeedProfile(void)
+{
+    return &speedProfile;
+}
+
+
+/**
+* Move mouse forward N maze squares in one go, braking for the last square
+*
+* \param[in] n Number of squares
+* \retval None
+*/
+void mci_MoveForwardNSquares(int n)
+{
+    mci_MoveForwardNHalfSquares(2 * n);
+}
+
+/**
+* Move mouse forward in half maze squares, e.g. from a cell centre to the gap
+* in the wall in front of it
+*
+* \param[in] n Number of half squares
+* \retval None
+*/
+void mci_MoveForwardNHalfSquares(int n)
+{
+    mci_DriveStraight(MCI_WHEEL_MOTOR_EDGES_PER_HALF_SQUARE * n,
+        MCI_MOVE_STEER_HALF_SQUARE);
+}
+
+/**
+* Rotate mouse 90 degrees right with some deacceleeration
+*
+* \param None
+* \retval None
+*/
+void mci_TurnRight90DegreesPID(void)
+{
+    mci_Rotate(MCI_WHEEL_MOTOR_EDGES_PER_90_DEGREE_TURN_RIGHT_PID, true);
     
-    /* keep moving motors until encoder edge counts are reached */
-    while ((!rightDone) || (!leftDone))
-    {
-		errorRight = MCI_WHEEL_MOTOR_EDGES_PER_90_DEGREE_TURN_LEFT_PID - (mhi_GetEncoder1EdgeCount());
-		errorLeft = MCI_WHEEL_MOTOR_EDGES_PER_90_DEGREE_TURN_LEFT_PID - (-1*mhi_GetEncoder2EdgeCount());
-		dErrorRight = errorRight - prevErrorRight;
-		dErrorLeft = errorLeft - prevErrorLeft;
-		prevErrorRight = errorRight;
-		prevErrorLeft = errorLeft;
-		
+    /* update wall presences */
+    mci_UpdateWallPresenceRightTurn();
+}
 
-		outputRight = (kp * errorRight) + (kd * dErrorRight);
-		outputLeft = (kp * errorLeft) + (kd * dErrorLeft);
-		int32_t newRightSpeed = 90 + outputRight;
-		int32_t newLeftSpeed = 90 + outputLeft;
-
-		mhi_SetWheelMotor1Speed((uint16_t)abs(newLeftSpeed));
-		mhi_StartWheelMotor1Backward();
-		mhi_SetWheelMotor2Speed((uint16_t)abs(newRightSpeed));
-		mhi_StartWheelMotor2Forward();
-
-
-	    if ((!rightDone) && (mhi_GetEncoder1EdgeCount() ==
-	    (-MCI_WHEEL_MOTOR_EDGES_PER_90_DEGREE_TURN_LEFT_PID)))
-	    {
-		    mhi_StopWheelMotor1();
-		    rightDone = 1u;
-	    }
-	    if ((!leftDone) && (mhi_GetEncoder2EdgeCount() ==
-	    MCI_WHEEL_MOTOR_EDGES_PER_90_DEGREE_TURN_LEFT_PID))
-	    {
-		    mhi_StopWheelMotor2();
-		    leftDone = 1u;
-	    }
-    }
+/**
+* Rotate mouse 90 degrees left with some deacceleration
+*
+* \param None
+* \retval None
+*/
+void mci_TurnLeft90DegreesPID(void)
+{
+    mci_Rotate(MCI_WHEEL_MOTOR_EDGES_PER_90_DEGREE_TURN_LEFT_PID, false);
     
     /* update wall presences */
     mci_UpdateWallPresenceLeftTurn();
-    
-    
-    /* clear encoder edge counts and set motor speeds to 0 */
-    mhi_StopWheelMotor1();
-    mhi_StopWheelMotor2();
-    mhi_ClearEncoder1EdgeCount();
-    mhi_ClearEncoder2EdgeCount();
 }
 
 
@@ -1246,4 +883,245 @@ void mci_TurnLeft90DegreesPID(void){
 /*----------------------------------------------------------------------------*/
 /*                         Private (Static) Functions                         */
 /*----------------------------------------------------------------------------*/
-/* None */
+/**
+* Profile of a straight move from rest to rest at the forward speed
+*
+* \param[in]  distanceEdges Distance, both wheels' edges summed
+* \param[out] p_profile     Profile in both wheels' edges summed
+* \retval None
+*/
+static void mci_GetStraightProfile(int32_t distanceEdges,
+    mci_profile_params_t* p_profile)
+{
+    p_profile->distance = distanceEdges;
+    p_profile->maxVelocity
+        = mci_ControlSpeedToVelocity(speedProfile.forwardSpeed) * 2;
+    p_profile->acceleration = MCI_MM_TO_EDGES(MCI_MOVE_ACCELERATION_MM_S2) * 2;
+    p_profile->jerk = MCI_MM_TO_EDGES(MCI_MOVE_JERK_MM_S3) * 2;
+    p_profile->startVelocity = 0;
+    p_profile->endVelocity = 0;
+}
+
+/**
+* Turn in place from rest to rest at the turn speed
+*
+* \param[in] wheelEdges Edges for each wheel
+* \param[in] right      true to turn right
+* \retval None
+*/
+static void mci_Rotate(int32_t wheelEdges, bool right)
+{
+    /* the foreground waits on a full queue, the loop never does */
+    while (!mci_QueueRotate(wheelEdges, right))
+    {
+        mci_RunMotionQueue();
+    }
+    mci_WaitMotionQueue();
+}
+
+/**
+* Arc 90 degrees at the forward speed, each wheel on its own radius
+*
+* \param[in] right true to turn right
+* \retval None
+*/
+static void mci_SearchTurn(bool right)
+{
+    int32_t velocity = mci_ControlSpeedToVelocity(speedProfile.forwardSpeed)
+        * 2;
+    mci_profile_params_t profile =
+    {
+        .distance = MCI_MM_TO_EDGES(MCI_SEARCH_TURN_ARC_MM) * 2,
+        .maxVelocity = velocity,
+        .acceleration = MCI_MM_TO_EDGES(MCI_MOVE_ACCELERATION_MM_S2) * 2,
+        .jerk = MCI_MM_TO_EDGES(MCI_MOVE_JERK_MM_S3) * 2,
+        .startVelocity = velocity,
+        .endVelocity = velocity,
+    };
+    
+    mci_ControlStartArc(&profile, right ? MCI_SEARCH_TURN_CURVATURE_Q16
+        : -MCI_SEARCH_TURN_CURVATURE_Q16, &straightGains);
+    mci_ControlWait();
+}
+
+/**
+* Drive straight, steering off the side walls until the control loop is done
+*
+* A straight or arc still running at its end velocity carries on into it.
+*
+* \param[in] distanceEdges Distance, both wheels' edges summed
+* \param[in] steer         Side wall steering
+* \retval None
+*/
+static void mci_DriveStraight(int32_t distanceEdges, mci_move_steer_t steer)
+{
+    /* the foreground waits on a full queue, the loop never does */
+    while (!mci_QueueStraight(distanceEdges, steer))
+    {
+        mci_RunMotionQueue();
+    }
+    mci_WaitMotionQueue();
+}
+
+/**
+* Queue a straight at the forward speed, it ends at rest unless a straight
+* or arc is queued behind it in time
+*
+* \param[in] distanceEdges Distance, both wheels' edges summed
+* \param[in] steer         Side wall steering
+* \retval true if queued, false if the queue is full
+*/
+static bool mci_QueueStraight(int32_t distanceEdges, mci_move_steer_t steer)
+{
+    mci_control_command_t command =
+    {
+        .type = MCI_CONTROL_COMMAND_STRAIGHT,
+        .gains = straightGains,
+        .tag = (uint8_t)steer,
+    };
+    
+    mci_GetStraightProfile(distanceEdges, &command.profile);
+    command.profile.endVelocity = command.profile.maxVelocity;
+    
+    return mci_ControlPush(&command);
+}
+
+/**
+* Queue a turn in place from rest to rest at the turn speed
+*
+* \param[in] wheelEdges Edges for each wheel
+* \param[in] right      true to turn right
+* \retval true if queued, false if the queue is full
+*/
+static bool mci_QueueRotate(int32_t wheelEdges, bool right)
+{
+    mci_control_command_t command =
+    {
+        .type = MCI_CONTROL_COMMAND_ROTATE,
+        .profile =
+        {
+            .distance = wheelEdges * 2,
+            .maxVelocity = mci_ControlSpeedToVelocity(speedProfile.turnSpeed)
+                * 2,
+            .acceleration = MCI_MM_TO_EDGES(MCI_TURN_ACCELERATION_MM_S2) * 2,
+            .jerk = MCI_MM_TO_EDGES(MCI_TURN_JERK_MM_S3) * 2,
+            .startVelocity = 0,
+            .endVelocity = 0,
+        },
+        .right = right,
+        .gains = turnGains,
+        .tag = MCI_MOVE_STEER_NONE,
+    };
+    
+    return mci_ControlPush(&command);
+}
+
+/**
+* Start the side wall steering of a move from no error
+*
+* \param[out] p_state Steering state of the move
+* \retval None
+*/
+static void mci_StartSteering(mci_steering_state_t* p_state)
+{
+    p_state->prevError = 0;
+    p_state->prevTimerCount = mhi_GetTimerCount();
+}
+
+/**
+* Read the side walls and hand the control loop the steering
+*
+* The walls are read as fast as the foreground gets round to it, so the
+* derivative is taken over the control ticks since the last reading.
+*
+* \param[in]     p_steering Side wall steering
+* \param[in,out] p_state    Steering state of the move
+* \retval None
+*/
+static void mci_UpdateSteering(const mci_steering_t* p_steering,
+    mci_steering_state_t* p_state)
+{
+    mci_wall_presence_t leftWall = mci_CheckLeftWallMoveForwardPid();
+    mci_wall_presence_t rightWall = mci_CheckRightWallMoveForwardPid();
+    uint32_t timerCount = mhi_GetTimerCount();
+    uint32_t ticks = timerCount - p_state->prevTimerCount;
+    int32_t errorSensorLeft = 0;
+    int32_t errorSensorRight = 0;
+    int32_t errorSensors = 0;
+    float dErrorSensors = 0;
+    float kp = 0;
+    float kd = 0;
+    
+    if (p_steering->useBothWalls
+        && (leftWall == MCI_WALL_FOUND) && (rightWall == MCI_WALL_FOUND))
+    {
+        mhi_ClearD2Led();
+        mhi_ClearD3Led();
+        mhi_SetD1Led();
+        
+        /* steer between both walls */
+        errorSensorLeft = MCI_LEFT_SENSOR_READING_THRESHOLD_RAW
+            - (int32_t)mhi_ReadIr2();
+        errorSensorRight = MCI_RIGHT_SENSOR_READING_THRESHOLD_RAW
+            - (int32_t)mhi_ReadIr3();
+        errorSensors = errorSensorRight - errorSensorLeft;
+        kp = p_steering->kpBoth;
+        kd = p_steering->kdBoth;
+    }
+    else if ((leftWall == MCI_WALL_FOUND) && (rightWall != MCI_WALL_FOUND))
+    {
+        mhi_ClearD1Led();
+        mhi_ClearD3Led();
+        mhi_SetD2Led();
+        
+        /* gets larger as the mouse closes in, negative pushes it off */
+        errorSensorLeft = (MCI_LEFT_SENSOR_READING_THRESHOLD_RAW
+            + p_steering->sideOffset) - (int32_t)mhi_ReadIr2();
+        if (errorSensorLeft > 0)
+        {
+            errorSensorLeft *= p_steering->sideBoost;
+        }
+        errorSensors = -errorSensorLeft * p_steering->leftScale;
+        kp = p_steering->kpSide;
+        kd = p_steering->kdSide;
+    }
+    else if ((rightWall == MCI_WALL_FOUND) && (leftWall != MCI_WALL_FOUND))
+    {
+        mhi_ClearD1Led();
+        mhi_ClearD2Led();
+        mhi_SetD3Led();
+        
+        /* negative means close to the right wall, pushes it off */
+        errorSensorRight = (MCI_RIGHT_SENSOR_READING_THRESHOLD_RAW
+            + p_steering->sideOffset) - (int32_t)mhi_ReadIr3();
+        if (errorSensorRight > 0)
+        {
+            errorSensorRight *= p_steering->sideBoost;
+        }
+        errorSensors = errorSensorRight * p_steering->rightScale;
+        kp = p_steering->kpSide;
+        kd = p_steering->kdSide;
+    }
+    else
+    {
+        /* nothing to steer off */
+        p_state->prevError = 0;
+        p_state->prevTimerCount = timerCount;
+        mci_ControlSetSteering(0);
+        return;
+    }
+    
+    /* per ms, however long the foreground took */
+    if (ticks == 0u)
+    {
+        ticks = 1u;
+    }
+    dErrorSensors = ((float)(errorSensors - p_state->prevError)
+        * (float)mci_ControlGetRateHz()) / (1000.0f * (float)ticks);
+    
+    p_state->prevError = errorSensors;
+    p_state->prevTimerCount = timerCount;
+    
+    mci_ControlSetSteering((int32_t)((kp * errorSensors)
+        + (kd * dErrorSensors)));
+}
@@ -49,6 +49,14 @@
         //MCI_WHEEL_MOTOR_EDGES_PER_MAZE_SQUARE_REAL_MAZE
 
 #define MCI_WHEEL_MOTOR_EDGES_PER_MAZE_SQR_CONTINOUS (89)
+/* a half square of edges summed over both wheels, driven w/o stopping: */
+/* the half squares of the queued straights and of the way out of a */
+/* search turn, which both carry on at speed */
+#define MCI_WHEEL_MOTOR_EDGES_PER_HALF_SQUARE \
+        MCI_WHEEL_MOTOR_EDGES_PER_MAZE_SQR_CONTINOUS
+/* cell / sqrt(2) from one wall gap to the next on a diagonal */
+/* 112 edges per two half steps, as driven by mci_MoveCentertoCenterPid */
+#define MCI_WHEEL_MOTOR_EDGES_PER_DIAGONAL_HALF_STEP (56)
 /* c = pi*d; pi*100mm = 295.3mm */
 /* (edges/rev)/(wheel circumference) = edges/mm; (edges/mm)*(c/4) = */
 /* edges/90deg turn; (52/103mm)*(295.3mm/4) = 37 edges/maze square */
@@ -65,6 +73,58 @@
 #define  MCI_WHEEL_MOTOR_EDGES_PER_45_DEGREE_TURN_RIGHT (MCI_WHEEL_MOTOR_EDGES_PER_90_DEGREE_TURN_RIGHT/2)
 #define  MCI_WHEEL_MOTOR_EDGES_PER_45_DEGREE_TURN_LEFT (MCI_WHEEL_MOTOR_EDGES_PER_90_DEGREE_TURN_LEFT/2)
 
+/* wheel travel per edge in um, by the calibrated maze square */
+#define MCI_UM_PER_EDGE \
+        (((MCI_MAZE_WALL_LENGTH_MM + MCI_MAZE_PILLAR_WIDTH_MM) * 1000) \
+        / MCI_WHEEL_MOTOR_EDGES_PER_MAZE_SQUARE)
+/* track the calibrated turns in place turn about: each wheel drives pi/4 */
+/* of it for 90 degrees, 355/113 for pi. The wheels scrub, so it comes out */
+/* wider than the MCI_MOUSE_WHEEL_TO_WHEEL_DISTANCE_MM between them */
+#define MCI_WHEEL_TRACK_UM \
+        ((MCI_WHEEL_MOTOR_EDGES_PER_90_DEGREE_TURN_RIGHT_PID * 4 \
+        * MCI_UM_PER_EDGE * 113) / 355)
+
+/* motion profiles of the moves, in mm of wheel travel, untuned */
+#define MCI_MOVE_ACCELERATION_MM_S2    (2000)
+#define MCI_MOVE_JERK_MM_S3            (40000)
+#define MCI_TURN_ACCELERATION_MM_S2    (2000)
+#define MCI_TURN_JERK_MM_S3            (40000)
+
+/* search turns: 90 degree arcs from the wall gap a square is entered by */
+/* to the gap at its side, around the post between the two, at the */
+/* forward speed in and out. The arc is pi/2 * r, 355/226 for pi/2, and */
+/* its curvature b / 2r in 1/65536 for the track b, so an arc turns the */
+/* pose as far as a turn in place */
+#define MCI_SEARCH_TURN_RADIUS_MM \
+        ((MCI_MAZE_WALL_LENGTH_MM + MCI_MAZE_PILLAR_WIDTH_MM) / 2)
+#define MCI_SEARCH_TURN_ARC_MM \
+        ((MCI_SEARCH_TURN_RADIUS_MM * 355) / 226)
+#define MCI_SEARCH_TURN_CURVATURE_Q16 \
+        ((int32_t)(((int64_t)MCI_WHEEL_TRACK_UM * 65536) \
+        / (2000 * MCI_SEARCH_TURN_RADIUS_MM)))
+
+/* wheel travel in edges, by the calibrated maze square */
+#define MCI_MM_TO_EDGES(mm) \
+        ((((int32_t)(mm)) * MCI_WHEEL_MOTOR_EDGES_PER_MAZE_SQUARE) \
+        / (MCI_MAZE_WALL_LENGTH_MM + MCI_MAZE_PILLAR_WIDTH_MM))
+
+/* PWM the moves cruise at, the defaults above are the safe profile */
+typedef struct
+{
+    uint16_t forwardSpeed;      /* straights, MCI_MINIMUM_SPEED or more */
+    uint16_t turnSpeed;         /* turns in place */
+} mci_speed_profile_t;
+
+/* work for the algo layer to do while a square move drives itself */
+typedef void (*mci_move_task_t)(void);
+
+/* where the next square move goes on to once in the square ahead */
+typedef enum
+{
+    MCI_SEARCH_TURN_NONE = 0u,  /* stops in its centre */
+    MCI_SEARCH_TURN_LEFT,       /* arcs off into the square to the left */
+    MCI_SEARCH_TURN_RIGHT       /* arcs off into the square to the right */
+} mci_search_turn_t;
 
 /*----------------------------------------------------------------------------*/
 /*                              Global Variables                              */
@@ -79,10 +139,28 @@ void mci_MoveForward1MazeSquarePid(void);
 void mci_TurnRight90Degrees(void);
 void mci_TurnLeft90Degrees(void);
 void mci_AdjustToFrontWall(void);
+void mci_PlaceAtStart(void);
 void mci_TurnRight45Degrees(void);
 void mci_TurnLeft45Degrees(void);
 void mci_MoveCentertoCenterPid(void);
 void mci_MoveForwardNSquares(int n);
+void mci_MoveForwardNHalfSquares(int n);
+void mci_MoveDiagonalNHalfSteps(int n);
+bool mci_QueueForwardNHalfSquares(int n);
+bool mci_QueueDiagonalNHalfSteps(int n);
+bool mci_QueueTurnDegrees(int degrees);
+bool mci_QueueSearchTurn(bool right);
+bool mci_RunMotionQueue(void);
+void mci_WaitMotionQueue(void);
+uint32_t mci_GetMovesDone(void);
+uint32_t mci_GetMotionQueueStops(void);
+int32_t mci_GetMotionRemainingMm(void);
+void mci_SetMoveMidpointTask(mci_move_task_t task);
+void mci_SetMoveSearchTurn(mci_search_turn_t turn);
+void mci_SearchTurnLeft90Degrees(void);
+void mci_SearchTurnRight90Degrees(void);
+void mci_SetSpeedProfile(const mci_speed_profile_t* p_profile);
+const mci_speed_profile_t* mci_GetSpeedProfile(void);
 void mci_TurnRight90DegreesPID(void);
 void mci_TurnLeft90DegreesPID(void);
 void mci_MoveDiagonalLeft(void); 
@@ -0,0 +1,248 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : odometry_mci.c
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : mouse control interface layer
+*
+* This is the source file for the mouse pose under the mouse control
+* interface.
+*
+* Each tick the wheels' edges are turned into the distance the middle of
+* the axle drove and the heading it turned by, w/ the track the turns in
+* place are calibrated at, see movement_mci.h. The distance is taken
+* along the heading halfway through the tick, as on an arc. The sine comes
+* from a quarter wave table in 1/16384, 64 steps to the quarter turn,
+* interpolated in between, and each step is rounded rather than cut, so
+* the pose does not creep one way over a run.
+*
+* The pose is only updated by the tick task, and only read or set w/
+* interrupts off.
+*
+* The mouse control interface uses the mouse hardware interface to define high
+* level micromouse functionality.
+*-----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdbool.h>
+#include <stdint.h>
+#include "micromouse_dimensions.h"
+#include "mouse_hardware_interface/interrupts_mhi.h"
+#include "mouse_control_interface/walldetection_mci.h"
+#include "mouse_control_interface/movement_mci.h"
+#include "mouse_control_interface/odometry_mci.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+/* heading per edge the left wheel gets ahead of the right: an edge over */
+/* the 2 pi * track of a full turn, 710/113 for 2 pi, 2^32 to the turn */
+#define MCI_ODOMETRY_ANGLE_PER_EDGE \
+        ((uint32_t)((((int64_t)MCI_UM_PER_EDGE << 32) * 113) \
+        / (710 * (int64_t)MCI_WHEEL_TRACK_UM)))
+
+/* sine table: 1.0, and steps to the quarter turn as a shift of the angle */
+#define MCI_ODOMETRY_SINE_ONE        (16384)
+#define MCI_ODOMETRY_SINE_SHIFT      (14)
+#define MCI_ODOMETRY_SINE_STEPS      (64u)
+#define MCI_ODOMETRY_SINE_STEP_SHIFT (24)
+
+/* wheel edges of the last tick, and the pose they got to */
+typedef struct
+{
+    uint32_t prevEncoder1;
+    uint32_t prevEncoder2;
+    mci_pose_t pose;
+} mci_odometry_t;
+
+/*----------------------------------------------------------------------------*/
+/*                               Debug Switches                               */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+/* shared w/ the tick task, only read or set w/ interrupts off */
+static volatile mci_odometry_t odometry;
+
+/* sin(i * 90 / 64 degrees) in 1/16384 */
+static const int16_t odometrySine[MCI_ODOMETRY_SINE_STEPS + 1u] =
+{
+        0,   402,   804,  1205,  1606,  2006,  2404,  2801,
+     3196,  3590,  3981,  4370,  4756,  5139,  5520,  5897,
+     6270,  6639,  7005,  7366,  7723,  8076,  8423,  8765,
+     9102,  9434,  9760, 10080, 10394, 10702, 11003, 11297,
+    11585, 11866, 12140, 12406, 12665, 12916, 13160, 13395,
+    13623, 13842, 14053, 14256, 14449, 14635, 14811, 14978,
+    15137, 15286, 15426, 15557, 15679, 15791, 15893, 15986,
+    16069, 16143, 16207, 16261, 16305, 16340, 16364, 16379,
+    16384,
+};
+
+/*----------------------------------------------------------------------------*/
+/*                    Private (Static) Function Prototype                     */
+/*----------------------------------------------------------------------------*/
+static int32_t mci_OdometrySine(uint32_t angle);
+static int32_t mci_OdometryAlong(int32_t distance, int32_t sine);
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+/**
+* Start the pose at 0 from the wheels' edge counts
+*
+* \param[in] encoder1 Left wheel edge count
+* \param[in] encoder2 Right wheel edge count
+* \retval None
+*/
+void mci_InitOdometry(uint32_t encoder1, uint32_t encoder2)
+{
+    mhi_DisableGlobalInterrupts();
+
+    odometry.prevEncoder1 = encoder1;
+    odometry.prevEncoder2 = encoder2;
+    odometry.pose.xUm = 0;
+    odometry.pose.yUm = 0;
+    odometry.pose.heading = 0u;
+
+    mhi_EnableGlobalInterrupts();
+}
+
+/**
+* Move the pose on by the edges the wheels got since the last update, from
+* the tick task
+*
+* \param[in] encoder1 Left wheel edge count
+* \param[in] encoder2 Right wheel edge count
+* \retval None
+*/
+void mci_UpdateOdometry(uint32_t encoder1, uint32_t encoder2)
+{
+    /* the counts may wrap, their difference does not */
+    int32_t left = (int32_t)(encoder1 - odometry.prevEncoder1);
+    int32_t right = (int32_t)(encoder2 - odometry.prevEncoder2);
+    uint32_t turn = 0u;
+    uint32_t heading = 0u;
+    int32_t distance = 0;
+
+    odometry.prevEncoder1 = encoder1;
+    odometry.prevEncoder2 = encoder2;
+    if ((left == 0) && (right == 0))
+    {
+        return;
+    }
+
+    /* clockwise as the left wheel gets ahead */
+    turn = (uint32_t)(left - right) * MCI_ODOMETRY_ANGLE_PER_EDGE;
+    heading = odometry.pose.heading + (uint32_t)((int32_t)turn / 2);
+    distance = ((left + right) * MCI_UM_PER_EDGE) / 2;
+
+    odometry.pose.xUm += mci_OdometryAlong(distance,
+        mci_OdometrySine(heading));
+    odometry.pose.yUm += mci_OdometryAlong(distance,
+        mci_OdometrySine(heading + MCI_POSE_ANGLE_90_DEGREES));
+    odometry.pose.heading += turn;
+}
+
+/**
+* Where the mouse is
+*
+* \param[out] p_pose Pose
+* \retval None
+*/
+void mci_GetPose(mci_pose_t* p_pose)
+{
+    mhi_DisableGlobalInterrupts();
+
+    *p_pose = odometry.pose;
+
+    mhi_EnableGlobalInterrupts();
+}
+
+/**
+* Put the mouse somewhere else, e.g. where a wall shows it is
+*
+* \param[in] p_pose Pose from now on
+* \retval None
+*/
+void mci_SetPose(const mci_pose_t* p_pose)
+{
+    mhi_DisableGlobalInterrupts();
+
+    odometry.pose = *p_pose;
+
+    mhi_EnableGlobalInterrupts();
+}
+
+/**
+* Round the heading to the maze grid, once the mouse is square w/ a wall
+*
+* \param None
+* \retval None
+*/
+void mci_AlignPoseHeading(void)
+{
+    mhi_DisableGlobalInterrupts();
+
+    odometry.pose.heading = (odometry.pose.heading
+        + (MCI_POSE_ANGLE_90_DEGREES / 2u))
+        & ~(MCI_POSE_ANGLE_90_DEGREES - 1u);
+
+    mhi_EnableGlobalInterrupts();
+}
+
+/*----------------------------------------------------------------------------*/
+/*                           Local Shared Functions                           */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                         Private (Static) Functions                         */
+/*----------------------------------------------------------------------------*/
+/**
+* Sine of a heading, the table mirrored to the other quarters
+*
+* \param[in] angle Heading, 2^32 to the turn
+* \retval Sine in 1/16384
+*/
+static int32_t mci_OdometrySine(uint32_t angle)
+{
+    uint32_t step = (angle >> MCI_ODOMETRY_SINE_STEP_SHIFT)
+        & (MCI_ODOMETRY_SINE_STEPS - 1u);
+    int32_t fraction = (int32_t)((angle >> 8) & 0xFFFFu);
+    int32_t from = 0;
+    int32_t to = 0;
+    int32_t sine = 0;
+
+    /* the second and fourth quarters run the table backwards */
+    if ((angle & MCI_POSE_ANGLE_90_DEGREES) != 0u)
+    {
+        from = odometrySine[MCI_ODOMETRY_SINE_STEPS - step];
+        to = odometrySine[MCI_ODOMETRY_SINE_STEPS - step - 1u];
+    }
+    else
+    {
+        from = odometrySine[step];
+        to = odometrySine[step + 1u];
+    }
+    sine = from + (((to - from) * fraction) >> 16);
+
+    /* and the second half turn is below 0 */
+    return ((angle & (MCI_POSE_ANGLE_90_DEGREES << 1)) != 0u) ? -sine : sine;
+}
+
+/**
+* Distance times a sine, rounded to the nearest
+*
+* \param[in] distance um
+* \param[in] sine     1/16384
+* \retval um
+*/
+static int32_t mci_OdometryAlong(int32_t distance, int32_t sine)
+{
+    return ((distance * sine) + (MCI_ODOMETRY_SINE_ONE / 2))
+        >> MCI_ODOMETRY_SINE_SHIFT;
+}
@@ -0,0 +1,57 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : odometry_mci.h
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : mouse control interface layer
+*
+* This is the header file for the mouse pose under the mouse control
+* interface.
+*
+* The control loop hands the odometry the wheels' edge counts every tick,
+* and the pose is worked out from how far each wheel got since the last
+* one, so the encoders never have to be cleared. The pose starts at 0 on
+* power up, and again once the mouse is put down in the start cell, see
+* mci_PlaceAtStart(): y is ahead along the heading it was put down w/, x
+* to the right of it.
+*
+* The heading is a binary angle, 2^32 to the full turn clockwise, so it
+* wraps round w/o ever being brought back into range. Headings on the
+* maze grid are multiples of MCI_POSE_ANGLE_90_DEGREES.
+*
+* The mouse control interface uses the mouse hardware interface to define high
+* level micromouse functionality.
+*-----------------------------------------------------------------------------*/
+
+#ifndef ODOMETRY_MCI_H_
+#define ODOMETRY_MCI_H_
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+/* a quarter turn of the heading */
+#define MCI_POSE_ANGLE_90_DEGREES    (0x40000000u)
+
+/* where the mouse is and which way it faces */
+typedef struct
+{
+    int32_t xUm;                /* to the right of the start heading */
+    int32_t yUm;                /* ahead along the start heading */
+    uint32_t heading;           /* clockwise, 2^32 to the turn */
+} mci_pose_t;
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+void mci_InitOdometry(uint32_t encoder1, uint32_t encoder2);
+void mci_UpdateOdometry(uint32_t encoder1, uint32_t encoder2);
+void mci_GetPose(mci_pose_t* p_pose);
+void mci_SetPose(const mci_pose_t* p_pose);
+void mci_AlignPoseHeading(void);
+
+#endif /* ODOMETRY_MCI_H_ */
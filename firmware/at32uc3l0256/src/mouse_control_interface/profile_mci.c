@@ -0,0 +1,356 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : profile_mci.c
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : mouse control interface layer
+*
+* This is the source file for motion profiles under the mouse control
+* interface.
+*
+* Each step picks the acceleration to head for: up to the max velocity,
+* or down to the end velocity once the distance left is no more than the
+* braking distance. The braking distance takes the time the jerk needs to
+* build up the deceleration, at the mean of the two velocities, on top of
+* the trapezoid's, so the profile brakes a little early rather than late.
+* Braking then decelerates just hard enough to get to the end velocity at
+* the distance, so braking early costs a gentler stop, not a crawl. W/ a
+* jerk the acceleration eases off early as well, so it is back at 0 when
+* the velocity gets to its target.
+*
+* The steps run in the control loop interrupt, so it is all integer math.
+*
+* The mouse control interface uses the mouse hardware interface to define high
+* level micromouse functionality.
+*-----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdbool.h>
+#include <stdint.h>
+#include "mouse_control_interface/profile_mci.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+/* braking never slows below acceleration / 64, not to crawl to the end */
+#define MCI_PROFILE_CREEP_SHIFT    (6)
+
+/*----------------------------------------------------------------------------*/
+/*                               Debug Switches                               */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                    Private (Static) Function Prototype                     */
+/*----------------------------------------------------------------------------*/
+static int64_t mci_ProfileBrakeDistanceQ16(const mci_profile_t* p_profile);
+static int64_t mci_ProfileBrakeAccelerationQ16(const mci_profile_t* p_profile);
+static int64_t mci_ProfileTargetAccelerationQ16(const mci_profile_t* p_profile,
+    int64_t targetVelocityQ16);
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+/**
+* Start a profile from its start velocity
+*
+* \param[out] p_profile Profile to start
+* \param[in]  p_params  Move to profile
+* \param[in]  rateHz    Steps per second
+* \retval None
+*/
+void mci_ProfileStart(mci_profile_t* p_profile,
+    const mci_profile_params_t* p_params, uint32_t rateHz)
+{
+    p_profile->params = *p_params;
+    if (p_profile->params.maxVelocity < 1)
+        p_profile->params.maxVelocity = 1;
+    if (p_profile->params.acceleration < 1)
+        p_profile->params.acceleration = 1;
+    p_profile->rateHz = rateHz;
+    p_profile->positionQ16 = 0;
+    p_profile->velocityQ16 = (int64_t)p_params->startVelocity << 16;
+    p_profile->accelerationQ16 = 0;
+    p_profile->braking = false;
+    p_profile->done = (p_params->distance <= 0);
+}
+
+/**
+* Move the setpoints on by one step
+*
+* \param[in,out] p_profile Profile in progress
+* \retval None
+*/
+void mci_ProfileStep(mci_profile_t* p_profile)
+{
+    const mci_profile_params_t* p_params = &p_profile->params;
+    int64_t rateHz = (int64_t)p_profile->rateHz;
+    int64_t distanceQ16 = (int64_t)p_params->distance << 16;
+    int64_t targetVelocityQ16 = (int64_t)p_params->maxVelocity << 16;
+    int64_t targetAccelerationQ16 = 0;
+    int64_t previousVelocityQ16 = 0;
+    int64_t jerkStepQ16 = 0;
+
+    if (p_profile->done)
+        return;
+
+    /* once braking, keep braking to the end */
+    if (!p_profile->braking
+        && ((distanceQ16 - p_profile->positionQ16)
+        <= mci_ProfileBrakeDistanceQ16(p_profile)))
+        p_profile->braking = true;
+
+    if (p_profile->braking)
+    {
+        /* never slower than the creep, or the end would take forever */
+        targetVelocityQ16 = ((int64_t)p_params->acceleration << 16)
+            >> MCI_PROFILE_CREEP_SHIFT;
+        if (targetVelocityQ16 < ((int64_t)p_params->endVelocity << 16))
+            targetVelocityQ16 = (int64_t)p_params->endVelocity << 16;
+    }
+
+    if (p_profile->braking && (p_profile->velocityQ16 > targetVelocityQ16))
+        targetAccelerationQ16 = -mci_ProfileBrakeAccelerationQ16(p_profile);
+    else
+        targetAccelerationQ16 = mci_ProfileTargetAccelerationQ16(p_profile,
+            targetVelocityQ16);
+
+    /* the jerk slews the acceleration, w/o one it steps */
+    if (p_params->jerk > 0)
+    {
+        jerkStepQ16 = ((int64_t)p_params->jerk << 16) / rateHz;
+        if (p_profile->accelerationQ16 + jerkStepQ16 < targetAccelerationQ16)
+            p_profile->accelerationQ16 += jerkStepQ16;
+        else if (p_profile->accelerationQ16 - jerkStepQ16
+            > targetAccelerationQ16)
+            p_profile->accelerationQ16 -= jerkStepQ16;
+        else
+            p_profile->accelerationQ16 = targetAccelerationQ16;
+    }
+    else
+        p_profile->accelerationQ16 = targetAccelerationQ16;
+
+    /* velocity, never past the one it heads for */
+    previousVelocityQ16 = p_profile->velocityQ16;
+    p_profile->velocityQ16 += p_profile->accelerationQ16 / rateHz;
+    if (((previousVelocityQ16 <= targetVelocityQ16)
+        && (p_profile->velocityQ16 > targetVelocityQ16))
+        || ((previousVelocityQ16 >= targetVelocityQ16)
+        && (p_profile->velocityQ16 < targetVelocityQ16)))
+    {
+        p_profile->velocityQ16 = targetVelocityQ16;
+        p_profile->accelerationQ16 = 0;
+    }
+
+    p_profile->positionQ16 += p_profile->velocityQ16 / rateHz;
+    if (p_profile->positionQ16 >= distanceQ16)
+    {
+        /* arrive at the end velocity, or what a short move got up to */
+        p_profile->positionQ16 = distanceQ16;
+        if (p_profile->braking)
+            p_profile->velocityQ16 = (int64_t)p_params->endVelocity << 16;
+        p_profile->accelerationQ16 = 0;
+        p_profile->done = true;
+    }
+}
+
+/**
+* Change the velocity a profile under way ends at, e.g. once the move after
+* it is known
+*
+* The profile brakes from then on for the new end velocity, or gets back up
+* to it if it was braking for a lower one. A done profile is left as it is.
+*
+* \param[in,out] p_profile   Profile in progress
+* \param[in]     endVelocity Per s, the max velocity at most
+* \retval None
+*/
+void mci_ProfileSetEndVelocity(mci_profile_t* p_profile, int32_t endVelocity)
+{
+    if (p_profile->done)
+        return;
+
+    if (endVelocity > p_profile->params.maxVelocity)
+        endVelocity = p_profile->params.maxVelocity;
+    p_profile->params.endVelocity = endVelocity;
+}
+
+/**
+* Whether the profile has covered its distance
+*
+* \param[in] p_profile Profile
+* \retval true once done
+*/
+bool mci_ProfileIsDone(const mci_profile_t* p_profile)
+{
+    return p_profile->done;
+}
+
+/**
+* Position setpoint
+*
+* \param[in] p_profile Profile
+* \retval Distance covered so far
+*/
+int32_t mci_ProfileGetPosition(const mci_profile_t* p_profile)
+{
+    return (int32_t)(p_profile->positionQ16 >> 16);
+}
+
+/**
+* Velocity setpoint, once done the velocity the next move starts w/
+*
+* \param[in] p_profile Profile
+* \retval Per s
+*/
+int32_t mci_ProfileGetVelocity(const mci_profile_t* p_profile)
+{
+    return (int32_t)(p_profile->velocityQ16 >> 16);
+}
+
+/**
+* Steps a profile takes, e.g. to time a move
+*
+* \param[in] p_params Move to profile
+* \param[in] rateHz   Steps per second
+* \retval Steps
+*/
+uint32_t mci_ProfileGetSteps(const mci_profile_params_t* p_params,
+    uint32_t rateHz)
+{
+    mci_profile_t profile;
+    uint32_t steps = 0u;
+
+    mci_ProfileStart(&profile, p_params, rateHz);
+    while (!profile.done)
+    {
+        mci_ProfileStep(&profile);
+        steps++;
+    }
+
+    return steps;
+}
+
+/*----------------------------------------------------------------------------*/
+/*                           Local Shared Functions                           */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                         Private (Static) Functions                         */
+/*----------------------------------------------------------------------------*/
+/**
+* Distance it takes to get from the velocity now to the end velocity
+*
+* \param[in] p_profile Profile in progress
+* \retval Distance in 1/65536, 0 if it is at or below the end velocity
+*/
+static int64_t mci_ProfileBrakeDistanceQ16(const mci_profile_t* p_profile)
+{
+    const mci_profile_params_t* p_params = &p_profile->params;
+    int64_t velocityQ16 = p_profile->velocityQ16;
+    int64_t endVelocityQ16 = (int64_t)p_params->endVelocity << 16;
+    int64_t accelerationQ16 = (int64_t)p_params->acceleration << 16;
+    int64_t jerkQ16 = (int64_t)p_params->jerk << 16;
+    int64_t distanceQ16 = 0;
+
+    /* still accelerating, the jerk takes a while to turn it round */
+    if ((p_params->jerk > 0) && (p_profile->accelerationQ16 > 0))
+    {
+        distanceQ16 = (velocityQ16 * p_profile->accelerationQ16) / jerkQ16;
+        velocityQ16 += (p_profile->accelerationQ16
+            * p_profile->accelerationQ16) / (2 * jerkQ16);
+    }
+
+    if (velocityQ16 <= endVelocityQ16)
+        return distanceQ16;
+
+    /* trapezoid: (v^2 - vEnd^2) / 2a */
+    distanceQ16 += ((velocityQ16 * velocityQ16)
+        - (endVelocityQ16 * endVelocityQ16)) / (2 * accelerationQ16);
+
+    /* S-curve: a / jerk longer, at the mean velocity */
+    if (p_params->jerk > 0)
+        distanceQ16 += (((velocityQ16 + endVelocityQ16) / 2)
+            * p_params->acceleration) / p_params->jerk;
+
+    /* and the step it takes to notice */
+    return distanceQ16 + (velocityQ16 / (int64_t)p_profile->rateHz);
+}
+
+/**
+* Deceleration that gets to the end velocity right at the distance
+*
+* \param[in] p_profile Profile in progress, above its end velocity
+* \retval Deceleration in 1/65536, up to the max acceleration
+*/
+static int64_t mci_ProfileBrakeAccelerationQ16(const mci_profile_t* p_profile)
+{
+    const mci_profile_params_t* p_params = &p_profile->params;
+    int64_t velocityQ16 = p_profile->velocityQ16;
+    int64_t endVelocityQ16 = (int64_t)p_params->endVelocity << 16;
+    int64_t maxAccelerationQ16 = (int64_t)p_params->acceleration << 16;
+    int64_t remainingQ16 = ((int64_t)p_params->distance << 16)
+        - p_profile->positionQ16;
+    int64_t accelerationQ16 = 0;
+
+    /* the jerk takes a while to build the deceleration up */
+    if (p_params->jerk > 0)
+        remainingQ16 -= (((velocityQ16 + endVelocityQ16) / 2)
+            * p_params->acceleration) / p_params->jerk;
+    if (remainingQ16 <= 0)
+        return maxAccelerationQ16;
+
+    /* (v^2 - vEnd^2) / 2d */
+    accelerationQ16 = ((velocityQ16 * velocityQ16)
+        - (endVelocityQ16 * endVelocityQ16)) / (2 * remainingQ16);
+    if (accelerationQ16 > maxAccelerationQ16)
+        accelerationQ16 = maxAccelerationQ16;
+
+    return accelerationQ16;
+}
+
+/**
+* Acceleration to head for to get to a velocity
+*
+* \param[in] p_profile         Profile in progress
+* \param[in] targetVelocityQ16 Velocity to get to, in 1/65536
+* \retval Acceleration in 1/65536
+*/
+static int64_t mci_ProfileTargetAccelerationQ16(const mci_profile_t* p_profile,
+    int64_t targetVelocityQ16)
+{
+    const mci_profile_params_t* p_params = &p_profile->params;
+    int64_t accelerationQ16 = p_profile->accelerationQ16;
+    int64_t maxAccelerationQ16 = (int64_t)p_params->acceleration << 16;
+    int64_t easeQ16 = 0;
+
+    /* velocity the acceleration still adds while the jerk takes it to 0 */
+    if (p_params->jerk > 0)
+        easeQ16 = (accelerationQ16 * accelerationQ16)
+            / (2 * ((int64_t)p_params->jerk << 16));
+
+    if (p_profile->velocityQ16 < targetVelocityQ16)
+    {
+        if ((accelerationQ16 > 0)
+            && (p_profile->velocityQ16 + easeQ16 >= targetVelocityQ16))
+            return 0;
+        return maxAccelerationQ16;
+    }
+    if (p_profile->velocityQ16 > targetVelocityQ16)
+    {
+        if ((accelerationQ16 < 0)
+            && (p_profile->velocityQ16 - easeQ16 <= targetVelocityQ16))
+            return 0;
+        return -maxAccelerationQ16;
+    }
+
+    return 0;
+}
@@ -0,0 +1,75 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : profile_mci.h
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : mouse control interface layer
+*
+* This is the header file for motion profiles under the mouse control
+* interface.
+*
+* A profile hands the control loop a position and velocity setpoint every
+* tick, to cover a distance w/o going over the max velocity, acceleration
+* or jerk, and to arrive at the end velocity. A jerk of 0 makes a trapezoid,
+* the acceleration steps straight to its limit; any other jerk makes an
+* S-curve. The profile is worked out a tick at a time, it brakes once the
+* distance left is down to what it takes to get to the end velocity, so it
+* needs no solving up front and a move can be changed while it runs, e.g.
+* its end velocity once the next move is known.
+*
+* Profiles have no unit of their own, the same profile drives encoder edges
+* or millimetres. The velocity a profile ends at is the velocity the next
+* one starts w/, so moves chain w/o stopping in between.
+*
+* The mouse control interface uses the mouse hardware interface to define high
+* level micromouse functionality.
+*-----------------------------------------------------------------------------*/
+
+#ifndef PROFILE_MCI_H_
+#define PROFILE_MCI_H_
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+/* move to profile, lengths in any one unit, times in seconds */
+typedef struct
+{
+    int32_t distance;          /* 0 or more */
+    int32_t maxVelocity;       /* per s, more than 0 */
+    int32_t acceleration;      /* per s^2, more than 0 */
+    int32_t jerk;              /* per s^3, 0 for a trapezoid */
+    int32_t startVelocity;     /* per s, what the last move ended at */
+    int32_t endVelocity;       /* per s, what the next move starts at */
+} mci_profile_params_t;
+
+/* profile in progress, all in 1/65536 of the unit */
+typedef struct
+{
+    mci_profile_params_t params;
+    uint32_t rateHz;           /* steps per second */
+    int64_t positionQ16;
+    int64_t velocityQ16;
+    int64_t accelerationQ16;
+    bool braking;
+    bool done;
+} mci_profile_t;
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+void mci_ProfileStart(mci_profile_t* p_profile,
+    const mci_profile_params_t* p_params, uint32_t rateHz);
+void mci_ProfileStep(mci_profile_t* p_profile);
+void mci_ProfileSetEndVelocity(mci_profile_t* p_profile, int32_t endVelocity);
+bool mci_ProfileIsDone(const mci_profile_t* p_profile);
+int32_t mci_ProfileGetPosition(const mci_profile_t* p_profile);
+int32_t mci_ProfileGetVelocity(const mci_profile_t* p_profile);
+uint32_t mci_ProfileGetSteps(const mci_profile_params_t* p_params,
+    uint32_t rateHz);
+
+#endif /* PROFILE_MCI_H_ */
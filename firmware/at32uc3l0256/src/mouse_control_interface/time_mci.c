@@ -73,15 +73,14 @@ void mci_ResetTimer(void)
 * Get time elapsed from start time
 *
 * \param None
-* \retval None
+* \retval Milliseconds since the timer was started or reset
 */
 uint32_t mci_GetTimeMs(void)
 {
     int32_t currentTime = mhi_GetTimerCount();
     uint32_t timeElapsed = (uint32_t)(currentTime - startTime);
-    timeElapsed *= 8;
     
-    return timeElapsed;
+    return mhi_TimerCountToMs(timeElapsed);
 }
 
 /**
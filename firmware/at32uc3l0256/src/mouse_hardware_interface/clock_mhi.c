@@ -89,6 +89,41 @@ void mhi_DelayUs(const uint32_t delayTime)
     clockInterface->clock_DelayUs(delayTime);
 }
 
+/**
+* Get CPU cycle count for micromouse, for timing code shorter than a timer
+* counter tick.
+*
+* \param None
+* \retval CPU cycles counted, wraps
+*/
+uint32_t mhi_GetCycleCount(void)
+{
+    uint32_t cycleCount = 0u;
+    clock_handler_t *clockInterface = NULL;
+    config_GetClockHandler(&clockInterface);
+    
+    clockInterface->clock_GetCycleCount(&cycleCount);
+    
+    return cycleCount;
+}
+
+/**
+* CPU cycle count to microseconds for micromouse.
+*
+* \param[in] count CPU cycles
+* \retval Time in microseconds
+*/
+uint32_t mhi_CycleCountToUs(uint32_t count)
+{
+    uint32_t timeUs = 0u;
+    clock_handler_t *clockInterface = NULL;
+    config_GetClockHandler(&clockInterface);
+    
+    clockInterface->clock_CycleCountToUs(count, &timeUs);
+    
+    return timeUs;
+}
+
 /*----------------------------------------------------------------------------*/
 /*                           Local Shared Functions                           */
 /*----------------------------------------------------------------------------*/
@@ -30,5 +30,7 @@
 void mhi_InitClock(void);                      /* init clock sources */
 void mhi_DelayMs(const uint32_t delayTime);    /* delay ms */
 void mhi_DelayUs(const uint32_t delayTime);    /* delay us */
+uint32_t mhi_GetCycleCount(void);              /* get CPU cycle count */
+uint32_t mhi_CycleCountToUs(uint32_t count);   /* translate cycles to us */
 
 #endif /* CLOCK_MHI_H_ */
\ No newline at end of file
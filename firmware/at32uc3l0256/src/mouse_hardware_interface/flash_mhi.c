@@ -0,0 +1,123 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : flash_mhi.c
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : mouse hardware interface layer
+*
+* This is the source file for the mouse flash storage interface.
+*
+* Unlike the other interfaces a flash error does not halt the mouse, the
+* storage only keeps what the mouse can learn again, so errors are handed
+* back for the caller to carry on without it.
+*
+* The mouse hardware interface uses the HAL to define functions needed to
+* interface w/ all mouse hardware.
+*-----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "HAL/HAL_contracts/flash_contract.h"
+#include "HAL/HAL_configs/flash_config.h"
+#include "flash_mhi.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                               Debug Switches                               */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                    Private (Static) Function Prototype                     */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+/**
+* Get size of the flash storage region for micromouse.
+*
+* \param[out] p_pageSize Bytes per erase page
+* \param[out] p_pageCount Pages in the storage region
+* \retval true on success
+*/
+bool mhi_GetFlashStoreGeometry(uint32_t* p_pageSize, uint32_t* p_pageCount)
+{
+    flash_handler_t *flashInterface = NULL;
+    config_GetFlashHandler(&flashInterface);
+    
+    return flashInterface->flash_GetStoreGeometry(p_pageSize, p_pageCount)
+        == FLASH_SUCCESS;
+}
+
+/**
+* Read from the flash storage region for micromouse.
+*
+* \param[in] offset Byte offset into the storage region
+* \param[out] p_dest Buffer to read into
+* \param[in] size Bytes to read
+* \retval true on success
+*/
+bool mhi_ReadFlashStore(uint32_t offset, void* p_dest, uint32_t size)
+{
+    flash_handler_t *flashInterface = NULL;
+    config_GetFlashHandler(&flashInterface);
+    
+    return flashInterface->flash_ReadStore(offset, p_dest, size)
+        == FLASH_SUCCESS;
+}
+
+/**
+* Erase a page of the flash storage region for micromouse.
+*
+* \param[in] page Page of the storage region, 0 is the first
+* \retval true on success
+*/
+bool mhi_EraseFlashStorePage(uint32_t page)
+{
+    flash_handler_t *flashInterface = NULL;
+    config_GetFlashHandler(&flashInterface);
+    
+    return flashInterface->flash_EraseStorePage(page) == FLASH_SUCCESS;
+}
+
+/**
+* Write to erased flash in the storage region for micromouse.
+*
+* \param[in] offset Byte offset into the storage region
+* \param[in] p_src Data to write
+* \param[in] size Bytes to write
+* \retval true on success
+*/
+bool mhi_WriteFlashStore(uint32_t offset, const void* p_src, uint32_t size)
+{
+    flash_handler_t *flashInterface = NULL;
+    config_GetFlashHandler(&flashInterface);
+    
+    return flashInterface->flash_WriteStore(offset, p_src, size)
+        == FLASH_SUCCESS;
+}
+
+/*----------------------------------------------------------------------------*/
+/*                           Local Shared Functions                           */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                         Private (Static) Functions                         */
+/*----------------------------------------------------------------------------*/
+/* None */
@@ -0,0 +1,39 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : flash_mhi.h
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : mouse hardware interface layer
+*
+* This is the header file for the mouse flash storage interface.
+*
+* The mouse hardware interface uses the HAL to define functions needed to
+* interface w/ all mouse hardware.
+*-----------------------------------------------------------------------------*/
+
+#ifndef FLASH_MHI_H_
+#define FLASH_MHI_H_
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+/* storage region size */
+bool mhi_GetFlashStoreGeometry(uint32_t* p_pageSize, uint32_t* p_pageCount);
+/* read from the storage region */
+bool mhi_ReadFlashStore(uint32_t offset, void* p_dest, uint32_t size);
+/* erase a page of the storage region */
+bool mhi_EraseFlashStorePage(uint32_t page);
+/* write to erased flash in the storage region */
+bool mhi_WriteFlashStore(uint32_t offset, const void* p_src, uint32_t size);
+
+#endif /* FLASH_MHI_H_ */
@@ -39,7 +39,7 @@
 /*----------------------------------------------------------------------------*/
 /*                    Private (Static) Function Prototype                     */
 /*----------------------------------------------------------------------------*/
-/* None */
+static uint32_t mhi_TimerCountsToNs(uint32_t counts, uint32_t counterClockHz);
 
 /*----------------------------------------------------------------------------*/
 /*                       Public (Exportable) Functions                        */
@@ -84,13 +84,114 @@ uint32_t mhi_GetTimerCount(void)
 /**
 * Timer count to milliseconds for micromouse.
 *
+* \param[in] count Timer counter ticks
+* \retval Milliseconds
+*/
+uint32_t mhi_TimerCountToMs(uint32_t count)
+{
+    uint32_t tickRateHz = mhi_GetTimerTickRateHz();
+    
+    /* whole seconds first so long counts do not overflow */
+    return ((count / tickRateHz) * 1000u)
+        + (((count % tickRateHz) * 1000u) / tickRateHz);
+}
+
+/**
+* Get timer counter tick rate for micromouse.
+*
 * \param  None
+* \retval Ticks per second
+*/
+uint32_t mhi_GetTimerTickRateHz(void)
+{
+    uint32_t tickRateHz = 0u;
+    tc_handler_t *tcInterface = NULL;
+    config_GetTcHandler(&tcInterface);
+    
+    if ((tcInterface->tc_GetTickRateHz(&tickRateHz) == TC_ERROR)
+        || (tickRateHz == 0u))
+    {
+        mhi_IndicateError(MHI_LEDS_TC_ERROR);
+    }
+    
+    return tickRateHz;
+}
+
+/**
+* Set the task the timer counter interrupt runs every tick for micromouse.
+*
+* The task runs in the interrupt, so it has to return well within a tick.
+*
+* \param[in] task Function to run, NULL for none
 * \retval None
 */
-uint32_t mhi_TimerCountToMs(uint32_t count)
+void mhi_SetTimerTickTask(mhi_timer_tick_task_t task)
+{
+    tc_handler_t *tcInterface = NULL;
+    config_GetTcHandler(&tcInterface);
+    
+    if (tcInterface->tc_SetTickHandler(task) == TC_ERROR)
+    {
+        mhi_IndicateError(MHI_LEDS_TC_ERROR);
+    }
+}
+
+/**
+* Get timing of the tick task for micromouse.
+*
+* \param[out] p_stats Tick timing since the stats were last cleared
+* \retval None
+*/
+void mhi_GetTimerTickStats(mhi_timer_tick_stats_t* p_stats)
+{
+    tc_tick_stats_t tickStats;
+    tc_handler_t *tcInterface = NULL;
+    config_GetTcHandler(&tcInterface);
+    
+    if (tcInterface->tc_GetTickStats(&tickStats) == TC_ERROR)
+    {
+        mhi_IndicateError(MHI_LEDS_TC_ERROR);
+    }
+    
+    p_stats->tickCount = tickStats.tickCount;
+    p_stats->overrunCount = tickStats.overrunCount;
+    p_stats->periodNs = mhi_TimerCountsToNs(tickStats.periodCounts,
+        tickStats.counterClockHz);
+    
+    /* no tick measured yet */
+    if (tickStats.tickCount == 0u)
+    {
+        p_stats->minLatencyNs = 0u;
+        p_stats->maxLatencyNs = 0u;
+        p_stats->jitterNs = 0u;
+        p_stats->maxRunNs = 0u;
+        return;
+    }
+    
+    p_stats->minLatencyNs = mhi_TimerCountsToNs(tickStats.minLatencyCounts,
+        tickStats.counterClockHz);
+    p_stats->maxLatencyNs = mhi_TimerCountsToNs(tickStats.maxLatencyCounts,
+        tickStats.counterClockHz);
+    p_stats->jitterNs = p_stats->maxLatencyNs - p_stats->minLatencyNs;
+    p_stats->maxRunNs = mhi_TimerCountsToNs(tickStats.maxRunCounts,
+        tickStats.counterClockHz);
+}
+
+/**
+* Restart timing of the tick task for micromouse.
+*
+* \param  None
+* \retval None
+*/
+void mhi_ClearTimerTickStats(void)
 {
-    /* varies w/ timer counter configuration */
-    return count*17;
+    tc_handler_t *tcInterface = NULL;
+    config_GetTcHandler(&tcInterface);
+    
+    if (tcInterface->tc_ClearTickStats() == TC_ERROR)
+    {
+        mhi_IndicateError(MHI_LEDS_TC_ERROR);
+    }
 }
 
 /*----------------------------------------------------------------------------*/
@@ -101,4 +202,14 @@ uint32_t mhi_TimerCountToMs(uint32_t count)
 /*----------------------------------------------------------------------------*/
 /*                         Private (Static) Functions                         */
 /*----------------------------------------------------------------------------*/
-/* None */
+/**
+* Timer counter clocks to nanoseconds.
+*
+* \param[in] counts Counter clocks, a tick or less
+* \param[in] counterClockHz Counter clocks per second
+* \retval Nanoseconds
+*/
+static uint32_t mhi_TimerCountsToNs(uint32_t counts, uint32_t counterClockHz)
+{
+    return (uint32_t)(((uint64_t)counts * 1000000000u) / counterClockHz);
+}
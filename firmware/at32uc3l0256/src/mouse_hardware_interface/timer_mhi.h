@@ -17,7 +17,20 @@
 /*----------------------------------------------------------------------------*/
 /*                                Definitions                                 */
 /*----------------------------------------------------------------------------*/
-/* None */
+/* work the timer counter interrupt runs every tick */
+typedef void (*mhi_timer_tick_task_t)(void);
+
+/* timing of the tick task since the stats were cleared */
+typedef struct
+{
+    uint32_t tickCount;        /* ticks measured */
+    uint32_t overrunCount;     /* tasks still running at the next tick */
+    uint32_t periodNs;         /* tick period */
+    uint32_t minLatencyNs;     /* tick to task start, shortest */
+    uint32_t maxLatencyNs;     /* tick to task start, longest */
+    uint32_t jitterNs;         /* spread of the task start */
+    uint32_t maxRunNs;         /* task run time, longest */
+} mhi_timer_tick_stats_t;
 
 /*----------------------------------------------------------------------------*/
 /*                              Global Variables                              */
@@ -30,5 +43,9 @@
 void mhi_InitTimerCounter(void);                /* init timer counter */
 uint32_t mhi_GetTimerCount(void);               /* get timer counter count */
 uint32_t mhi_TimerCountToMs(uint32_t count);    /* translate count to ms */
+uint32_t mhi_GetTimerTickRateHz(void);          /* ticks per second */
+void mhi_SetTimerTickTask(mhi_timer_tick_task_t task); /* run every tick */
+void mhi_GetTimerTickStats(mhi_timer_tick_stats_t* p_stats); /* tick timing */
+void mhi_ClearTimerTickStats(void);             /* restart tick timing */
 
 #endif /* TIMER_MHI_H_ */
\ No newline at end of file
@@ -0,0 +1,83 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : crc_sf.c
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : shared functions layer
+*
+* This is the source file for the CRC function.
+*
+* Shared functions are used by the mouse control interface for generic
+* functionality.
+*-----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdint.h>
+#include "shared_functions/crc_sf.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+#define SF_CRC16_POLY    (0x1021u)    /* x^16 + x^12 + x^5 + 1 */
+
+/*----------------------------------------------------------------------------*/
+/*                               Debug Switches                               */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                    Private (Static) Function Prototype                     */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+/**
+* CRC-16/CCITT of a block of bytes
+*
+* Bitwise, no table, it only runs over a few hundred bytes when the maze is
+* saved or restored. Pass SF_CRC16_INIT to start and the last result to carry
+* on over more blocks.
+*
+* \param[in] crc Running CRC
+* \param[in] p_data Bytes to add
+* \param[in] size Number of bytes
+* \retval updated CRC
+*/
+uint16_t sf_Crc16(uint16_t crc, const void* p_data, uint32_t size)
+{
+    const uint8_t* p_byte = (const uint8_t*)p_data;
+    unsigned int bit = 0u;
+    
+    while (size--)
+    {
+        crc ^= (uint16_t)((uint16_t)*p_byte++ << 8);
+        for (bit = 0u; bit < 8u; bit++)
+        {
+            if (crc & 0x8000u)
+                crc = (uint16_t)((crc << 1) ^ SF_CRC16_POLY);
+            else
+                crc = (uint16_t)(crc << 1);
+        }
+    }
+    
+    return crc;
+}
+
+/*----------------------------------------------------------------------------*/
+/*                           Local Shared Functions                           */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                         Private (Static) Functions                         */
+/*----------------------------------------------------------------------------*/
+/* None */
@@ -0,0 +1,32 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : crc_sf.h
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : shared functions layer
+*
+* This is the header file for the CRC function.
+*
+* Shared functions are used by the mouse control interface for generic
+* functionality.
+*-----------------------------------------------------------------------------*/
+
+#ifndef CRC_SF_H_
+#define CRC_SF_H_
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+#define SF_CRC16_INIT    (0xFFFFu)    /* CRC-16/CCITT-FALSE start value */
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+/* None */
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+uint16_t sf_Crc16(uint16_t crc, const void* p_data, uint32_t size);
+
+#endif /* CRC_SF_H_ */
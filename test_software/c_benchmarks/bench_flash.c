@@ -0,0 +1,187 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : bench_flash.c
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : host benchmark
+*
+* Simulated flash storage region w/ the mhi flash functions on top of it.
+*
+* Like flashcdw_memcpy() every write programs each page it touches once, so
+* page writes count the program cycles the real part would run.
+*-----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "mouse_hardware_interface/flash_mhi.h"
+#include "bench_flash.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+#define BENCH_FLASH_SIZE    (BENCH_FLASH_PAGE_SIZE * BENCH_FLASH_PAGE_COUNT)
+
+typedef struct
+{
+    uint8_t data[BENCH_FLASH_SIZE];
+    bench_flash_stats_t stats;
+    int64_t powerLeft;          /* bytes left to write, < 0 = no cut */
+} bench_flash_t;
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+static bench_flash_t* benchFlash = NULL;
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+/**
+* Map the shared region, erase it and clear the stats
+*
+* \param None
+* \retval None
+*/
+void bench_FlashInit(void)
+{
+    if (benchFlash == NULL)
+    {
+        benchFlash = mmap(NULL, sizeof(*benchFlash), PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+        if (benchFlash == MAP_FAILED)
+        {
+            perror("bench flash");
+            exit(1);
+        }
+    }
+
+    memset(benchFlash->data, 0xFF, sizeof(benchFlash->data));
+    bench_FlashClearStats();
+    benchFlash->powerLeft = -1;
+}
+
+/**
+* Zero the erase, write and read counts
+*
+* \param None
+* \retval None
+*/
+void bench_FlashClearStats(void)
+{
+    memset(&benchFlash->stats, 0, sizeof(benchFlash->stats));
+}
+
+/**
+* Erase, write and read counts since the last clear
+*
+* \param None
+* \retval Stats, shared w/ child processes
+*/
+const bench_flash_stats_t* bench_FlashGetStats(void)
+{
+    return &benchFlash->stats;
+}
+
+/**
+* Flash time the target would have spent since a copy of the stats
+*
+* \param[in] p_before Stats copied before
+* \retval Estimated page program and erase time
+*/
+uint64_t bench_FlashEstimateUs(const bench_flash_stats_t* p_before)
+{
+    const bench_flash_stats_t* p_now = &benchFlash->stats;
+    uint64_t erases = 0u;
+    unsigned int page = 0u;
+
+    for (page = 0u; page < BENCH_FLASH_PAGE_COUNT; page++)
+        erases += p_now->erases[page] - p_before->erases[page];
+
+    return (p_now->pageWrites - p_before->pageWrites) * BENCH_FLASH_PAGE_WRITE_US
+        + erases * BENCH_FLASH_PAGE_ERASE_US;
+}
+
+/**
+* Cut the power once this many more bytes are written, the process exits
+* w/ BENCH_FLASH_POWER_CUT_EXIT leaving the write half done
+*
+* \param[in] bytes Bytes still written, < 0 to never cut
+* \retval None
+*/
+void bench_FlashCutPowerAfter(int64_t bytes)
+{
+    benchFlash->powerLeft = bytes;
+}
+
+/**
+* mhi_GetFlashStoreGeometry() on the simulated region
+*/
+bool mhi_GetFlashStoreGeometry(uint32_t* p_pageSize, uint32_t* p_pageCount)
+{
+    *p_pageSize = BENCH_FLASH_PAGE_SIZE;
+    *p_pageCount = BENCH_FLASH_PAGE_COUNT;
+    return true;
+}
+
+/**
+* mhi_ReadFlashStore() on the simulated region
+*/
+bool mhi_ReadFlashStore(uint32_t offset, void* p_dest, uint32_t size)
+{
+    if ((uint64_t)offset + size > BENCH_FLASH_SIZE)
+        return false;
+
+    memcpy(p_dest, &benchFlash->data[offset], size);
+    benchFlash->stats.bytesRead += size;
+    return true;
+}
+
+/**
+* mhi_EraseFlashStorePage() on the simulated region
+*/
+bool mhi_EraseFlashStorePage(uint32_t page)
+{
+    if (page >= BENCH_FLASH_PAGE_COUNT)
+        return false;
+
+    memset(&benchFlash->data[page * BENCH_FLASH_PAGE_SIZE], 0xFF,
+        BENCH_FLASH_PAGE_SIZE);
+    benchFlash->stats.erases[page]++;
+    return true;
+}
+
+/**
+* mhi_WriteFlashStore() on the simulated region, NOR flash only clears bits
+*/
+bool mhi_WriteFlashStore(uint32_t offset, const void* p_src, uint32_t size)
+{
+    const uint8_t* p_byte = (const uint8_t*)p_src;
+    uint32_t i = 0u;
+
+    if ((uint64_t)offset + size > BENCH_FLASH_SIZE)
+        return false;
+
+    if (size > 0u)
+        benchFlash->stats.pageWrites += (offset + size - 1u) / BENCH_FLASH_PAGE_SIZE
+            - offset / BENCH_FLASH_PAGE_SIZE + 1u;
+
+    for (i = 0u; i < size; i++)
+    {
+        if (benchFlash->powerLeft == 0)
+            _exit(BENCH_FLASH_POWER_CUT_EXIT);
+        if (benchFlash->powerLeft > 0)
+            benchFlash->powerLeft--;
+        benchFlash->data[offset + i] &= p_byte[i];
+        benchFlash->stats.bytesWritten++;
+    }
+
+    return true;
+}
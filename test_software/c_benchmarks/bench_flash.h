@@ -0,0 +1,55 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : bench_flash.h
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : host benchmark
+*
+* This is the header file for the simulated flash storage region.
+*
+* Stands in for mouse_hardware_interface/flash_mhi.c on the host. The region
+* has the size and page size of the AT32UC3L0256 one and behaves like NOR
+* flash: erasing sets a page to 0xFF and writing can only clear bits. It
+* lives in memory shared w/ child processes, so a benchmark can boot the
+* algo layer fresh in a child and cut its power in the middle of a write.
+*-----------------------------------------------------------------------------*/
+
+#ifndef BENCH_FLASH_H_
+#define BENCH_FLASH_H_
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdint.h>
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+#define BENCH_FLASH_PAGE_SIZE       (512u)      /* AVR32_FLASHCDW_PAGE_SIZE */
+#define BENCH_FLASH_PAGE_COUNT      (16u)       /* MM_FLASH_STORE_PAGE_COUNT */
+
+/* datasheet page program and page erase times */
+#define BENCH_FLASH_PAGE_WRITE_US   (5000u)
+#define BENCH_FLASH_PAGE_ERASE_US   (5000u)
+
+/* exit status of a child whose power was cut */
+#define BENCH_FLASH_POWER_CUT_EXIT  (42)
+
+typedef struct
+{
+    uint32_t erases[BENCH_FLASH_PAGE_COUNT];    /* erases per page */
+    uint64_t pageWrites;        /* page program cycles */
+    uint64_t bytesWritten;
+    uint64_t bytesRead;
+} bench_flash_stats_t;
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+void bench_FlashInit(void);
+void bench_FlashClearStats(void);
+const bench_flash_stats_t* bench_FlashGetStats(void);
+uint64_t bench_FlashEstimateUs(const bench_flash_stats_t* p_before);
+void bench_FlashCutPowerAfter(int64_t bytes);
+
+#endif /* BENCH_FLASH_H_ */
@@ -0,0 +1,308 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : bench_maze.c
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : host benchmark
+*
+* Helpers shared by the host benchmarks: random maze generators and a cycle
+* counter time stamp.
+*-----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include "algo/algo.h"
+#include "algo/mazemap_algo.h"
+#include "bench_maze.h"
+
+/*----------------------------------------------------------------------------*/
+/*                    Private (Static) Function Prototype                     */
+/*----------------------------------------------------------------------------*/
+static bool bench_IsGoalOutline(unsigned int x, unsigned int y,
+    unsigned int dir);
+static bool bench_ConnectOnce(algo_maze_map_t* p_maze);
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+/**
+* Time stamp in CPU cycles where available, nanoseconds otherwise
+*
+* \param None
+* \retval Time stamp
+*/
+uint64_t bench_Now(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * 1000000000u) + (uint64_t)now.tv_nsec;
+#endif
+}
+
+/**
+* Carve a random maze w/ an iterative depth first search, then knock out a
+* few extra walls so there is more than one route to the goal
+*
+* \param[out] p_maze Maze w/ every wall known
+* \param[in]  seed   Random seed
+* \retval None
+*/
+void bench_GenerateMaze(algo_maze_map_t* p_maze, unsigned int seed)
+{
+    static uint16_t stack[ALGO_MAZE_CELL_COUNT];
+    static uint8_t carved[ALGO_MAZE_CELL_COUNT];
+    unsigned int top = 0u;
+    unsigned int x = 0u;
+    unsigned int y = 0u;
+    unsigned int dirs[4];
+    unsigned int dirCount = 0u;
+    unsigned int dir = 0u;
+    unsigned int idx = 0u;
+    unsigned int i = 0u;
+
+    srand(seed);
+    memset(carved, 0, sizeof(carved));
+    algo_MazeMapClear(p_maze);
+    for (y = 0u; y < ALGO_MAZE_HEIGHT; y++)
+        for (x = 0u; x < ALGO_MAZE_WIDTH; x++)
+        {
+            algo_MazeMapSetWall(p_maze, x, y, NORTH, TRUE);
+            algo_MazeMapSetWall(p_maze, x, y, EAST, TRUE);
+        }
+
+    stack[top++] = (uint16_t)ALGO_MAZE_IDX(0u, 0u);
+    carved[ALGO_MAZE_IDX(0u, 0u)] = 1u;
+    while (top > 0u)
+    {
+        idx = stack[top - 1u];
+        x = ALGO_MAZE_IDX_X(idx);
+        y = ALGO_MAZE_IDX_Y(idx);
+
+        dirCount = 0u;
+        if ((y + 1 < ALGO_MAZE_HEIGHT) && !carved[ALGO_MAZE_IDX(x, y + 1)])
+            dirs[dirCount++] = NORTH;
+        if ((y > 0u) && !carved[ALGO_MAZE_IDX(x, y - 1)])
+            dirs[dirCount++] = SOUTH;
+        if ((x + 1 < ALGO_MAZE_WIDTH) && !carved[ALGO_MAZE_IDX(x + 1, y)])
+            dirs[dirCount++] = EAST;
+        if ((x > 0u) && !carved[ALGO_MAZE_IDX(x - 1, y)])
+            dirs[dirCount++] = WEST;
+
+        if (dirCount == 0u)
+        {
+            top--;
+            continue;
+        }
+
+        dir = dirs[(unsigned int)rand() % dirCount];
+        algo_MazeMapSetWall(p_maze, x, y, dir, FALSE);
+        if (dir == NORTH)
+            y++;
+        else if (dir == SOUTH)
+            y--;
+        else if (dir == EAST)
+            x++;
+        else
+            x--;
+        carved[ALGO_MAZE_IDX(x, y)] = 1u;
+        stack[top++] = (uint16_t)ALGO_MAZE_IDX(x, y);
+    }
+
+    for (i = 0u; i < (ALGO_MAZE_CELL_COUNT / 8u); i++)
+    {
+        x = (unsigned int)rand() % (ALGO_MAZE_WIDTH - 1);
+        y = (unsigned int)rand() % (ALGO_MAZE_HEIGHT - 1);
+        algo_MazeMapSetWall(p_maze, x, y,
+            ((unsigned int)rand() % 2u) ? NORTH : EAST, FALSE);
+    }
+}
+
+/**
+* Random maze that follows the competition rules wall inference relies on:
+* the goal is a room w/ one entrance and every post but the one in the
+* middle of the goal has a wall
+*
+* \param[out] p_maze Maze w/ every wall known, every cell reachable
+* \param[in]  seed   Random seed
+* \retval None
+*/
+void bench_GenerateCompetitionMaze(algo_maze_map_t* p_maze, unsigned int seed)
+{
+    static uint16_t entrances[4u * ALGO_MAZE_CELL_COUNT];
+    unsigned int entranceCount = 0u;
+    unsigned int idx = 0u;
+    unsigned int px = 0u;
+    unsigned int py = 0u;
+    unsigned int x = 0u;
+    unsigned int y = 0u;
+    unsigned int dir = 0u;
+
+    bench_GenerateMaze(p_maze, seed);
+
+    /* goal room: open inside, closed outline but for one entrance */
+    for (y = ALGO_MAZE_GOAL_Y_MIN; y <= ALGO_MAZE_GOAL_Y_MAX; y++)
+        for (x = ALGO_MAZE_GOAL_X_MIN; x <= ALGO_MAZE_GOAL_X_MAX; x++)
+            for (dir = NORTH; dir <= WEST; dir++)
+            {
+                algo_MazeMapSetWall(p_maze, x, y, dir, bench_IsGoalOutline(x, y, dir));
+                /* the outer walls are always there, they cannot be the entrance */
+                if (bench_IsGoalOutline(x, y, dir)
+                    && !((dir == NORTH) && (y + 1u == ALGO_MAZE_HEIGHT))
+                    && !((dir == SOUTH) && (y == 0u))
+                    && !((dir == EAST) && (x + 1u == ALGO_MAZE_WIDTH))
+                    && !((dir == WEST) && (x == 0u)))
+                    entrances[entranceCount++] = (uint16_t)((ALGO_MAZE_IDX(x, y) << 2) | dir);
+            }
+    if (entranceCount > 0u)
+    {
+        idx = entrances[(unsigned int)rand() % entranceCount];
+        algo_MazeMapSetWall(p_maze, ALGO_MAZE_IDX_X(idx >> 2),
+            ALGO_MAZE_IDX_Y(idx >> 2), idx & 3u, FALSE);
+    }
+
+    /* closing the outline may have cut cells off, open walls until not */
+    while (bench_ConnectOnce(p_maze))
+        ;
+
+    /* a post w/o walls has the four cells around it in a ring, so any one */
+    /* of its arms can be closed w/o cutting a cell off */
+    for (py = 1u; py < ALGO_MAZE_HEIGHT; py++)
+        for (px = 1u; px < ALGO_MAZE_WIDTH; px++)
+        {
+            if ((px > ALGO_MAZE_GOAL_X_MIN) && (px <= ALGO_MAZE_GOAL_X_MAX)
+                && (py > ALGO_MAZE_GOAL_Y_MIN) && (py <= ALGO_MAZE_GOAL_Y_MAX))
+                continue;
+            if (algo_MazeMapHasWall(p_maze, px - 1u, py, EAST)
+                || algo_MazeMapHasWall(p_maze, px - 1u, py - 1u, EAST)
+                || algo_MazeMapHasWall(p_maze, px, py - 1u, NORTH)
+                || algo_MazeMapHasWall(p_maze, px - 1u, py - 1u, NORTH))
+                continue;
+
+            switch ((unsigned int)rand() % 4u)
+            {
+                case 0u:
+                    algo_MazeMapSetWall(p_maze, px - 1u, py, EAST, TRUE);
+                    break;
+                case 1u:
+                    algo_MazeMapSetWall(p_maze, px - 1u, py - 1u, EAST, TRUE);
+                    break;
+                case 2u:
+                    algo_MazeMapSetWall(p_maze, px, py - 1u, NORTH, TRUE);
+                    break;
+                default:
+                    algo_MazeMapSetWall(p_maze, px - 1u, py - 1u, NORTH, TRUE);
+                    break;
+            }
+        }
+}
+
+/*----------------------------------------------------------------------------*/
+/*                         Private (Static) Functions                         */
+/*----------------------------------------------------------------------------*/
+/**
+* Whether one side of a cell is on the outline of the goal rectangle
+*
+* \param[in] x   Cell column
+* \param[in] y   Cell row
+* \param[in] dir Side of the cell (NORTH, SOUTH, EAST, WEST)
+* \retval TRUE if the cell is a goal cell and its neighbor on that side is not
+*/
+static bool bench_IsGoalOutline(unsigned int x, unsigned int y,
+    unsigned int dir)
+{
+    if (!ALGO_MAZE_IS_GOAL(x, y))
+        return FALSE;
+
+    switch (dir)
+    {
+        case NORTH:
+            return y == ALGO_MAZE_GOAL_Y_MAX;
+        case SOUTH:
+            return y == ALGO_MAZE_GOAL_Y_MIN;
+        case EAST:
+            return x == ALGO_MAZE_GOAL_X_MAX;
+        default:
+            return x == ALGO_MAZE_GOAL_X_MIN;
+    }
+}
+
+/**
+* Open one wall between a cell reachable from the start and one that is not,
+* never on the goal outline
+*
+* \param[in,out] p_maze Maze w/ every wall known
+* \retval TRUE if a wall was opened, FALSE if every cell is reachable
+*/
+static bool bench_ConnectOnce(algo_maze_map_t* p_maze)
+{
+    static uint16_t queue[ALGO_MAZE_CELL_COUNT];
+    static uint8_t reached[ALGO_MAZE_CELL_COUNT];
+    unsigned int head = 0u;
+    unsigned int tail = 0u;
+    unsigned int idx = 0u;
+    unsigned int x = 0u;
+    unsigned int y = 0u;
+    unsigned int nx = 0u;
+    unsigned int ny = 0u;
+    unsigned int dir = 0u;
+
+    memset(reached, 0, sizeof(reached));
+    queue[tail++] = (uint16_t)ALGO_MAZE_IDX(ALGO_MAZE_START_X, ALGO_MAZE_START_Y);
+    reached[queue[0]] = 1u;
+    while (head < tail)
+    {
+        idx = queue[head++];
+        x = ALGO_MAZE_IDX_X(idx);
+        y = ALGO_MAZE_IDX_Y(idx);
+        for (dir = NORTH; dir <= WEST; dir++)
+        {
+            if (algo_MazeMapHasWall(p_maze, x, y, dir))
+                continue;
+            nx = x + ((dir == EAST) ? 1u : 0u) - ((dir == WEST) ? 1u : 0u);
+            ny = y + ((dir == NORTH) ? 1u : 0u) - ((dir == SOUTH) ? 1u : 0u);
+            if (!reached[ALGO_MAZE_IDX(nx, ny)])
+            {
+                reached[ALGO_MAZE_IDX(nx, ny)] = 1u;
+                queue[tail++] = (uint16_t)ALGO_MAZE_IDX(nx, ny);
+            }
+        }
+    }
+
+    for (idx = 0u; idx < ALGO_MAZE_CELL_COUNT; idx++)
+    {
+        if (!reached[idx])
+            continue;
+        x = ALGO_MAZE_IDX_X(idx);
+        y = ALGO_MAZE_IDX_Y(idx);
+        for (dir = NORTH; dir <= WEST; dir++)
+        {
+            if (!algo_MazeMapHasWall(p_maze, x, y, dir)
+                || bench_IsGoalOutline(x, y, dir)
+                || ((dir == NORTH) && (y + 1u == ALGO_MAZE_HEIGHT))
+                || ((dir == SOUTH) && (y == 0u))
+                || ((dir == EAST) && (x + 1u == ALGO_MAZE_WIDTH))
+                || ((dir == WEST) && (x == 0u)))
+                continue;
+            nx = x + ((dir == EAST) ? 1u : 0u) - ((dir == WEST) ? 1u : 0u);
+            ny = y + ((dir == NORTH) ? 1u : 0u) - ((dir == SOUTH) ? 1u : 0u);
+            if (!reached[ALGO_MAZE_IDX(nx, ny)] && !bench_IsGoalOutline(nx, ny, dir ^ 1u))
+            {
+                algo_MazeMapSetWall(p_maze, x, y, dir, FALSE);
+                return TRUE;
+            }
+        }
+    }
+
+    return FALSE;
+}
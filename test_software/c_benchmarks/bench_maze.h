@@ -0,0 +1,27 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : bench_maze.h
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : host benchmark
+*
+* This is the header file for the helpers shared by the host benchmarks.
+*-----------------------------------------------------------------------------*/
+
+#ifndef BENCH_MAZE_H_
+#define BENCH_MAZE_H_
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdint.h>
+#include "algo/mazemap_algo.h"
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+uint64_t bench_Now(void);
+void bench_GenerateMaze(algo_maze_map_t* p_maze, unsigned int seed);
+void bench_GenerateCompetitionMaze(algo_maze_map_t* p_maze, unsigned int seed);
+
+#endif /* BENCH_MAZE_H_ */
@@ -0,0 +1,338 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : bench_mazefile.c
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : host benchmark
+*
+* Text maze file parser and writer, see bench_mazefile.h for the format.
+*
+* The parser splits the text into lines once and then reads each wall
+* straight from its place in the art, a handful of loads per cell, so a
+* whole corpus loads in a few milliseconds.
+*-----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <dirent.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "algo/algo.h"
+#include "algo/mazemap_algo.h"
+#include "bench_mazefile.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+#define BENCH_MAZEFILE_MAX_LINES    (2u * BENCH_MAZEFILE_MAX_SIZE + 1u)
+#define BENCH_MAZEFILE_MAX_BYTES    (64u * 1024u)
+#define BENCH_MAZEFILE_PATH_SIZE    (512u)
+
+typedef struct
+{
+    const char* p_text;
+    size_t length;
+} bench_mazefile_line_t;
+
+/*----------------------------------------------------------------------------*/
+/*                    Private (Static) Function Prototype                     */
+/*----------------------------------------------------------------------------*/
+static inline bool bench_MazeFileIsWall(const bench_mazefile_line_t* p_line,
+    size_t column);
+static int bench_MazeFileCompareNames(const void* p_a, const void* p_b);
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+/**
+* Read the walls of a maze from its text
+*
+* \param[in]  p_text Maze file contents, need not end in a null
+* \param[in]  length Bytes of text
+* \param[out] p_maze Maze, the name is left alone
+* \retval TRUE if the text is a maze of up to BENCH_MAZEFILE_MAX_SIZE a side
+*/
+bool bench_MazeFileParse(const char* p_text, size_t length,
+    bench_mazefile_t* p_maze)
+{
+    bench_mazefile_line_t lines[BENCH_MAZEFILE_MAX_LINES];
+    const bench_mazefile_line_t* p_row = NULL;
+    const char* p_end = p_text + length;
+    const char* p_next = NULL;
+    unsigned int lineCount = 0u;
+    size_t pitch = 0u;
+    size_t column = 0u;
+    unsigned int x = 0u;
+    unsigned int y = 0u;
+    uint8_t walls = 0u;
+
+    /* split into lines, dropping blank ones before and after the maze */
+    while (p_text < p_end)
+    {
+        p_next = memchr(p_text, '\n', (size_t)(p_end - p_text));
+        if (p_next == NULL)
+            p_next = p_end;
+        length = (size_t)(p_next - p_text);
+        if ((length > 0u) && (p_text[length - 1u] == '\r'))
+            length--;
+
+        if ((length > 0u) || (lineCount > 0u))
+        {
+            if (lineCount == BENCH_MAZEFILE_MAX_LINES)
+            {
+                if (length > 0u)
+                    return FALSE;
+            }
+            else
+            {
+                lines[lineCount].p_text = p_text;
+                lines[lineCount].length = length;
+                lineCount++;
+            }
+        }
+        p_text = p_next + 1;
+    }
+    while ((lineCount > 0u) && (lines[lineCount - 1u].length == 0u))
+        lineCount--;
+
+    if ((lineCount < 3u) || !(lineCount & 1u) || (lines[0].p_text[0] == ' '))
+        return FALSE;
+
+    /* post spacing from the first two posts of the top line */
+    p_next = memchr(lines[0].p_text + 1, lines[0].p_text[0],
+        lines[0].length - 1u);
+    if (p_next == NULL)
+        return FALSE;
+    pitch = (size_t)(p_next - lines[0].p_text);
+    if ((pitch < 2u) || ((lines[0].length - 1u) % pitch != 0u))
+        return FALSE;
+
+    p_maze->width = (unsigned int)((lines[0].length - 1u) / pitch);
+    p_maze->height = (lineCount - 1u) / 2u;
+    if ((p_maze->width > BENCH_MAZEFILE_MAX_SIZE)
+        || (p_maze->height > BENCH_MAZEFILE_MAX_SIZE))
+        return FALSE;
+
+    /* the south row is last in the file */
+    for (y = 0u; y < p_maze->height; y++)
+    {
+        p_row = &lines[2u * (p_maze->height - 1u - y)];
+        for (x = 0u, column = 0u; x < p_maze->width; x++, column += pitch)
+        {
+            walls = 0u;
+            if (bench_MazeFileIsWall(&p_row[0], column + 1u))
+                walls |= BENCH_MAZEFILE_NORTH;
+            if (bench_MazeFileIsWall(&p_row[1], column + pitch))
+                walls |= BENCH_MAZEFILE_EAST;
+            if (bench_MazeFileIsWall(&p_row[2], column + 1u))
+                walls |= BENCH_MAZEFILE_SOUTH;
+            if (bench_MazeFileIsWall(&p_row[1], column))
+                walls |= BENCH_MAZEFILE_WEST;
+            p_maze->walls[y][x] = walls;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+* Read a maze file
+*
+* \param[in]  p_path Path of the file
+* \param[out] p_maze Maze, named after the file
+* \retval TRUE if the file is a maze
+*/
+bool bench_MazeFileLoad(const char* p_path, bench_mazefile_t* p_maze)
+{
+    static char text[BENCH_MAZEFILE_MAX_BYTES];
+    const char* p_name = strrchr(p_path, '/');
+    FILE* p_file = fopen(p_path, "rb");
+    size_t length = 0u;
+
+    if (p_file == NULL)
+        return FALSE;
+    length = fread(text, 1u, sizeof(text), p_file);
+    fclose(p_file);
+    if (length == sizeof(text))
+        return FALSE;
+
+    snprintf(p_maze->name, sizeof(p_maze->name), "%s",
+        (p_name != NULL) ? p_name + 1 : p_path);
+    return bench_MazeFileParse(text, length, p_maze);
+}
+
+/**
+* Read every .txt maze file in a directory, sorted by name
+*
+* \param[in]  p_dir    Directory
+* \param[out] p_mazes  Mazes
+* \param[in]  maxMazes Room in p_mazes
+* \retval Mazes read, files that are not mazes are skipped
+*/
+unsigned int bench_MazeFileLoadDir(const char* p_dir, bench_mazefile_t* p_mazes,
+    unsigned int maxMazes)
+{
+    char path[BENCH_MAZEFILE_PATH_SIZE];
+    struct dirent* p_entry = NULL;
+    DIR* p_handle = opendir(p_dir);
+    unsigned int count = 0u;
+    size_t length = 0u;
+
+    if (p_handle == NULL)
+        return 0u;
+
+    while ((count < maxMazes) && ((p_entry = readdir(p_handle)) != NULL))
+    {
+        length = strlen(p_entry->d_name);
+        if ((length < 5u) || (strcmp(&p_entry->d_name[length - 4u], ".txt") != 0))
+            continue;
+        snprintf(path, sizeof(path), "%s/%s", p_dir, p_entry->d_name);
+        if (bench_MazeFileLoad(path, &p_mazes[count]))
+            count++;
+    }
+    closedir(p_handle);
+
+    qsort(p_mazes, count, sizeof(*p_mazes), bench_MazeFileCompareNames);
+    return count;
+}
+
+/**
+* Copy a maze into a maze map w/ every wall known
+*
+* \param[in]  p_maze Maze
+* \param[out] p_map  Maze map
+* \retval TRUE if the maze has the size of this maze configuration
+*/
+bool bench_MazeFileToMap(const bench_mazefile_t* p_maze, algo_maze_map_t* p_map)
+{
+    unsigned int x = 0u;
+    unsigned int y = 0u;
+
+    if ((p_maze->width != ALGO_MAZE_WIDTH) || (p_maze->height != ALGO_MAZE_HEIGHT))
+        return FALSE;
+
+    algo_MazeMapClear(p_map);
+    for (y = 0u; y < ALGO_MAZE_HEIGHT; y++)
+        for (x = 0u; x < ALGO_MAZE_WIDTH; x++)
+        {
+            algo_MazeMapSetWall(p_map, x, y, NORTH,
+                (p_maze->walls[y][x] & BENCH_MAZEFILE_NORTH) != 0u);
+            algo_MazeMapSetWall(p_map, x, y, EAST,
+                (p_maze->walls[y][x] & BENCH_MAZEFILE_EAST) != 0u);
+        }
+
+    return TRUE;
+}
+
+/**
+* Copy the walls of a maze map, unknown walls read as open
+*
+* \param[in]  p_map  Maze map
+* \param[out] p_maze Maze, the name is left alone
+* \retval None
+*/
+void bench_MazeFileFromMap(const algo_maze_map_t* p_map,
+    bench_mazefile_t* p_maze)
+{
+    unsigned int x = 0u;
+    unsigned int y = 0u;
+    uint8_t walls = 0u;
+
+    p_maze->width = ALGO_MAZE_WIDTH;
+    p_maze->height = ALGO_MAZE_HEIGHT;
+    for (y = 0u; y < ALGO_MAZE_HEIGHT; y++)
+        for (x = 0u; x < ALGO_MAZE_WIDTH; x++)
+        {
+            walls = 0u;
+            if (algo_MazeMapHasWall(p_map, x, y, NORTH))
+                walls |= BENCH_MAZEFILE_NORTH;
+            if (algo_MazeMapHasWall(p_map, x, y, EAST))
+                walls |= BENCH_MAZEFILE_EAST;
+            if (algo_MazeMapHasWall(p_map, x, y, SOUTH))
+                walls |= BENCH_MAZEFILE_SOUTH;
+            if (algo_MazeMapHasWall(p_map, x, y, WEST))
+                walls |= BENCH_MAZEFILE_WEST;
+            p_maze->walls[y][x] = walls;
+        }
+}
+
+/**
+* Write a maze in the four character layout
+*
+* \param[in] p_file File to write to
+* \param[in] p_maze Maze
+* \retval None
+*/
+void bench_MazeFileWrite(FILE* p_file, const bench_mazefile_t* p_maze)
+{
+    unsigned int x = 0u;
+    unsigned int y = p_maze->height;
+
+    while (y-- > 0u)
+    {
+        for (x = 0u; x < p_maze->width; x++)
+            fputs((p_maze->walls[y][x] & BENCH_MAZEFILE_NORTH) ? "o---" : "o   ",
+                p_file);
+        fputs("o\n", p_file);
+        for (x = 0u; x < p_maze->width; x++)
+            fputs((p_maze->walls[y][x] & BENCH_MAZEFILE_WEST) ? "|   " : "    ",
+                p_file);
+        fputs((p_maze->walls[y][p_maze->width - 1u] & BENCH_MAZEFILE_EAST)
+            ? "|\n" : "\n", p_file);
+    }
+    for (x = 0u; x < p_maze->width; x++)
+        fputs((p_maze->walls[0][x] & BENCH_MAZEFILE_SOUTH) ? "o---" : "o   ",
+            p_file);
+    fputs("o\n", p_file);
+}
+
+/**
+* Text that is the same for two mazes exactly when their walls are, the
+* Python loader makes the same one
+*
+* \param[in]  p_maze   Maze
+* \param[out] p_digest BENCH_MAZEFILE_DIGEST_SIZE bytes: "WxH " then a hex
+*                      digit of wall bits per cell, south row first
+* \retval None
+*/
+void bench_MazeFileDigest(const bench_mazefile_t* p_maze, char* p_digest)
+{
+    static const char hex[] = "0123456789abcdef";
+    unsigned int x = 0u;
+    unsigned int y = 0u;
+
+    p_digest += sprintf(p_digest, "%ux%u ", p_maze->width, p_maze->height);
+    for (y = 0u; y < p_maze->height; y++)
+        for (x = 0u; x < p_maze->width; x++)
+            *p_digest++ = hex[p_maze->walls[y][x] & 0xFu];
+    *p_digest = '\0';
+}
+
+/*----------------------------------------------------------------------------*/
+/*                         Private (Static) Functions                         */
+/*----------------------------------------------------------------------------*/
+/**
+* Whether there is a wall character at a column of a line, lines may stop
+* short of the end when trailing spaces are trimmed
+*
+* \param[in] p_line Line
+* \param[in] column Character of the line
+* \retval TRUE if there is a wall
+*/
+static inline bool bench_MazeFileIsWall(const bench_mazefile_line_t* p_line,
+    size_t column)
+{
+    return (column < p_line->length) && (p_line->p_text[column] != ' ');
+}
+
+/**
+* qsort() order of mazes by name
+*/
+static int bench_MazeFileCompareNames(const void* p_a, const void* p_b)
+{
+    return strcmp(((const bench_mazefile_t*)p_a)->name,
+        ((const bench_mazefile_t*)p_b)->name);
+}
@@ -0,0 +1,78 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : bench_mazefile.h
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : host benchmark
+*
+* This is the header file for the text maze file format.
+*
+* Maze files are the ASCII art most micromouse maze collections use, north
+* at the top, a post at every corner and a wall character between posts:
+*
+*   o---o---o---o
+*   |       |   |
+*   o   o---o   o
+*   |   |       |
+*   o---o---o---o
+*
+* Any character other than a space in a wall's place is a wall, so posts
+* can be 'o', '+' or '.', and the 'S' and 'G' some files mark cells w/ are
+* skipped. The post spacing is taken from the first line, so both the
+* common four character and narrower three character layouts load.
+* test_software/python_tests/mazefile.py reads the same files.
+*-----------------------------------------------------------------------------*/
+
+#ifndef BENCH_MAZEFILE_H_
+#define BENCH_MAZEFILE_H_
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "algo/mazemap_algo.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+#define BENCH_MAZEFILE_MAX_SIZE     (32u)       /* cells a side */
+#define BENCH_MAZEFILE_NAME_SIZE    (64u)
+/* width x height, then a hex digit per cell */
+#define BENCH_MAZEFILE_DIGEST_SIZE \
+    (16u + BENCH_MAZEFILE_MAX_SIZE * BENCH_MAZEFILE_MAX_SIZE)
+
+/* maze corpus, relative to test_software/c_benchmarks */
+#define BENCH_MAZEFILE_DIR          "../mazes"
+
+/* wall bits of a cell */
+#define BENCH_MAZEFILE_NORTH        (0x1u)
+#define BENCH_MAZEFILE_EAST         (0x2u)
+#define BENCH_MAZEFILE_SOUTH        (0x4u)
+#define BENCH_MAZEFILE_WEST         (0x8u)
+
+typedef struct
+{
+    char name[BENCH_MAZEFILE_NAME_SIZE];    /* file name w/o the directory */
+    unsigned int width;
+    unsigned int height;
+    /* BENCH_MAZEFILE_* bits, row 0 is the south row like the maze map */
+    uint8_t walls[BENCH_MAZEFILE_MAX_SIZE][BENCH_MAZEFILE_MAX_SIZE];
+} bench_mazefile_t;
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+bool bench_MazeFileParse(const char* p_text, size_t length,
+    bench_mazefile_t* p_maze);
+bool bench_MazeFileLoad(const char* p_path, bench_mazefile_t* p_maze);
+unsigned int bench_MazeFileLoadDir(const char* p_dir, bench_mazefile_t* p_mazes,
+    unsigned int maxMazes);
+bool bench_MazeFileToMap(const bench_mazefile_t* p_maze, algo_maze_map_t* p_map);
+void bench_MazeFileFromMap(const algo_maze_map_t* p_map,
+    bench_mazefile_t* p_maze);
+void bench_MazeFileWrite(FILE* p_file, const bench_mazefile_t* p_maze);
+void bench_MazeFileDigest(const bench_mazefile_t* p_maze, char* p_digest);
+
+#endif /* BENCH_MAZEFILE_H_ */
@@ -0,0 +1,760 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : bench_mouse.c
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : host benchmark
+*
+* Virtual mouse w/ the mci and mhi functions algo/algo.c calls on top of it.
+*
+* Headings go round in eighths, north first and clockwise, so a 45 degree
+* turn is one step. Every half square or half step driven is checked: a
+* cell centre is always fine, a wall gap has to be open, and a post is
+* never. Walls can only be checked from a cell centre facing along the maze,
+* except halfway through a 1 square move, where its midpoint task sees the
+* side walls of the square ahead latched, as the side sensors do. A search
+* turn the task sets goes through the centre of the square ahead, the half
+* square off to the side and on to the centre of the next, w/o stopping.
+* Queued moves wait in a queue as long as the control loop's, and each
+* mci_RunMotionQueue() call drives the oldest one.
+*
+* Noise flips readings w/ a xorshift generator, so a seed always gives the
+* same readings for the same calls.
+*-----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <setjmp.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+#include "micromouse_dimensions.h"
+#include "algo/algo.h"
+#include "algo/mazemap_algo.h"
+#include "algo/primitive_algo.h"
+#include "algo/speedrun_algo.h"
+#include "mouse_control_interface/walldetection_mci.h"
+#include "mouse_control_interface/movement_mci.h"
+#include "mouse_control_interface/configswitch_mci.h"
+#include "mouse_control_interface/time_mci.h"
+#include "mouse_hardware_interface/clock_mhi.h"
+#include "mouse_hardware_interface/timer_mhi.h"
+#include "mouse_hardware_interface/leds_mhi.h"
+#include "bench_mouse.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+#define BENCH_MOUSE_HEADINGS    (8u)
+/* moves the control loop holds queued */
+#define BENCH_MOUSE_QUEUE_LENGTH    (8u)
+
+/* move queued w/ mci_Queue*() */
+typedef struct
+{
+    bool diagonal;              /* drive: half steps, not half squares */
+    int eighths;                /* turn in place if not 0 */
+    unsigned int units;         /* drive: half squares or half steps */
+} bench_mouse_move_t;
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+/* half square steps per eighth heading, north first and clockwise */
+static const int benchMouseDu[BENCH_MOUSE_HEADINGS] = { 0, 1, 1, 1, 0, -1, -1, -1 };
+static const int benchMouseDv[BENCH_MOUSE_HEADINGS] = { 1, 1, 0, -1, -1, -1, 0, 1 };
+
+/* algo.h heading of each eighth that runs along the maze */
+static const unsigned int benchMouseAlgoDir[BENCH_MOUSE_HEADINGS] =
+{
+    NORTH, 0u, EAST, 0u, SOUTH, 0u, WEST, 0u
+};
+
+static const algo_maze_map_t* p_benchMaze = NULL;
+static algo_speedrun_model_t benchMouseModel;
+static bench_mouse_stats_t benchMouseStats;
+static algo_maze_row_t benchMouseSensed[ALGO_MAZE_HEIGHT];
+static int benchMouseU = 0;             /* half square column */
+static int benchMouseV = 0;             /* half square row */
+static unsigned int benchMouseHeading = 0u;
+static mci_move_task_t benchMouseMidpointTask = NULL;
+static mci_search_turn_t benchMouseSearchTurn = MCI_SEARCH_TURN_NONE;
+static bool benchMouseLatched = FALSE;  /* side walls of the square ahead */
+static bool benchMouseLatchedLeft = FALSE;
+static bool benchMouseLatchedRight = FALSE;
+static bench_mouse_noise_t benchMouseNoise;  /* all 0, readings are right */
+static uint32_t benchMouseRandom = 1u;
+static jmp_buf* p_benchMouseTrap = NULL;
+static mci_speed_profile_t benchMouseProfile =
+{
+    .forwardSpeed = MCI_FORWARD_FAST_SPEED,
+    .turnSpeed = MCI_TURN_SPEED,
+};
+static unsigned long long benchMouseTimerUs = 0u;   /* mci_StartTimer() */
+static bool benchMouseButton = FALSE;
+static bench_mouse_move_t benchMouseQueue[BENCH_MOUSE_QUEUE_LENGTH];
+static unsigned int benchMouseQueueHead = 0u;
+static unsigned int benchMouseQueueCount = 0u;
+static uint32_t benchMouseMovesDone = 0u;
+
+/*----------------------------------------------------------------------------*/
+/*                    Private (Static) Function Prototype                     */
+/*----------------------------------------------------------------------------*/
+static void bench_MouseDrive(unsigned int units);
+static void bench_MouseCount(unsigned int units);
+static void bench_MouseStep(unsigned int units);
+static void bench_MouseLatchSides(void);
+static void bench_MouseTurn(int eighths);
+static void bench_MouseArc(int eighths);
+static bool bench_MousePush(bool diagonal, int eighths, unsigned int units);
+static bool bench_MouseReadAtRest(int eighths);
+static bool bench_MouseSenseWall(int eighths, unsigned int flipPerMille);
+static bool bench_MouseFlip(unsigned int perMille);
+static void bench_MouseCrash(const char* p_what);
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+/**
+* Put the mouse in the start cell of a maze and clear the counts
+*
+* \param[in] p_maze Maze w/ every wall known, kept until the next reset
+* \retval None
+*/
+void bench_MouseReset(const algo_maze_map_t* p_maze)
+{
+    p_benchMaze = p_maze;
+    algo_SpeedRunGetDefaultModel(&benchMouseModel);
+    memset(&benchMouseStats, 0, sizeof(benchMouseStats));
+    memset(benchMouseSensed, 0, sizeof(benchMouseSensed));
+    benchMouseMidpointTask = NULL;
+    benchMouseSearchTurn = MCI_SEARCH_TURN_NONE;
+    benchMouseProfile.forwardSpeed = MCI_FORWARD_FAST_SPEED;
+    benchMouseProfile.turnSpeed = MCI_TURN_SPEED;
+    benchMouseButton = FALSE;
+    benchMouseQueueCount = 0u;
+    bench_MouseCarryToStart();
+}
+
+/**
+* Pick the mouse up and put it back in the start cell, counts are kept
+*
+* \param None
+* \retval None
+*/
+void bench_MouseCarryToStart(void)
+{
+    unsigned int heading = 0u;
+
+    benchMouseU = (int)(2u * ALGO_MAZE_START_X + 1u);
+    benchMouseV = (int)(2u * ALGO_MAZE_START_Y + 1u);
+    for (heading = 0u; heading < BENCH_MOUSE_HEADINGS; heading += 2u)
+    {
+        if (benchMouseAlgoDir[heading] == ALGO_MAZE_START_HEADING)
+            benchMouseHeading = heading;
+    }
+}
+
+/**
+* Counts since the last reset
+*
+* \param None
+* \retval Counts
+*/
+const bench_mouse_stats_t* bench_MouseGetStats(void)
+{
+    unsigned int y = 0u;
+    algo_maze_row_t row = 0u;
+
+    benchMouseStats.cellsSensed = 0u;
+    for (y = 0u; y < ALGO_MAZE_HEIGHT; y++)
+        for (row = benchMouseSensed[y]; row != 0u; row &= (algo_maze_row_t)(row - 1u))
+            benchMouseStats.cellsSensed++;
+
+    return &benchMouseStats;
+}
+
+/**
+* Cell the mouse is in and the way it faces
+*
+* \param[out] p_x       Cell column
+* \param[out] p_y       Cell row
+* \param[out] p_heading NORTH, SOUTH, EAST or WEST
+* \retval TRUE if the mouse is in a cell centre facing along the maze
+*/
+bool bench_MouseGetCell(unsigned int* p_x, unsigned int* p_y,
+    unsigned int* p_heading)
+{
+    if (!(benchMouseU & 1) || !(benchMouseV & 1) || (benchMouseHeading & 1u))
+        return FALSE;
+
+    *p_x = (unsigned int)benchMouseU / 2u;
+    *p_y = (unsigned int)benchMouseV / 2u;
+    *p_heading = benchMouseAlgoDir[benchMouseHeading];
+    return TRUE;
+}
+
+/**
+* Flip wall readings at random from now on, counts and the mouse are kept
+*
+* \param[in] p_noise Flip rates, all 0 for readings that are always right
+* \retval None
+*/
+void bench_MouseSetNoise(const bench_mouse_noise_t* p_noise)
+{
+    benchMouseNoise = *p_noise;
+    benchMouseRandom = (p_noise->seed != 0u) ? p_noise->seed : 1u;
+}
+
+/**
+* Time the drives and turns w/ another motion model than the default speed
+* run one, until the next reset; its learned cost table is not used
+*
+* \param[in] p_model Motion model of the mouse
+* \retval None
+*/
+void bench_MouseSetModel(const algo_speedrun_model_t* p_model)
+{
+    benchMouseModel = *p_model;
+    benchMouseModel.p_costs = NULL;
+}
+
+/**
+* Jump back instead of stopping the benchmark when the mouse crashes
+*
+* \param[in] p_trap Trap to longjmp() to w/ 1, NULL to stop again
+* \retval None
+*/
+void bench_MouseSetCrashTrap(jmp_buf* p_trap)
+{
+    p_benchMouseTrap = p_trap;
+}
+
+/**
+* Press the config button once, the next mci_CheckConfigButtonPressed()
+* sees it
+*
+* \param None
+* \retval None
+*/
+void bench_MousePressButton(void)
+{
+    benchMouseButton = TRUE;
+}
+
+/*----------------------------------------------------------------------------*/
+/*                 Mouse Control Interface Called By algo.c                   */
+/*----------------------------------------------------------------------------*/
+void mci_MoveForward1MazeSquarePid(void)
+{
+    mci_move_task_t task = benchMouseMidpointTask;
+
+    benchMouseMidpointTask = NULL;
+    bench_MouseCount(2u);
+    bench_MouseStep(1u);
+    if (task != NULL)
+    {
+        bench_MouseLatchSides();
+        task();
+        benchMouseLatched = FALSE;
+    }
+    if (benchMouseSearchTurn != MCI_SEARCH_TURN_NONE)
+    {
+        bench_MouseArc((benchMouseSearchTurn == MCI_SEARCH_TURN_RIGHT)
+            ? 2 : -2);
+        benchMouseSearchTurn = MCI_SEARCH_TURN_NONE;
+    }
+    bench_MouseStep(1u);
+}
+
+void mci_SetMoveMidpointTask(mci_move_task_t task)
+{
+    benchMouseMidpointTask = task;
+}
+
+void mci_SetMoveSearchTurn(mci_search_turn_t turn)
+{
+    benchMouseSearchTurn = turn;
+}
+
+void mci_SetSpeedProfile(const mci_speed_profile_t* p_profile)
+{
+    benchMouseProfile = *p_profile;
+    if (benchMouseProfile.forwardSpeed < MCI_MINIMUM_SPEED)
+        benchMouseProfile.forwardSpeed = MCI_MINIMUM_SPEED;
+}
+
+const mci_speed_profile_t* mci_GetSpeedProfile(void)
+{
+    return &benchMouseProfile;
+}
+
+void mci_MoveForwardNHalfSquares(int n)
+{
+    bench_MouseDrive((unsigned int)n);
+}
+
+void mci_MoveDiagonalNHalfSteps(int n)
+{
+    if (!(benchMouseHeading & 1u))
+        bench_MouseCrash("diagonal drive facing along the maze");
+    bench_MouseDrive((unsigned int)n);
+}
+
+void mci_TurnLeft45Degrees(void)
+{
+    bench_MouseTurn(-1);
+}
+
+void mci_TurnRight45Degrees(void)
+{
+    bench_MouseTurn(1);
+}
+
+void mci_TurnLeft90DegreesPID(void)
+{
+    bench_MouseTurn(-2);
+}
+
+void mci_TurnRight90DegreesPID(void)
+{
+    bench_MouseTurn(2);
+}
+
+bool mci_QueueForwardNHalfSquares(int n)
+{
+    return bench_MousePush(FALSE, 0, (unsigned int)n);
+}
+
+bool mci_QueueDiagonalNHalfSteps(int n)
+{
+    return bench_MousePush(TRUE, 0, (unsigned int)n);
+}
+
+bool mci_QueueTurnDegrees(int degrees)
+{
+    return bench_MousePush(FALSE, degrees / 45, 0u);
+}
+
+/* drives the oldest queued move all in one go */
+bool mci_RunMotionQueue(void)
+{
+    bench_mouse_move_t move;
+
+    if (benchMouseQueueCount == 0u)
+        return FALSE;
+
+    move = benchMouseQueue[benchMouseQueueHead];
+    benchMouseQueueHead = (benchMouseQueueHead + 1u) % BENCH_MOUSE_QUEUE_LENGTH;
+    benchMouseQueueCount--;
+    if (move.eighths == 4)
+    {
+        /* timed as the two 90 degree turns it used to be */
+        bench_MouseTurn(2);
+        bench_MouseTurn(2);
+    }
+    else if (move.eighths != 0)
+        bench_MouseTurn(move.eighths);
+    else
+    {
+        if (move.diagonal != ((benchMouseHeading & 1u) != 0u))
+            bench_MouseCrash("queued drive along the wrong heading");
+        bench_MouseDrive(move.units);
+    }
+    benchMouseMovesDone++;
+
+    return benchMouseQueueCount != 0u;
+}
+
+uint32_t mci_GetMovesDone(void)
+{
+    return benchMouseMovesDone;
+}
+
+uint32_t mci_GetMotionQueueStops(void)
+{
+    return 0u;
+}
+
+void mci_AdjustToFrontWall(void)
+{
+}
+
+void mci_PlaceAtStart(void)
+{
+}
+
+/* the side walls stay latched for the rest of the midpoint task */
+void mci_SetLeftWallUpdateAvailable(void)
+{
+}
+
+void mci_SetRightWallUpdateAvailable(void)
+{
+}
+
+mci_button_pressed_t mci_CheckConfigButtonPressed(void)
+{
+    bool pressed = benchMouseButton;
+
+    benchMouseButton = FALSE;
+    return pressed ? MCI_BUTTON_PRESSED : MCI_BUTTON_NOT_PRESSED;
+}
+
+/* the competition clock runs on the estimated drive time */
+void mci_StartTimer(void)
+{
+    benchMouseTimerUs = benchMouseStats.timeUs;
+}
+
+void mci_ResetTimer(void)
+{
+    benchMouseTimerUs = benchMouseStats.timeUs;
+}
+
+uint32_t mci_GetTimeMs(void)
+{
+    return (uint32_t)((benchMouseStats.timeUs - benchMouseTimerUs) / 1000u);
+}
+
+void mci_DelayMs(const uint32_t delayTime)
+{
+    mhi_DelayMs(delayTime);
+}
+
+mci_wall_presence_t mci_CheckFrontWall(void)
+{
+    return bench_MouseReadAtRest(0) ? MCI_WALL_FOUND : MCI_WALL_NOT_FOUND;
+}
+
+mci_wall_presence_t mci_CheckLeftWall(void)
+{
+    if (benchMouseLatched)
+        return benchMouseLatchedLeft ? MCI_WALL_FOUND : MCI_WALL_NOT_FOUND;
+    return bench_MouseReadAtRest(-2) ? MCI_WALL_FOUND : MCI_WALL_NOT_FOUND;
+}
+
+mci_wall_presence_t mci_CheckRightWall(void)
+{
+    if (benchMouseLatched)
+        return benchMouseLatchedRight ? MCI_WALL_FOUND : MCI_WALL_NOT_FOUND;
+    return bench_MouseReadAtRest(2) ? MCI_WALL_FOUND : MCI_WALL_NOT_FOUND;
+}
+
+/*----------------------------------------------------------------------------*/
+/*                Mouse Hardware Interface Called By algo.c                   */
+/*----------------------------------------------------------------------------*/
+/* nothing waits on the host, waits only count, see bench_usart.c for the
+   prints */
+void mhi_DelayMs(const uint32_t delayTime)
+{
+    benchMouseStats.timeUs += 1000u * (unsigned long long)delayTime;
+}
+
+void mhi_SetD1Led(void)
+{
+}
+
+void mhi_SetD2Led(void)
+{
+}
+
+void mhi_SetD3Led(void)
+{
+}
+
+void mhi_SetErrLed(void)
+{
+}
+
+void mhi_ClearD1Led(void)
+{
+}
+
+void mhi_ClearD2Led(void)
+{
+}
+
+void mhi_ClearD3Led(void)
+{
+}
+
+void mhi_ClearErrLed(void)
+{
+}
+
+uint32_t mhi_GetTimerCount(void)
+{
+    return 0u;
+}
+
+uint32_t mhi_TimerCountToMs(uint32_t count)
+{
+    return count;
+}
+
+/* the cycle counter counts host nanoseconds plus the time the mouse took,
+   as the mouse's own counter runs on while it drives, it wraps the same
+   way */
+uint32_t mhi_GetCycleCount(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)(((uint64_t)now.tv_sec * 1000000000u)
+        + (uint64_t)now.tv_nsec + (benchMouseStats.timeUs * 1000u));
+}
+
+uint32_t mhi_CycleCountToUs(uint32_t count)
+{
+    return count / 1000u;
+}
+
+/*----------------------------------------------------------------------------*/
+/*                         Private (Static) Functions                         */
+/*----------------------------------------------------------------------------*/
+/**
+* Drive along the heading, checking every half square or half step
+*
+* \param[in] units Half squares, or half steps on a diagonal
+* \retval None
+*/
+static void bench_MouseDrive(unsigned int units)
+{
+    bench_MouseCount(units);
+    bench_MouseStep(units);
+}
+
+/**
+* Count one movement call driving along the heading
+*
+* \param[in] units Half squares, or half steps on a diagonal
+* \retval None
+*/
+static void bench_MouseCount(unsigned int units)
+{
+    algo_prim_t prim;
+
+    prim.type = (benchMouseHeading & 1u) ? ALGO_PRIM_DIAGONAL : ALGO_PRIM_STRAIGHT;
+    prim.count = (uint8_t)units;
+    benchMouseStats.moves++;
+    /* a faster profile drives faster in proportion */
+    benchMouseStats.timeUs += (unsigned long long)algo_SpeedRunPrimUs(
+        &benchMouseModel, &prim) * MCI_FORWARD_FAST_SPEED
+        / benchMouseProfile.forwardSpeed;
+    if (benchMouseHeading & 1u)
+        benchMouseStats.halfSteps += units;
+    else
+        benchMouseStats.halfSquares += units;
+
+    if ((benchMouseNoise.slipSpeed != 0u)
+        && (benchMouseProfile.forwardSpeed >= benchMouseNoise.slipSpeed)
+        && bench_MouseFlip(benchMouseNoise.slipPerMille))
+        bench_MouseCrash("slipped");
+}
+
+/**
+* Move along the heading, checking every half square or half step
+*
+* \param[in] units Half squares, or half steps on a diagonal
+* \retval None
+*/
+static void bench_MouseStep(unsigned int units)
+{
+    bool uEven = FALSE;
+    bool vEven = FALSE;
+    unsigned int x = 0u;
+    unsigned int y = 0u;
+
+    while (units--)
+    {
+        benchMouseU += benchMouseDu[benchMouseHeading];
+        benchMouseV += benchMouseDv[benchMouseHeading];
+        if ((benchMouseU <= 0) || (benchMouseV <= 0)
+            || (benchMouseU >= (int)(2u * ALGO_MAZE_WIDTH))
+            || (benchMouseV >= (int)(2u * ALGO_MAZE_HEIGHT)))
+            bench_MouseCrash("drove into the outer wall");
+
+        uEven = !(benchMouseU & 1);
+        vEven = !(benchMouseV & 1);
+        if (uEven && vEven)
+            bench_MouseCrash("drove into a post");
+
+        /* a gap is the north wall of the cell below or east wall of the
+           cell to the west */
+        x = (unsigned int)(benchMouseU - (uEven ? 1 : 0)) / 2u;
+        y = (unsigned int)(benchMouseV - (vEven ? 1 : 0)) / 2u;
+        if ((vEven && algo_MazeMapHasWall(p_benchMaze, x, y, NORTH))
+            || (uEven && algo_MazeMapHasWall(p_benchMaze, x, y, EAST)))
+            bench_MouseCrash("drove into a wall");
+    }
+}
+
+/**
+* Turn in place
+*
+* \param[in] eighths Eighths of a turn, negative to the left
+* \retval None
+*/
+static void bench_MouseTurn(int eighths)
+{
+    benchMouseStats.turns++;
+    benchMouseStats.timeUs += (unsigned long long)(((eighths == 1)
+        || (eighths == -1)) ? benchMouseModel.turn45Us
+        : benchMouseModel.turn90Us) * MCI_TURN_SPEED
+        / benchMouseProfile.turnSpeed;
+    benchMouseHeading = (benchMouseHeading
+        + (unsigned int)(eighths + (int)BENCH_MOUSE_HEADINGS))
+        % BENCH_MOUSE_HEADINGS;
+}
+
+/**
+* Arc from the gap the mouse is in to the gap at the side of the square
+* ahead, through its centre, at the speed a half square from rest gets to
+*
+* \param[in] eighths Eighths of a turn, negative to the left
+* \retval None
+*/
+static void bench_MouseArc(int eighths)
+{
+    double speed = sqrt((double)benchMouseModel.accelMmPerS2
+        * (double)benchMouseModel.cellMm);
+
+    if (speed > (double)benchMouseModel.maxSpeedMmPerS)
+        speed = (double)benchMouseModel.maxSpeedMmPerS;
+    benchMouseStats.searchTurns++;
+    benchMouseStats.timeUs += (unsigned long long)(1000000.0
+        * MCI_SEARCH_TURN_ARC_MM / speed) * MCI_FORWARD_FAST_SPEED
+        / benchMouseProfile.forwardSpeed;
+
+    bench_MouseStep(1u);
+    benchMouseHeading = (benchMouseHeading
+        + (unsigned int)(eighths + (int)BENCH_MOUSE_HEADINGS))
+        % BENCH_MOUSE_HEADINGS;
+    bench_MouseStep(1u);
+}
+
+/**
+* Queue a move for mci_RunMotionQueue() to drive
+*
+* \param[in] diagonal Drive in half steps
+* \param[in] eighths  Turn in place, negative to the left, 0 to drive
+* \param[in] units    Half squares or half steps to drive
+* \retval FALSE if the queue is full
+*/
+static bool bench_MousePush(bool diagonal, int eighths, unsigned int units)
+{
+    bench_mouse_move_t* p_move = NULL;
+
+    if (benchMouseQueueCount == BENCH_MOUSE_QUEUE_LENGTH)
+        return FALSE;
+
+    p_move = &benchMouseQueue[(benchMouseQueueHead + benchMouseQueueCount)
+        % BENCH_MOUSE_QUEUE_LENGTH];
+    p_move->diagonal = diagonal;
+    p_move->eighths = eighths;
+    p_move->units = units;
+    benchMouseQueueCount++;
+
+    return TRUE;
+}
+
+/**
+* Read one wall of the cell the mouse stands in, taking the time of a
+* reading
+*
+* \param[in] eighths Side of the mouse, 0 front, -2 left, 2 right
+* \retval TRUE if there is a wall
+*/
+static bool bench_MouseReadAtRest(int eighths)
+{
+    benchMouseStats.timeUs += benchMouseNoise.restReadUs;
+
+    return bench_MouseSenseWall(eighths, benchMouseNoise.restPerMille);
+}
+
+/**
+* Read one wall of the cell the mouse is in
+*
+* \param[in] eighths      Side of the mouse, 0 front, -2 left, 2 right
+* \param[in] flipPerMille Chance the reading is wrong
+* \retval TRUE if there is a wall
+*/
+static bool bench_MouseSenseWall(int eighths, unsigned int flipPerMille)
+{
+    unsigned int x = 0u;
+    unsigned int y = 0u;
+    unsigned int heading = 0u;
+
+    if (!bench_MouseGetCell(&x, &y, &heading))
+        bench_MouseCrash("checked walls between cells");
+
+    benchMouseStats.wallReads++;
+    benchMouseSensed[y] |= ALGO_MAZE_ROW_BIT(x);
+    heading = (benchMouseHeading
+        + (unsigned int)(eighths + (int)BENCH_MOUSE_HEADINGS))
+        % BENCH_MOUSE_HEADINGS;
+
+    return algo_MazeMapHasWall(p_benchMaze, x, y, benchMouseAlgoDir[heading])
+        != bench_MouseFlip(flipPerMille);
+}
+
+/**
+* Draw whether a reading is flipped
+*
+* \param[in] perMille Chance of a flip
+* \retval TRUE to flip the reading
+*/
+static bool bench_MouseFlip(unsigned int perMille)
+{
+    if (perMille == 0u)
+        return FALSE;
+
+    benchMouseRandom ^= benchMouseRandom << 13;
+    benchMouseRandom ^= benchMouseRandom >> 17;
+    benchMouseRandom ^= benchMouseRandom << 5;
+
+    return (benchMouseRandom % 1000u) < perMille;
+}
+
+/**
+* Latch the side walls of the square ahead, from its centre, the mouse is
+* in the wall gap before it
+*
+* \param None
+* \retval None
+*/
+static void bench_MouseLatchSides(void)
+{
+    benchMouseU += benchMouseDu[benchMouseHeading];
+    benchMouseV += benchMouseDv[benchMouseHeading];
+    benchMouseLatchedLeft = bench_MouseSenseWall(-2,
+        benchMouseNoise.approachPerMille);
+    benchMouseLatchedRight = bench_MouseSenseWall(2,
+        benchMouseNoise.approachPerMille);
+    benchMouseU -= benchMouseDu[benchMouseHeading];
+    benchMouseV -= benchMouseDv[benchMouseHeading];
+    benchMouseLatched = TRUE;
+}
+
+/**
+* Stop the benchmark, the solver drove the mouse somewhere it cannot go
+*
+* \param[in] p_what What went wrong
+* \retval None
+*/
+static void bench_MouseCrash(const char* p_what)
+{
+    if (p_benchMouseTrap != NULL)
+        longjmp(*p_benchMouseTrap, 1);
+
+    printf("%ux%u mouse: %s at half square (%d, %d) heading %u/8\n",
+        ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, p_what, benchMouseU, benchMouseV,
+        benchMouseHeading);
+    exit(1);
+}
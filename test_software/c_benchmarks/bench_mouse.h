@@ -0,0 +1,81 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : bench_mouse.h
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : host benchmark
+*
+* This is the header file for the virtual mouse.
+*
+* Stands in for the mouse control interface under algo/algo.c on the host:
+* the movement calls drive a virtual mouse through a maze map and the wall
+* checks read the walls around it. Positions are kept in half squares, cell
+* centres at odd coordinates and wall gaps w/ one even coordinate, so the
+* half square straights and gap to gap diagonals of the speed run are
+* followed as well. Driving into a wall or a post stops the benchmark, or
+* jumps back to the crash trap if one is set.
+*
+* Drive and turn times come from the default speed run model, or one set w/
+* bench_MouseSetModel() for a mouse that drives otherwise than the planner
+* expects. The mouse drives faster w/ a faster speed profile, its drive time
+* scaled by the PWM over the default one, and may slip and lose its way
+* above a set PWM, which counts as a crash.
+*
+* Wall readings are right unless noise is set: each one is then flipped at
+* random, at one rate for the side walls latched driving into a square and
+* at another for readings w/ the mouse standing in a cell.
+*-----------------------------------------------------------------------------*/
+
+#ifndef BENCH_MOUSE_H_
+#define BENCH_MOUSE_H_
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <setjmp.h>
+#include <stdint.h>
+#include "algo/mazemap_algo.h"
+#include "algo/speedrun_algo.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+typedef struct
+{
+    unsigned long long moves;       /* movement calls that drive */
+    unsigned long long turns;       /* turns in place, 45 or 90 degrees */
+    unsigned long long searchTurns; /* 90 degree arcs exploring */
+    unsigned long long halfSquares; /* driven straight */
+    unsigned long long halfSteps;   /* driven on diagonals */
+    unsigned long long wallReads;   /* front, left and right wall checks */
+    unsigned int cellsSensed;       /* cells whose walls were checked */
+    /* drive time estimated w/ the mouse's motion model, each movement
+       call starting and ending at rest, plus every mhi_DelayMs() wait,
+       search turns adding their arc on top of the square they end */
+    unsigned long long timeUs;
+} bench_mouse_stats_t;
+
+typedef struct
+{
+    unsigned int approachPerMille;  /* latched side readings flipped */
+    unsigned int restPerMille;      /* readings standing in a cell flipped */
+    unsigned int restReadUs;        /* time each reading standing takes */
+    uint16_t slipSpeed;             /* forward PWM slips start at, 0 never */
+    unsigned int slipPerMille;      /* drive calls at or above it slipping */
+    uint32_t seed;                  /* of the flips and slips, not 0 */
+} bench_mouse_noise_t;
+
+/*----------------------------------------------------------------------------*/
+/*                       Public (Exportable) Functions                        */
+/*----------------------------------------------------------------------------*/
+void bench_MouseReset(const algo_maze_map_t* p_maze);
+void bench_MouseCarryToStart(void);
+const bench_mouse_stats_t* bench_MouseGetStats(void);
+bool bench_MouseGetCell(unsigned int* p_x, unsigned int* p_y,
+    unsigned int* p_heading);
+void bench_MouseSetNoise(const bench_mouse_noise_t* p_noise);
+void bench_MouseSetModel(const algo_speedrun_model_t* p_model);
+void bench_MouseSetCrashTrap(jmp_buf* p_trap);
+void bench_MousePressButton(void);
+
+#endif /* BENCH_MOUSE_H_ */
@@ -0,0 +1,28 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : bench_usart.c
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : host benchmark
+*
+* The mhi USART print functions the algo layer calls, nothing prints on the
+* host so the benchmark output stays CSV.
+*-----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include "mouse_hardware_interface/usart_mhi.h"
+
+/*----------------------------------------------------------------------------*/
+/*                 Mouse Hardware Interface Called By algo/                   */
+/*----------------------------------------------------------------------------*/
+void mhi_PrintString(const char* p_userString)
+{
+    (void)p_userString;
+}
+
+void mhi_PrintInt(unsigned long userInt)
+{
+    (void)userInt;
+}
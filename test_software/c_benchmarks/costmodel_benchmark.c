@@ -0,0 +1,262 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : costmodel_benchmark.c
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : host benchmark
+*
+* Explores the competition mazes of solver_benchmark.c w/ algo/algo.c on the
+* virtual mouse of bench_mouse.c, then makes two speed runs on each: one
+* planned w/ the default motion model and one w/ the primitive times learned
+* so far, see algo/costmodel_algo.h. Everything runs at the safe speed
+* profile, its table starts empty before the first maze and keeps learning
+* over all of them, from every drive w/ more than one move, as on the mouse.
+*
+* The virtual mouse drives w/ BENCH_MOUSE_* instead of the default model:
+* faster on the straights and slower in the turns than the planner expects.
+*
+* Prints one CSV line per maze:
+*   model_est_s   - run time the default model expects
+*   model_run_s   - run time of its route on the mouse
+*   learned_est_s - run time the learned table expects
+*   learned_run_s - run time of its route on the mouse
+* then the mean estimate error and total run time of both, and the table
+* size. The learned table has to estimate closer and run no slower over all
+* mazes, the other profiles' tables have to stay empty, and all of them
+* have to read back from flash the same as they were saved.
+*
+* Built once per maze configuration w/ -DALGO_MAZE_CONFIG=n, see the
+* Makefile.
+*-----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "algo/algo.h"
+#include "algo/mazemap_algo.h"
+#include "algo/speedrun_algo.h"
+#include "algo/costmodel_algo.h"
+#include "algo/arena_algo.h"
+#include "bench_maze.h"
+#include "bench_flash.h"
+#include "bench_mouse.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+#define BENCH_MAZE_COUNT        (20u)
+#define BENCH_RANDOM_SEED       (101u)
+/* a proven route never takes more steps than a few laps of the maze */
+#define BENCH_MAX_STEPS         (8u * ALGO_MAZE_CELL_COUNT)
+
+/* the mouse as it drives */
+#define BENCH_MOUSE_SPEED_MM_PER_S  (700u)
+#define BENCH_MOUSE_ACCEL_MM_PER_S2 (2000u)
+#define BENCH_MOUSE_TURN_45_US      (250000u)
+#define BENCH_MOUSE_TURN_90_US      (900000u)
+#define BENCH_MOUSE_TURN_180_US     (1800000u)
+
+typedef struct
+{
+    unsigned long long estUs;
+    unsigned long long runUs;
+    double errorSum;            /* |estimate - run| / run, all mazes */
+} bench_cost_stats_t;
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+static algo_maze_map_t benchMaze;
+static algo_cost_table_t benchSaved[ALGO_COSTMODEL_PROFILE_COUNT];
+
+/*----------------------------------------------------------------------------*/
+/*                    Private (Static) Function Prototype                     */
+/*----------------------------------------------------------------------------*/
+static bool bench_Explore(const algo_speedrun_model_t* p_mouse);
+static bool bench_SpeedRun(const algo_speedrun_model_t* p_model,
+    bench_cost_stats_t* p_stats, double* p_estS, double* p_runS);
+
+/*----------------------------------------------------------------------------*/
+/*                                    Main                                    */
+/*----------------------------------------------------------------------------*/
+int main(void)
+{
+    bench_cost_stats_t stats[2];
+    algo_speedrun_model_t mouse;
+    algo_speedrun_model_t model;
+    double estS[2];
+    double runS[2];
+    unsigned int learned = 0u;
+    unsigned int entry = 0u;
+    unsigned int maze = 0u;
+
+    algo_SpeedRunGetDefaultModel(&mouse);
+    mouse.maxSpeedMmPerS = BENCH_MOUSE_SPEED_MM_PER_S;
+    mouse.accelMmPerS2 = BENCH_MOUSE_ACCEL_MM_PER_S2;
+    mouse.turn45Us = BENCH_MOUSE_TURN_45_US;
+    mouse.turn90Us = BENCH_MOUSE_TURN_90_US;
+    mouse.turn180Us = BENCH_MOUSE_TURN_180_US;
+
+    memset(stats, 0, sizeof(stats));
+    bench_FlashInit();
+    algo_CostModelClear();
+    printf("config,maze,model_est_s,model_run_s,learned_est_s,"
+        "learned_run_s\n");
+
+    for (maze = 0u; maze < BENCH_MAZE_COUNT; maze++)
+    {
+        bench_GenerateCompetitionMaze(&benchMaze, BENCH_RANDOM_SEED + maze);
+        if (!bench_Explore(&mouse))
+        {
+            printf("%ux%u cost model: maze %u not explored\n",
+                ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, maze);
+            return 1;
+        }
+
+        algo_SpeedRunGetDefaultModel(&model);
+        if (!bench_SpeedRun(&model, &stats[0], &estS[0], &runS[0]))
+            return 1;
+        model.p_costs = algo_CostModelGetTable(0u);
+        if (!bench_SpeedRun(&model, &stats[1], &estS[1], &runS[1]))
+            return 1;
+
+        printf("%ux%u,%u,%.2f,%.2f,%.2f,%.2f\n", ALGO_MAZE_WIDTH,
+            ALGO_MAZE_HEIGHT, maze, estS[0], runS[0], estS[1], runS[1]);
+    }
+
+    for (entry = 0u; entry < ALGO_COSTMODEL_ENTRY_COUNT; entry++)
+        if (algo_CostModelGetTable(0u)->samples[entry] >= ALGO_COSTMODEL_MIN_SAMPLES)
+            learned++;
+
+    printf("%ux%u cost model: estimate error %.1f%% model %.1f%% learned, "
+        "run %.1f s model %.1f s learned, %u of %u entries learned, "
+        "%u bytes\n", ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT,
+        100.0 * stats[0].errorSum / BENCH_MAZE_COUNT,
+        100.0 * stats[1].errorSum / BENCH_MAZE_COUNT,
+        stats[0].runUs / 1e6, stats[1].runUs / 1e6, learned,
+        (unsigned int)ALGO_COSTMODEL_ENTRY_COUNT,
+        (unsigned int)sizeof(algo_cost_table_t));
+
+    /* everything ran at the safe profile, the faster ones learned nothing */
+    for (entry = 0u; entry < ALGO_COSTMODEL_ENTRY_COUNT; entry++)
+    {
+        if (algo_CostModelGetTable(1u)->samples[entry] != 0u)
+        {
+            printf("%ux%u cost model: times went into another profile\n",
+                ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT);
+            return 1;
+        }
+    }
+
+    /* through flash and back, w/ a time at the fastest profile too */
+    algo_CostModelAdd(ALGO_COSTMODEL_PROFILE_COUNT - 1u, ALGO_PRIM_TURN_180,
+        0u, BENCH_MOUSE_TURN_180_US / 2u);
+    memcpy(benchSaved, algoArena.costTables, sizeof(benchSaved));
+    if (!algo_CostModelSave())
+    {
+        printf("%ux%u cost model: save failed\n",
+            ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT);
+        return 1;
+    }
+    algo_CostModelClear();
+    if (!algo_CostModelRestore()
+        || (memcmp(benchSaved, algoArena.costTables,
+            sizeof(benchSaved)) != 0))
+    {
+        printf("%ux%u cost model: restored tables differ\n",
+            ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT);
+        return 1;
+    }
+
+    if ((stats[1].errorSum >= stats[0].errorSum)
+        || (stats[1].runUs > stats[0].runUs))
+    {
+        printf("%ux%u cost model: learned table no better than the model\n",
+            ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT);
+        return 1;
+    }
+
+    return 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/*                         Private (Static) Functions                         */
+/*----------------------------------------------------------------------------*/
+/**
+* Explore benchMaze from a blank map and carry the mouse back to the start
+*
+* \param[in] p_mouse Motion model the mouse drives w/
+* \retval TRUE if exploring finished
+*/
+static bool bench_Explore(const algo_speedrun_model_t* p_mouse)
+{
+    unsigned int steps = 0u;
+    bool done = FALSE;
+
+    bench_MouseReset(&benchMaze);
+    bench_MouseSetModel(p_mouse);
+    forgetMaze();
+
+    for (steps = 0u; !done && (steps < BENCH_MAX_STEPS); steps++)
+        done = traverseCell();
+
+    bench_MouseCarryToStart();
+    placeAtStart();
+
+    return done;
+}
+
+/**
+* Plan a speed run w/ a motion model, run it and put the mouse back
+*
+* \param[in]     p_model Motion model to plan w/
+* \param[in,out] p_stats Totals to add to
+* \param[out]    p_estS  Run time the model expects
+* \param[out]    p_runS  Run time on the mouse
+* \retval FALSE if there is no route or it does not end in the goal
+*/
+static bool bench_SpeedRun(const algo_speedrun_model_t* p_model,
+    bench_cost_stats_t* p_stats, double* p_estS, double* p_runS)
+{
+    unsigned long long startUs = 0u;
+    unsigned long long runUs = 0u;
+    unsigned int mouseX = 0u;
+    unsigned int mouseY = 0u;
+    unsigned int mouseDir = 0u;
+
+    if (!algo_SpeedRunPlanDiagonal(&algoArena.mazeMap, p_model,
+        &algoArena.speedRunPrims))
+    {
+        printf("%ux%u cost model: no route\n", ALGO_MAZE_WIDTH,
+            ALGO_MAZE_HEIGHT);
+        return FALSE;
+    }
+
+    startUs = bench_MouseGetStats()->timeUs;
+    runSpeedRun();
+    runUs = bench_MouseGetStats()->timeUs - startUs;
+
+    if (!bench_MouseGetCell(&mouseX, &mouseY, &mouseDir)
+        || !ALGO_MAZE_IS_GOAL(mouseX, mouseY))
+    {
+        printf("%ux%u cost model: speed run missed the goal\n",
+            ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT);
+        return FALSE;
+    }
+
+    p_stats->estUs += algoArena.speedRunPrims.estimatedTimeUs;
+    p_stats->runUs += runUs;
+    p_stats->errorSum += (runUs > algoArena.speedRunPrims.estimatedTimeUs)
+        ? (double)(runUs - algoArena.speedRunPrims.estimatedTimeUs) / runUs
+        : (double)(algoArena.speedRunPrims.estimatedTimeUs - runUs) / runUs;
+    *p_estS = algoArena.speedRunPrims.estimatedTimeUs / 1e6;
+    *p_runS = runUs / 1e6;
+
+    bench_MouseCarryToStart();
+    placeAtStart();
+    return TRUE;
+}
@@ -0,0 +1,569 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : explore_benchmark.c
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : host benchmark
+*
+* Runs the depth first exploration of traverseCell() in algo.c against a
+* simulated wall sensor on a set of random mazes, w/ three stop rules:
+*
+*   goal   - stop on reaching the goal, the rule algo.c used to have
+*   proven - stop once the shortest route is proven, only visiting cells
+*            worth it, see algo/explore_algo.h
+*   full   - visit every reachable cell
+*
+* Dead ends are backed out of in two ways:
+*
+*   stack    - retrace the moves one cell at a time, the way algo.c used to
+*   frontier - drive the shortest known route to the nearest frontier cell,
+*              see algo/frontier_algo.h
+*
+* For each combination it reports the average cells driven, the movement
+* calls (motion primitives) the drive took, its time estimated w/ the
+* default speed run model, cells visited, and the length of the shortest
+* route through known walls when exploring stopped. The proven and full
+* rules must find the true shortest route of every maze, and the full rule
+* must visit every cell.
+*
+* The proven and full rules then run again w/ frontier backtracking on mazes
+* that follow the competition rules, once as they are and once w/ maze rule
+* wall inference, see algo/wallinfer_algo.h, to report the cell visits the
+* inference saves. Every inferred wall must match the maze.
+*
+* Last, the proven rule runs w/ inference on the competition mazes w/ and
+* w/o dead end pruning, see algo/prune_algo.h, to report the cells pruned
+* and the visits and drive time it saves. The pruned flood, brought up to
+* date cell by cell, must match a full flood everywhere but in the pruned
+* cells, and the route must still be the shortest.
+*
+* Built once per maze configuration w/ -DALGO_MAZE_CONFIG=n, see the
+* Makefile.
+*-----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "algo/algo.h"
+#include "algo/mazemap_algo.h"
+#include "algo/floodfill_algo.h"
+#include "algo/explore_algo.h"
+#include "algo/frontier_algo.h"
+#include "algo/primitive_algo.h"
+#include "algo/speedrun_algo.h"
+#include "algo/wallinfer_algo.h"
+#include "algo/prune_algo.h"
+#include "bench_maze.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+#define BENCH_MAZE_COUNT      (50u)
+#define BENCH_RANDOM_SEED     (11u)
+
+typedef enum
+{
+    BENCH_STOP_GOAL = 0u,
+    BENCH_STOP_PROVEN,
+    BENCH_STOP_FULL,
+    BENCH_STOP_COUNT
+} bench_stop_t;
+
+typedef enum
+{
+    BENCH_BACK_STACK = 0u,
+    BENCH_BACK_FRONTIER,
+    BENCH_BACK_COUNT
+} bench_back_t;
+
+typedef struct
+{
+    unsigned long long driven;      /* cells driven */
+    unsigned long long moves;       /* movement calls */
+    unsigned long long driveUs;     /* estimated drive time */
+    unsigned long long visited;     /* cells whose walls were read */
+    unsigned long long completed;   /* cells whose walls were all inferred */
+    unsigned long long pruned;      /* cells pruned as dead ends */
+    unsigned long long routeCells;  /* known shortest route when stopped */
+    uint64_t cycles;                /* planning time, flood + stop rule */
+} bench_result_t;
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+static const char* const benchStopNames[BENCH_STOP_COUNT] =
+{
+    "goal", "proven", "full"
+};
+
+static const char* const benchBackNames[BENCH_BACK_COUNT] =
+{
+    "stack", "frontier"
+};
+
+static algo_maze_map_t benchMaze;
+static algo_maze_map_t benchDiscovered;
+static uint16_t benchFlood[ALGO_MAZE_CELL_COUNT];
+static uint16_t benchKnownFlood[ALGO_MAZE_CELL_COUNT];
+static uint16_t benchFullFlood[ALGO_MAZE_CELL_COUNT];
+static uint8_t benchMoveStack[ALGO_MAZE_CELL_COUNT];
+static uint8_t benchMoves[ALGO_FRONTIER_MAX_MOVES];
+static algo_prim_list_t benchPrims;
+static algo_speedrun_model_t benchModel;
+
+/*----------------------------------------------------------------------------*/
+/*                    Private (Static) Function Prototype                     */
+/*----------------------------------------------------------------------------*/
+static void bench_RunInference(void);
+static void bench_RunPruning(void);
+static void bench_Explore(bench_stop_t stop, bench_back_t back, bool infer,
+    bool prune, bench_result_t* p_result);
+static void bench_CheckPrunedFlood(void);
+static void bench_CheckKnownWalls(void);
+static void bench_Drive(unsigned int* p_x, unsigned int* p_y,
+    unsigned int* p_heading, unsigned int moveCount, bench_result_t* p_result);
+static unsigned int bench_KnownRouteCells(const algo_maze_map_t* p_map);
+
+/*----------------------------------------------------------------------------*/
+/*                                    Main                                    */
+/*----------------------------------------------------------------------------*/
+int main(void)
+{
+    static bench_result_t results[BENCH_STOP_COUNT][BENCH_BACK_COUNT];
+    bench_result_t maze;
+    unsigned int shortest = 0u;
+    unsigned int seed = 0u;
+    unsigned int stop = 0u;
+    unsigned int back = 0u;
+    bench_result_t* p_total = NULL;
+
+    algo_SpeedRunGetDefaultModel(&benchModel);
+
+    for (seed = 0u; seed < BENCH_MAZE_COUNT; seed++)
+    {
+        bench_GenerateMaze(&benchMaze, BENCH_RANDOM_SEED + seed);
+        shortest = bench_KnownRouteCells(&benchMaze);
+
+        for (stop = 0u; stop < BENCH_STOP_COUNT; stop++)
+            for (back = 0u; back < BENCH_BACK_COUNT; back++)
+            {
+                maze = (bench_result_t){ 0u };
+                bench_Explore((bench_stop_t)stop, (bench_back_t)back, FALSE,
+                    FALSE, &maze);
+                if (((stop != BENCH_STOP_GOAL) && (maze.routeCells != shortest))
+                    || ((stop == BENCH_STOP_FULL)
+                    && (maze.visited != ALGO_MAZE_CELL_COUNT)))
+                {
+                    printf("%ux%u explore %s/%s: route of %llu cells after "
+                        "%llu visits on maze %u, shortest is %u\n",
+                        ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, benchStopNames[stop],
+                        benchBackNames[back], maze.routeCells, maze.visited,
+                        seed, shortest);
+                    exit(1);
+                }
+
+                p_total = &results[stop][back];
+                p_total->driven += maze.driven;
+                p_total->moves += maze.moves;
+                p_total->driveUs += maze.driveUs;
+                p_total->visited += maze.visited;
+                p_total->routeCells += maze.routeCells;
+                p_total->cycles += maze.cycles;
+            }
+    }
+
+    for (stop = 0u; stop < BENCH_STOP_COUNT; stop++)
+        for (back = 0u; back < BENCH_BACK_COUNT; back++)
+        {
+            p_total = &results[stop][back];
+            printf("%ux%u explore %-6s %-8s %6llu cells driven %6llu moves "
+                "%7llu ms %6llu visited %5llu route cells %10llu cycles\n",
+                ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, benchStopNames[stop],
+                benchBackNames[back], p_total->driven / BENCH_MAZE_COUNT,
+                p_total->moves / BENCH_MAZE_COUNT,
+                p_total->driveUs / (1000u * BENCH_MAZE_COUNT),
+                p_total->visited / BENCH_MAZE_COUNT,
+                p_total->routeCells / BENCH_MAZE_COUNT,
+                (unsigned long long)(p_total->cycles / BENCH_MAZE_COUNT));
+        }
+
+    bench_RunInference();
+    bench_RunPruning();
+
+    return 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/*                         Private (Static) Functions                         */
+/*----------------------------------------------------------------------------*/
+/**
+* Explore competition mazes w/ and w/o wall inference and report the visits
+* it saves
+*
+* \param None
+* \retval None
+*/
+static void bench_RunInference(void)
+{
+    static const bench_stop_t stops[2] = { BENCH_STOP_PROVEN, BENCH_STOP_FULL };
+    static bench_result_t results[2][2];
+    bench_result_t maze;
+    bench_result_t* p_plain = NULL;
+    bench_result_t* p_infer = NULL;
+    unsigned int shortest = 0u;
+    unsigned int seed = 0u;
+    unsigned int stop = 0u;
+    unsigned int infer = 0u;
+
+    for (seed = 0u; seed < BENCH_MAZE_COUNT; seed++)
+    {
+        bench_GenerateCompetitionMaze(&benchMaze, BENCH_RANDOM_SEED + seed);
+        shortest = bench_KnownRouteCells(&benchMaze);
+
+        for (stop = 0u; stop < 2u; stop++)
+            for (infer = 0u; infer < 2u; infer++)
+            {
+                maze = (bench_result_t){ 0u };
+                bench_Explore(stops[stop], BENCH_BACK_FRONTIER, (bool)infer,
+                    FALSE, &maze);
+                if ((maze.routeCells != shortest)
+                    || ((stops[stop] == BENCH_STOP_FULL)
+                    && (maze.visited + maze.completed != ALGO_MAZE_CELL_COUNT)))
+                {
+                    printf("%ux%u infer %s/%s: route of %llu cells after "
+                        "%llu visits on maze %u, shortest is %u\n",
+                        ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT,
+                        benchStopNames[stops[stop]], infer ? "on" : "off",
+                        maze.routeCells, maze.visited + maze.completed, seed,
+                        shortest);
+                    exit(1);
+                }
+                if (infer)
+                    bench_CheckKnownWalls();
+
+                results[stop][infer].driven += maze.driven;
+                results[stop][infer].driveUs += maze.driveUs;
+                results[stop][infer].visited += maze.visited;
+                results[stop][infer].completed += maze.completed;
+                results[stop][infer].cycles += maze.cycles;
+            }
+    }
+
+    for (stop = 0u; stop < 2u; stop++)
+    {
+        p_plain = &results[stop][0];
+        p_infer = &results[stop][1];
+        printf("%ux%u infer %-6s off %6llu visited %6llu cells driven %7llu ms "
+            "%10llu cycles\n", ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT,
+            benchStopNames[stops[stop]], p_plain->visited / BENCH_MAZE_COUNT,
+            p_plain->driven / BENCH_MAZE_COUNT,
+            p_plain->driveUs / (1000u * BENCH_MAZE_COUNT),
+            (unsigned long long)(p_plain->cycles / BENCH_MAZE_COUNT));
+        printf("%ux%u infer %-6s on  %6llu visited %6llu cells driven %7llu ms "
+            "%10llu cycles %5llu cells completed %5lld visits saved\n",
+            ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, benchStopNames[stops[stop]],
+            p_infer->visited / BENCH_MAZE_COUNT,
+            p_infer->driven / BENCH_MAZE_COUNT,
+            p_infer->driveUs / (1000u * BENCH_MAZE_COUNT),
+            (unsigned long long)(p_infer->cycles / BENCH_MAZE_COUNT),
+            p_infer->completed / BENCH_MAZE_COUNT,
+            ((long long)p_plain->visited - (long long)p_infer->visited)
+            / (long long)BENCH_MAZE_COUNT);
+    }
+}
+
+/**
+* Explore competition mazes to a proven route w/ and w/o dead end pruning
+* and report the cells it skips and the time it saves
+*
+* \param None
+* \retval None
+*/
+static void bench_RunPruning(void)
+{
+    static bench_result_t results[2];
+    bench_result_t maze;
+    unsigned int shortest = 0u;
+    unsigned int seed = 0u;
+    unsigned int prune = 0u;
+
+    for (seed = 0u; seed < BENCH_MAZE_COUNT; seed++)
+    {
+        bench_GenerateCompetitionMaze(&benchMaze, BENCH_RANDOM_SEED + seed);
+        shortest = bench_KnownRouteCells(&benchMaze);
+
+        for (prune = 0u; prune < 2u; prune++)
+        {
+            maze = (bench_result_t){ 0u };
+            bench_Explore(BENCH_STOP_PROVEN, BENCH_BACK_FRONTIER, TRUE,
+                (bool)prune, &maze);
+            if (maze.routeCells != shortest)
+            {
+                printf("%ux%u prune %s: route of %llu cells on maze %u, "
+                    "shortest is %u\n", ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT,
+                    prune ? "on" : "off", maze.routeCells, seed, shortest);
+                exit(1);
+            }
+
+            results[prune].driven += maze.driven;
+            results[prune].driveUs += maze.driveUs;
+            results[prune].visited += maze.visited;
+            results[prune].pruned += maze.pruned;
+            results[prune].cycles += maze.cycles;
+        }
+    }
+
+    printf("%ux%u prune proven off %6llu visited %6llu cells driven %7llu ms "
+        "%10llu cycles\n", ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT,
+        results[0].visited / BENCH_MAZE_COUNT,
+        results[0].driven / BENCH_MAZE_COUNT,
+        results[0].driveUs / (1000u * BENCH_MAZE_COUNT),
+        (unsigned long long)(results[0].cycles / BENCH_MAZE_COUNT));
+    printf("%ux%u prune proven on  %6llu visited %6llu cells driven %7llu ms "
+        "%10llu cycles %5llu cells pruned %5lld visits saved %6lld ms saved\n",
+        ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT,
+        results[1].visited / BENCH_MAZE_COUNT,
+        results[1].driven / BENCH_MAZE_COUNT,
+        results[1].driveUs / (1000u * BENCH_MAZE_COUNT),
+        (unsigned long long)(results[1].cycles / BENCH_MAZE_COUNT),
+        results[1].pruned / BENCH_MAZE_COUNT,
+        ((long long)results[0].visited - (long long)results[1].visited)
+        / (long long)BENCH_MAZE_COUNT,
+        ((long long)results[0].driveUs - (long long)results[1].driveUs)
+        / (long long)(1000u * BENCH_MAZE_COUNT));
+}
+
+/**
+* Explore benchMaze from the start the way traverseCell() does
+*
+* \param[in]  stop     Stop rule
+* \param[in]  back     How dead ends are backed out of
+* \param[in]  infer    TRUE to infer walls from the maze rules
+* \param[in]  prune    TRUE to leave dead ends out of the flood
+* \param[out] p_result Cells driven and visited, known route when stopped
+* \retval None
+*/
+static void bench_Explore(bench_stop_t stop, bench_back_t back, bool infer,
+    bool prune, bench_result_t* p_result)
+{
+    unsigned int x = ALGO_MAZE_START_X;
+    unsigned int y = ALGO_MAZE_START_Y;
+    unsigned int heading = ALGO_MAZE_START_HEADING;
+    unsigned int moveCount = 0u;
+    unsigned int top = 0u;
+    unsigned int cost = 0u;
+    unsigned int nextDir = 0u;
+    unsigned int dir = 0u;
+    unsigned int nx = 0u;
+    unsigned int ny = 0u;
+    bool flooded = FALSE;
+    unsigned int inferred = 0u;
+    const algo_maze_row_t* p_allowed = NULL;
+    uint64_t start = 0u;
+    MazeCell walls;
+
+    algo_MazeMapClear(&benchDiscovered);
+    algo_PruneClear();
+
+    for (;;)
+    {
+        if ((stop == BENCH_STOP_GOAL) && ALGO_MAZE_IS_GOAL(x, y))
+            break;
+
+        if (!algo_MazeMapIsVisited(&benchDiscovered, x, y))
+        {
+            /* simulated sensor, reads every wall of the cell */
+            algo_MazeMapGetCellWalls(&benchMaze, x, y, &walls);
+            algo_MazeMapSetCellWalls(&benchDiscovered, x, y, &walls);
+            algo_MazeMapSetVisited(&benchDiscovered, x, y);
+            p_result->visited++;
+
+            start = bench_Now();
+            if (infer)
+            {
+                inferred = algo_WallInferAround(&benchDiscovered, x, y);
+                p_result->completed += algo_WallInferGetCellsCompleted();
+            }
+            if (prune && flooded && (inferred == 0u))
+            {
+                algo_FloodUpdateWithin(&benchDiscovered, benchFlood, x, y,
+                    algo_PruneGetKeptCells());
+                if (algo_PruneUpdate(&benchDiscovered) != 0u)
+                    algo_FloodClearCells(benchFlood, algo_PruneGetNewCells());
+            }
+            else if (prune)
+            {
+                algo_PruneUpdate(&benchDiscovered);
+                algo_FloodFillWithin(&benchDiscovered, benchFlood,
+                    algo_PruneGetKeptCells());
+            }
+            else if (flooded && (inferred == 0u))
+                algo_FloodUpdate(&benchDiscovered, benchFlood, x, y);
+            else
+                algo_FloodFill(&benchDiscovered, benchFlood);
+            flooded = TRUE;
+            if (stop == BENCH_STOP_PROVEN)
+                algo_ExploreUpdate(&benchDiscovered, benchFlood);
+            p_result->cycles += bench_Now() - start;
+            if (prune)
+                bench_CheckPrunedFlood();
+        }
+
+        if ((stop == BENCH_STOP_PROVEN) && algo_ExploreIsRouteProven())
+            break;
+
+        /* cheapest open unvisited neighbor, same order as traverseCell() */
+        cost = UINT_MAX;
+        for (dir = 0u; dir < 4u; dir++)
+        {
+            static const uint8_t order[4] = { NORTH, EAST, SOUTH, WEST };
+
+            if (algo_MazeMapHasWall(&benchDiscovered, x, y, order[dir]))
+                continue;
+            nx = x + ((order[dir] == EAST) ? 1u : 0u) - ((order[dir] == WEST) ? 1u : 0u);
+            ny = y + ((order[dir] == NORTH) ? 1u : 0u) - ((order[dir] == SOUTH) ? 1u : 0u);
+            if (algo_MazeMapIsVisited(&benchDiscovered, nx, ny))
+                continue;
+            if ((stop == BENCH_STOP_PROVEN) && !algo_ExploreIsWorthVisiting(nx, ny))
+                continue;
+            if (benchFlood[ALGO_MAZE_IDX(nx, ny)] < cost)
+            {
+                cost = benchFlood[ALGO_MAZE_IDX(nx, ny)];
+                nextDir = order[dir];
+            }
+        }
+
+        if (cost != UINT_MAX)
+        {
+            benchMoveStack[top++] = (uint8_t)nextDir;
+            benchMoves[0] = (uint8_t)nextDir;
+            moveCount = 1u;
+        }
+        else if (back == BENCH_BACK_FRONTIER)
+        {
+            p_allowed = (stop == BENCH_STOP_PROVEN) ? algo_ExploreGetWorthCells() : NULL;
+            start = bench_Now();
+            if (!algo_FrontierPlan(&benchDiscovered, p_allowed, x, y, heading,
+                benchMoves, &moveCount))
+                break;
+            p_result->cycles += bench_Now() - start;
+        }
+        else if (top > 0u)
+        {
+            benchMoves[0] = benchMoveStack[--top] ^ 1u;
+            moveCount = 1u;
+        }
+        else
+            break;
+
+        bench_Drive(&x, &y, &heading, moveCount, p_result);
+    }
+
+    p_result->routeCells = bench_KnownRouteCells(&benchDiscovered);
+    p_result->pruned = algo_PruneGetCount();
+}
+
+/**
+* Check the pruned benchFlood matches a full flood of benchDiscovered in
+* every cell not pruned, and is unreachable in the pruned ones
+*
+* \param None
+* \retval None
+*/
+static void bench_CheckPrunedFlood(void)
+{
+    unsigned int idx = 0u;
+    unsigned int x = 0u;
+    unsigned int y = 0u;
+    uint16_t expected = 0u;
+
+    algo_FloodFill(&benchDiscovered, benchFullFlood);
+    for (idx = 0u; idx < ALGO_MAZE_CELL_COUNT; idx++)
+    {
+        x = ALGO_MAZE_IDX_X(idx);
+        y = ALGO_MAZE_IDX_Y(idx);
+        expected = algo_PruneIsPruned(x, y) ? UINT_MAX : benchFullFlood[idx];
+        if (benchFlood[idx] != expected)
+        {
+            printf("%ux%u prune: cell (%u, %u) flooded %u, expected %u\n",
+                ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, x, y,
+                (unsigned int)benchFlood[idx], (unsigned int)expected);
+            exit(1);
+        }
+    }
+}
+
+/**
+* Check every wall known in benchDiscovered matches benchMaze
+*
+* \param None
+* \retval None
+*/
+static void bench_CheckKnownWalls(void)
+{
+    unsigned int x = 0u;
+    unsigned int y = 0u;
+    unsigned int dir = 0u;
+
+    for (y = 0u; y < ALGO_MAZE_HEIGHT; y++)
+        for (x = 0u; x < ALGO_MAZE_WIDTH; x++)
+            for (dir = NORTH; dir <= WEST; dir++)
+                if (algo_MazeMapIsWallKnown(&benchDiscovered, x, y, dir)
+                    && (algo_MazeMapHasWall(&benchDiscovered, x, y, dir)
+                    != algo_MazeMapHasWall(&benchMaze, x, y, dir)))
+                {
+                    printf("%ux%u infer: wrong wall on side %u of cell (%u, %u)\n",
+                        ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, dir, x, y);
+                    exit(1);
+                }
+}
+
+/**
+* Drive benchMoves as one movement call per primitive, straights merged
+*
+* \param[in,out] p_x       Column of the mouse
+* \param[in,out] p_y       Row of the mouse
+* \param[in,out] p_heading Heading of the mouse
+* \param[in]     moveCount Cell moves in benchMoves
+* \param[out]    p_result  Cells driven, moves and drive time added
+* \retval None
+*/
+static void bench_Drive(unsigned int* p_x, unsigned int* p_y,
+    unsigned int* p_heading, unsigned int moveCount, bench_result_t* p_result)
+{
+    unsigned int i = 0u;
+
+    if (!algo_PrimCompilePath(*p_heading, benchMoves, moveCount, &benchPrims))
+    {
+        printf("%ux%u explore: %u moves do not fit a primitive list\n",
+            ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, moveCount);
+        exit(1);
+    }
+    p_result->moves += benchPrims.count;
+    p_result->driveUs += algo_SpeedRunEstimatePrimsUs(&benchModel, &benchPrims);
+
+    for (i = 0u; i < moveCount; i++)
+    {
+        *p_x = *p_x + ((benchMoves[i] == EAST) ? 1u : 0u)
+            - ((benchMoves[i] == WEST) ? 1u : 0u);
+        *p_y = *p_y + ((benchMoves[i] == NORTH) ? 1u : 0u)
+            - ((benchMoves[i] == SOUTH) ? 1u : 0u);
+        *p_heading = benchMoves[i];
+    }
+    p_result->driven += moveCount;
+}
+
+/**
+* Cells of the shortest route from the start through known open walls
+*
+* \param[in] p_map Maze map
+* \retval Cells, UINT_MAX if there is no known route
+*/
+static unsigned int bench_KnownRouteCells(const algo_maze_map_t* p_map)
+{
+    algo_FloodFillKnown(p_map, benchKnownFlood);
+    return benchKnownFlood[ALGO_MAZE_IDX(ALGO_MAZE_START_X, ALGO_MAZE_START_Y)];
+}
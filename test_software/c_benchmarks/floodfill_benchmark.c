@@ -0,0 +1,350 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : floodfill_benchmark.c
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : host benchmark
+*
+* Compares the queue based algo_FloodFill() against the recursive flood fill
+* it replaced. Both fills run on an empty maze (start of a run, nothing
+* discovered yet) and on a fully discovered random maze.
+*
+* For each case the benchmark checks both fills agree, then reports the
+* average time per fill and the peak stack the fill needed. Stack use is
+* measured by running the fill on its own painted stack.
+*
+* The random maze is then explored one cell at a time, in the order a
+* breadth first walk from the start reaches them. After every cell the flood
+* map is brought up to date both w/ a full algo_FloodFill() and w/
+* algo_FloodUpdate(); the maps must agree, and the average time and cells
+* touched per discovered cell are reported for both.
+*
+* It also prints the RAM the maze map and flood map take, next to what the
+* old per cell MazeCell / visited / unsigned int flood arrays took.
+*
+* Built once per maze configuration w/ -DALGO_MAZE_CONFIG=n, see the
+* Makefile.
+*-----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ucontext.h>
+#include "algo/algo.h"
+#include "algo/mazemap_algo.h"
+#include "algo/floodfill_algo.h"
+#include "bench_maze.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+#define BENCH_CELL_COUNT      (ALGO_MAZE_CELL_COUNT)
+#define BENCH_ITERATIONS      (200)
+#define BENCH_STACK_SIZE      (4u * 1024u * 1024u)
+#define BENCH_STACK_PAINT     (0xA5)
+#define BENCH_RANDOM_SEED     (7u)
+
+typedef void (*bench_fill_t)(const algo_maze_map_t*, uint16_t*);
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+static algo_maze_map_t benchMaze;
+static uint16_t benchFloodRecursive[BENCH_CELL_COUNT];
+static uint16_t benchFloodQueue[BENCH_CELL_COUNT];
+static algo_maze_map_t benchDiscovered;
+
+static ucontext_t benchMainContext;
+static ucontext_t benchFillContext;
+static bench_fill_t benchFill;
+static uint16_t* p_benchFlood;
+static unsigned char* p_benchStack;
+
+/*----------------------------------------------------------------------------*/
+/*                    Private (Static) Function Prototype                     */
+/*----------------------------------------------------------------------------*/
+static void bench_RecursiveFloodFill(const algo_maze_map_t* p_map,
+    uint16_t* p_destFlood);
+static void bench_RecursiveFloodFillCell(const algo_maze_map_t* p_map,
+    unsigned int x, unsigned int y, unsigned int cost, uint16_t* p_destFlood);
+static unsigned int bench_Idx(unsigned int x, unsigned int y);
+static void bench_FillTrampoline(void);
+static size_t bench_MeasureStack(bench_fill_t fill, uint16_t* p_destFlood);
+static void bench_Run(const char* p_caseName);
+static void bench_RunExplore(void);
+
+/*----------------------------------------------------------------------------*/
+/*                                    Main                                    */
+/*----------------------------------------------------------------------------*/
+int main(void)
+{
+    p_benchStack = malloc(BENCH_STACK_SIZE);
+    if (p_benchStack == NULL)
+        return 1;
+
+    /* per cell bools + unsigned int flood vs bit map + uint16_t flood */
+    printf("%ux%u maze RAM: MazeCell arrays %6u bytes, bit map + flood %6u bytes\n",
+        ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT,
+        (unsigned int)(BENCH_CELL_COUNT * (sizeof(MazeCell) + sizeof(bool)
+        + sizeof(unsigned int))),
+        (unsigned int)(sizeof(algo_maze_map_t)
+        + (BENCH_CELL_COUNT * sizeof(uint16_t))));
+
+    /* nothing discovered yet, every wall still assumed open */
+    algo_MazeMapClear(&benchMaze);
+    bench_Run("empty");
+
+    /* fully discovered random maze */
+    bench_GenerateMaze(&benchMaze, BENCH_RANDOM_SEED);
+    bench_Run("random");
+    bench_RunExplore();
+
+    free(p_benchStack);
+    return 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/*                         Private (Static) Functions                         */
+/*----------------------------------------------------------------------------*/
+/**
+* Run both fills on the current maze and print one result line per fill
+*
+* \param[in] p_caseName Name of the maze case for the report
+* \retval None
+*/
+static void bench_Run(const char* p_caseName)
+{
+    uint64_t start = 0u;
+    uint64_t recursiveTime = 0u;
+    uint64_t queueTime = 0u;
+    size_t recursiveStack = 0u;
+    size_t queueStack = 0u;
+    int i = 0;
+
+    recursiveStack = bench_MeasureStack(bench_RecursiveFloodFill,
+        benchFloodRecursive);
+    queueStack = bench_MeasureStack(algo_FloodFill, benchFloodQueue);
+
+    if (memcmp(benchFloodRecursive, benchFloodQueue, sizeof(benchFloodQueue)))
+    {
+        printf("%ux%u %s: MISMATCH between recursive and queue flood\n",
+            ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, p_caseName);
+        exit(1);
+    }
+
+    start = bench_Now();
+    for (i = 0; i < BENCH_ITERATIONS; i++)
+        bench_RecursiveFloodFill(&benchMaze, benchFloodRecursive);
+    recursiveTime = (bench_Now() - start) / BENCH_ITERATIONS;
+
+    start = bench_Now();
+    for (i = 0; i < BENCH_ITERATIONS; i++)
+        algo_FloodFill(&benchMaze, benchFloodQueue);
+    queueTime = (bench_Now() - start) / BENCH_ITERATIONS;
+
+    printf("%ux%u %-6s recursive: %10llu cycles %8zu stack bytes\n",
+        ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, p_caseName,
+        (unsigned long long)recursiveTime, recursiveStack);
+    printf("%ux%u %-6s queue:     %10llu cycles %8zu stack bytes\n",
+        ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, p_caseName,
+        (unsigned long long)queueTime, queueStack);
+}
+
+/**
+* Discover the current maze cell by cell and compare a full re-flood w/ the
+* incremental update after every cell
+*
+* \param None
+* \retval None
+*/
+static void bench_RunExplore(void)
+{
+    static uint16_t order[BENCH_CELL_COUNT];
+    static uint8_t seen[BENCH_CELL_COUNT];
+    unsigned int head = 0u;
+    unsigned int tail = 0u;
+    unsigned int idx = 0u;
+    unsigned int x = 0u;
+    unsigned int y = 0u;
+    uint64_t start = 0u;
+    uint64_t fullTime = 0u;
+    uint64_t updateTime = 0u;
+    uint64_t fullTouched = 0u;
+    uint64_t updateTouched = 0u;
+    MazeCell walls;
+
+    /* walk order: breadth first from the start through open walls */
+    memset(seen, 0, sizeof(seen));
+    order[tail++] = (uint16_t)bench_Idx(0u, 0u);
+    seen[bench_Idx(0u, 0u)] = 1u;
+    while (head < tail)
+    {
+        idx = order[head++];
+        x = ALGO_MAZE_IDX_X(idx);
+        y = ALGO_MAZE_IDX_Y(idx);
+        if (!algo_MazeMapHasWall(&benchMaze, x, y, NORTH) && !seen[bench_Idx(x, y + 1)])
+        {
+            seen[bench_Idx(x, y + 1)] = 1u;
+            order[tail++] = (uint16_t)bench_Idx(x, y + 1);
+        }
+        if (!algo_MazeMapHasWall(&benchMaze, x, y, SOUTH) && !seen[bench_Idx(x, y - 1)])
+        {
+            seen[bench_Idx(x, y - 1)] = 1u;
+            order[tail++] = (uint16_t)bench_Idx(x, y - 1);
+        }
+        if (!algo_MazeMapHasWall(&benchMaze, x, y, EAST) && !seen[bench_Idx(x + 1, y)])
+        {
+            seen[bench_Idx(x + 1, y)] = 1u;
+            order[tail++] = (uint16_t)bench_Idx(x + 1, y);
+        }
+        if (!algo_MazeMapHasWall(&benchMaze, x, y, WEST) && !seen[bench_Idx(x - 1, y)])
+        {
+            seen[bench_Idx(x - 1, y)] = 1u;
+            order[tail++] = (uint16_t)bench_Idx(x - 1, y);
+        }
+    }
+
+    algo_MazeMapClear(&benchDiscovered);
+    algo_FloodFill(&benchDiscovered, benchFloodQueue);
+    memcpy(benchFloodRecursive, benchFloodQueue, sizeof(benchFloodQueue));
+
+    for (head = 0u; head < tail; head++)
+    {
+        idx = order[head];
+        x = ALGO_MAZE_IDX_X(idx);
+        y = ALGO_MAZE_IDX_Y(idx);
+        algo_MazeMapGetCellWalls(&benchMaze, x, y, &walls);
+        algo_MazeMapSetCellWalls(&benchDiscovered, x, y, &walls);
+
+        start = bench_Now();
+        algo_FloodFill(&benchDiscovered, benchFloodRecursive);
+        fullTime += bench_Now() - start;
+        fullTouched += algo_FloodGetCellsTouched();
+
+        start = bench_Now();
+        updateTouched += algo_FloodUpdate(&benchDiscovered, benchFloodQueue, x, y);
+        updateTime += bench_Now() - start;
+
+        if (memcmp(benchFloodRecursive, benchFloodQueue, sizeof(benchFloodQueue)))
+        {
+            printf("%ux%u explore: MISMATCH between full and incremental flood "
+                "at cell (%u, %u)\n", ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, x, y);
+            exit(1);
+        }
+    }
+
+    printf("%ux%u explore full:      %10llu cycles %8llu cells touched per cell\n",
+        ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, (unsigned long long)(fullTime / tail),
+        (unsigned long long)(fullTouched / tail));
+    printf("%ux%u explore update:    %10llu cycles %8llu cells touched per cell\n",
+        ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, (unsigned long long)(updateTime / tail),
+        (unsigned long long)(updateTouched / tail));
+}
+
+/**
+* Run a fill on a painted stack and return how much of it was touched
+*
+* \param[in]  fill        Flood fill to measure
+* \param[out] p_destFlood Flood map the fill writes
+* \retval Peak stack use in bytes
+*/
+static size_t bench_MeasureStack(bench_fill_t fill, uint16_t* p_destFlood)
+{
+    size_t untouched = 0u;
+
+    memset(p_benchStack, BENCH_STACK_PAINT, BENCH_STACK_SIZE);
+    benchFill = fill;
+    p_benchFlood = p_destFlood;
+
+    getcontext(&benchFillContext);
+    benchFillContext.uc_stack.ss_sp = p_benchStack;
+    benchFillContext.uc_stack.ss_size = BENCH_STACK_SIZE;
+    benchFillContext.uc_link = &benchMainContext;
+    makecontext(&benchFillContext, bench_FillTrampoline, 0);
+    swapcontext(&benchMainContext, &benchFillContext);
+
+    /* stack grows down, paint left at the bottom was never reached */
+    while ((untouched < BENCH_STACK_SIZE)
+        && (p_benchStack[untouched] == BENCH_STACK_PAINT))
+        untouched++;
+
+    return BENCH_STACK_SIZE - untouched;
+}
+
+/**
+* Entry point of the painted stack context
+*
+* \param None
+* \retval None
+*/
+static void bench_FillTrampoline(void)
+{
+    benchFill(&benchMaze, p_benchFlood);
+}
+
+/**
+* Recursive flood fill as algo.c used to have it, kept as the reference
+*
+* \param[in]  p_map          Walls discovered so far
+* \param[out] p_destFlood    Cells to the goal
+* \retval None
+*/
+static void bench_RecursiveFloodFill(const algo_maze_map_t* p_map,
+    uint16_t* p_destFlood)
+{
+    unsigned int i = 0u;
+    unsigned int x = 0u;
+    unsigned int y = 0u;
+
+    for (i = 0u; i < BENCH_CELL_COUNT; i++)
+        p_destFlood[i] = UINT_MAX;
+
+    for (y = ALGO_MAZE_GOAL_Y_MIN; y <= ALGO_MAZE_GOAL_Y_MAX; y++)
+        for (x = ALGO_MAZE_GOAL_X_MIN; x <= ALGO_MAZE_GOAL_X_MAX; x++)
+            bench_RecursiveFloodFillCell(p_map, x, y, 0, p_destFlood);
+}
+
+/**
+* One level of the reference recursive flood fill
+*
+* \param[in]  p_map          Walls discovered so far
+* \param[in]  x              Cell column
+* \param[in]  y              Cell row
+* \param[in]  cost           Cost to give the cell
+* \param[out] p_destFlood    Cells to the goal
+* \retval None
+*/
+static void bench_RecursiveFloodFillCell(const algo_maze_map_t* p_map,
+    unsigned int x, unsigned int y, unsigned int cost, uint16_t* p_destFlood)
+{
+    p_destFlood[bench_Idx(x, y)] = cost;
+
+    if ((y + 1 < ALGO_MAZE_HEIGHT) && !algo_MazeMapHasWall(p_map, x, y, NORTH))
+        if (p_destFlood[bench_Idx(x, y + 1)] > cost + 1)
+            bench_RecursiveFloodFillCell(p_map, x, y + 1, cost + 1, p_destFlood);
+    if ((y > 0) && !algo_MazeMapHasWall(p_map, x, y, SOUTH))
+        if (p_destFlood[bench_Idx(x, y - 1)] > cost + 1)
+            bench_RecursiveFloodFillCell(p_map, x, y - 1, cost + 1, p_destFlood);
+    if ((x + 1 < ALGO_MAZE_WIDTH) && !algo_MazeMapHasWall(p_map, x, y, EAST))
+        if (p_destFlood[bench_Idx(x + 1, y)] > cost + 1)
+            bench_RecursiveFloodFillCell(p_map, x + 1, y, cost + 1, p_destFlood);
+    if ((x > 0) && !algo_MazeMapHasWall(p_map, x, y, WEST))
+        if (p_destFlood[bench_Idx(x - 1, y)] > cost + 1)
+            bench_RecursiveFloodFillCell(p_map, x - 1, y, cost + 1, p_destFlood);
+}
+
+/**
+* Maze array index of a cell, same layout as algo.c
+*
+* \param[in] x Cell column
+* \param[in] y Cell row
+* \retval Maze array index
+*/
+static unsigned int bench_Idx(unsigned int x, unsigned int y)
+{
+    return ALGO_MAZE_IDX(x, y);
+}
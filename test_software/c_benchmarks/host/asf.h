@@ -0,0 +1,19 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : asf.h
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : host benchmark
+*
+* Stands in for the ASF umbrella header when algo/algo.c is built on the
+* host. algo.c only needs the C library from it, the hardware is reached
+* through the mci and mhi functions, which bench_mouse.c provides.
+*-----------------------------------------------------------------------------*/
+
+#ifndef ASF_H
+#define ASF_H
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#endif /* ASF_H */
@@ -0,0 +1,234 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : mazefile_benchmark.c
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : host benchmark
+*
+* Checks and times the text maze files of bench_mazefile.c on the corpus in
+* test_software/mazes:
+*
+*   round trip - every maze the size of this configuration goes into a maze
+*                map and back, and is written out and read back, w/o a
+*                wall changing
+*   bulk load  - the whole corpus is read from disk over and over until
+*                BENCH_LOAD_COUNT mazes are loaded, reporting the time per
+*                maze
+*
+* Also run by make w/ other arguments:
+*   --digest FILE...    one "name digest" line per file, make run diffs
+*                       it against python_tests/mazefile.py --digest
+*   --write DIR COUNT   write COUNT competition mazes of this
+*                       configuration, how the corpus was made
+*
+* Built once per maze configuration w/ -DALGO_MAZE_CONFIG=n, see the
+* Makefile.
+*-----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "algo/algo.h"
+#include "algo/mazemap_algo.h"
+#include "bench_maze.h"
+#include "bench_mazefile.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+#define BENCH_CORPUS_MAX      (256u)
+#define BENCH_LOAD_COUNT      (500u)
+#define BENCH_RANDOM_SEED     (301u)
+#define BENCH_TEXT_SIZE       (16u * 1024u)
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+static bench_mazefile_t benchCorpus[BENCH_CORPUS_MAX];
+static bench_mazefile_t benchCopy;
+static algo_maze_map_t benchMap;
+static char benchText[BENCH_TEXT_SIZE];
+static char benchDigest[BENCH_MAZEFILE_DIGEST_SIZE];
+
+/*----------------------------------------------------------------------------*/
+/*                    Private (Static) Function Prototype                     */
+/*----------------------------------------------------------------------------*/
+static int bench_PrintDigests(int fileCount, char** p_files);
+static int bench_WriteCorpus(const char* p_dir, unsigned int count);
+static bool bench_SameWalls(const bench_mazefile_t* p_a,
+    const bench_mazefile_t* p_b);
+static double bench_NowUs(void);
+
+/*----------------------------------------------------------------------------*/
+/*                                    Main                                    */
+/*----------------------------------------------------------------------------*/
+int main(int argc, char** argv)
+{
+    FILE* p_text = NULL;
+    unsigned int count = 0u;
+    unsigned int loaded = 0u;
+    unsigned int sized = 0u;
+    unsigned int maze = 0u;
+    double start = 0.0;
+    double elapsedUs = 0.0;
+
+    if ((argc > 2) && (strcmp(argv[1], "--digest") == 0))
+        return bench_PrintDigests(argc - 2, &argv[2]);
+    if ((argc == 4) && (strcmp(argv[1], "--write") == 0))
+        return bench_WriteCorpus(argv[2], (unsigned int)atoi(argv[3]));
+
+    count = bench_MazeFileLoadDir(BENCH_MAZEFILE_DIR, benchCorpus,
+        BENCH_CORPUS_MAX);
+    if (count == 0u)
+    {
+        printf("%ux%u mazefile: no mazes in %s\n", ALGO_MAZE_WIDTH,
+            ALGO_MAZE_HEIGHT, BENCH_MAZEFILE_DIR);
+        return 1;
+    }
+
+    for (maze = 0u; maze < count; maze++)
+    {
+        /* text round trip, any size */
+        p_text = fmemopen(benchText, sizeof(benchText), "w");
+        bench_MazeFileWrite(p_text, &benchCorpus[maze]);
+        fclose(p_text);
+        if (!bench_MazeFileParse(benchText, strlen(benchText), &benchCopy)
+            || !bench_SameWalls(&benchCorpus[maze], &benchCopy))
+        {
+            printf("%ux%u mazefile: %s changed when written and read back\n",
+                ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, benchCorpus[maze].name);
+            return 1;
+        }
+
+        /* maze map round trip, this configuration's size only */
+        if (!bench_MazeFileToMap(&benchCorpus[maze], &benchMap))
+            continue;
+        bench_MazeFileFromMap(&benchMap, &benchCopy);
+        if (!bench_SameWalls(&benchCorpus[maze], &benchCopy))
+        {
+            printf("%ux%u mazefile: %s changed in a maze map, its walls do "
+                "not match from both sides\n", ALGO_MAZE_WIDTH,
+                ALGO_MAZE_HEIGHT, benchCorpus[maze].name);
+            return 1;
+        }
+        sized++;
+    }
+
+    start = bench_NowUs();
+    for (loaded = 0u; loaded < BENCH_LOAD_COUNT; )
+        loaded += bench_MazeFileLoadDir(BENCH_MAZEFILE_DIR, benchCorpus,
+            BENCH_CORPUS_MAX);
+    elapsedUs = bench_NowUs() - start;
+
+    printf("%ux%u mazefile: %u mazes, %u of this size round trip; "
+        "%u loaded in %.1f ms, %.1f us per maze\n", ALGO_MAZE_WIDTH,
+        ALGO_MAZE_HEIGHT, count, sized, loaded, elapsedUs / 1000.0,
+        elapsedUs / loaded);
+    return 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/*                         Private (Static) Functions                         */
+/*----------------------------------------------------------------------------*/
+/**
+* Print the digest of every file, "-" for files that are not mazes
+*
+* \param[in] fileCount Files
+* \param[in] p_files   Paths of the files
+* \retval Exit status
+*/
+static int bench_PrintDigests(int fileCount, char** p_files)
+{
+    const char* p_name = NULL;
+    int file = 0;
+
+    for (file = 0; file < fileCount; file++)
+    {
+        p_name = strrchr(p_files[file], '/');
+        p_name = (p_name != NULL) ? p_name + 1 : p_files[file];
+        if (bench_MazeFileLoad(p_files[file], &benchCopy))
+        {
+            bench_MazeFileDigest(&benchCopy, benchDigest);
+            printf("%s %s\n", p_name, benchDigest);
+        }
+        else
+        {
+            printf("%s -\n", p_name);
+        }
+    }
+
+    return 0;
+}
+
+/**
+* Write competition mazes of this configuration as maze files
+*
+* \param[in] p_dir Directory to write to
+* \param[in] count Mazes
+* \retval Exit status
+*/
+static int bench_WriteCorpus(const char* p_dir, unsigned int count)
+{
+    char path[512];
+    FILE* p_file = NULL;
+    unsigned int maze = 0u;
+
+    for (maze = 0u; maze < count; maze++)
+    {
+        bench_GenerateCompetitionMaze(&benchMap, BENCH_RANDOM_SEED + maze);
+        bench_MazeFileFromMap(&benchMap, &benchCopy);
+
+        snprintf(path, sizeof(path), "%s/gen%ux%u_%03u.txt", p_dir,
+            ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, BENCH_RANDOM_SEED + maze);
+        p_file = fopen(path, "w");
+        if (p_file == NULL)
+        {
+            perror(path);
+            return 1;
+        }
+        bench_MazeFileWrite(p_file, &benchCopy);
+        fclose(p_file);
+    }
+
+    return 0;
+}
+
+/**
+* Whether two mazes have the same size and walls
+*
+* \param[in] p_a Maze
+* \param[in] p_b Maze
+* \retval TRUE if they match
+*/
+static bool bench_SameWalls(const bench_mazefile_t* p_a,
+    const bench_mazefile_t* p_b)
+{
+    unsigned int y = 0u;
+
+    if ((p_a->width != p_b->width) || (p_a->height != p_b->height))
+        return FALSE;
+    for (y = 0u; y < p_a->height; y++)
+        if (memcmp(p_a->walls[y], p_b->walls[y], p_a->width) != 0)
+            return FALSE;
+
+    return TRUE;
+}
+
+/**
+* Wall clock time, the bulk load waits on the disk as well as the CPU
+*
+* \param None
+* \retval Microseconds
+*/
+static double bench_NowUs(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((double)now.tv_sec * 1e6) + ((double)now.tv_nsec / 1e3);
+}
@@ -0,0 +1,468 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : mazestore_benchmark.c
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : host benchmark
+*
+* Runs the flash maze store, see algo/mazestore_algo.h, on the simulated
+* flash region of bench_flash.c. Every boot of the mouse is a child process,
+* so the store starts from nothing but what is in flash each time:
+*
+*   explore - reveal random mazes a cell at a time and save every
+*             BENCH_SAVE_INTERVAL cells the way algo.c does, rebooting
+*             before each save; every boot must restore the map saved last
+*   wear    - save BENCH_WEAR_SAVES different maps in a row and report how
+*             evenly the page erases are spread
+*   cut     - cut the power at every BENCH_CUT_STEP bytes of a save; the
+*             next boot must restore the map before it, and saving must
+*             carry on after it
+*
+* It reports the record and slot sizes, the flash time a save takes on the
+* target estimated from the datasheet page program and erase times, and the
+* host CPU time of a save and a restore, reading and checking the CRC.
+*
+* Built once per maze configuration w/ -DALGO_MAZE_CONFIG=n, see the
+* Makefile.
+*-----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "algo/algo.h"
+#include "algo/mazemap_algo.h"
+#include "algo/mazestore_algo.h"
+#include "algo/costmodel_algo.h"
+#include "bench_maze.h"
+#include "bench_flash.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+#define BENCH_MAZE_COUNT      (10u)
+#define BENCH_RANDOM_SEED     (31u)
+#define BENCH_SAVE_INTERVAL   (16u)     /* ALGO_MAZE_STORE_INTERVAL in algo.c */
+#define BENCH_WEAR_SAVES      (2000u)
+#define BENCH_CUT_STEP        (3u)      /* bytes */
+
+/* what a boot does, handed to the child and back in shared memory */
+typedef struct
+{
+    bool save;                  /* save map after restoring */
+    unsigned int saveCount;     /* saves, the map changes between them */
+    algo_maze_map_t map;        /* map to save */
+    uint16_t flags;             /* flags to save */
+
+    bool restored;              /* a map was restored */
+    algo_maze_map_t restoredMap;
+    uint16_t restoredFlags;
+    bool saved;                 /* every save worked */
+    uint32_t slotSize;
+    uint64_t restoreCycles;
+    uint64_t saveCycles;
+} bench_boot_t;
+
+typedef struct
+{
+    unsigned long long saves;
+    unsigned long long flashUs;     /* estimated target flash time */
+    unsigned long long saveCycles;
+    unsigned long long restores;
+    unsigned long long restoreCycles;
+    unsigned long long bytesRead;
+} bench_result_t;
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+static bench_boot_t* benchBoot = NULL;
+static algo_maze_map_t benchMaze;
+static algo_maze_map_t benchSaved;
+static uint16_t benchCells[ALGO_MAZE_CELL_COUNT];
+
+/*----------------------------------------------------------------------------*/
+/*                    Private (Static) Function Prototype                     */
+/*----------------------------------------------------------------------------*/
+static void bench_RunExplore(bench_result_t* p_result, uint32_t* p_recordSize);
+static void bench_RunWear(void);
+static void bench_RunPowerCut(uint32_t recordSize);
+static int bench_Boot(const algo_maze_map_t* p_save, uint16_t flags,
+    unsigned int saveCount);
+static void bench_BootChild(void);
+static void bench_ExpectRestored(const algo_maze_map_t* p_map, uint16_t flags,
+    const char* p_what);
+static void bench_RevealCell(algo_maze_map_t* p_map, unsigned int idx);
+
+/*----------------------------------------------------------------------------*/
+/*                                    Main                                    */
+/*----------------------------------------------------------------------------*/
+int main(void)
+{
+    bench_result_t result = { 0u };
+    uint32_t recordSize = 0u;
+
+    benchBoot = mmap(NULL, sizeof(*benchBoot), PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (benchBoot == MAP_FAILED)
+    {
+        perror("bench boot");
+        exit(1);
+    }
+
+    /* nothing saved yet */
+    bench_FlashInit();
+    bench_Boot(NULL, 0u, 0u);
+    if (benchBoot->restored)
+    {
+        printf("%ux%u store: restored a map from blank flash\n",
+            ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT);
+        exit(1);
+    }
+
+    bench_RunExplore(&result, &recordSize);
+    printf("%ux%u store record %4u bytes slot %4u bytes %3u slots "
+        "%6llu saves %5llu ms flash/save %7llu cycles/save "
+        "%7llu cycles/restore %5llu bytes read/boot\n",
+        ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, recordSize, benchBoot->slotSize,
+        (BENCH_FLASH_PAGE_SIZE * (BENCH_FLASH_PAGE_COUNT
+            - algo_CostModelGetStorePages(BENCH_FLASH_PAGE_SIZE)))
+            / benchBoot->slotSize,
+        result.saves, result.flashUs / (1000u * result.saves),
+        result.saveCycles / result.saves,
+        result.restoreCycles / result.restores,
+        result.bytesRead / BENCH_MAZE_COUNT);
+
+    bench_RunWear();
+    bench_RunPowerCut(recordSize);
+
+    return 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/*                         Private (Static) Functions                         */
+/*----------------------------------------------------------------------------*/
+/**
+* Reveal random mazes a cell at a time, rebooting and saving every
+* BENCH_SAVE_INTERVAL cells, then once more w/ the explored flag
+*
+* \param[out] p_result     Save and restore totals
+* \param[out] p_recordSize Bytes written by a save
+* \retval None
+*/
+static void bench_RunExplore(bench_result_t* p_result, uint32_t* p_recordSize)
+{
+    bench_flash_stats_t before;
+    algo_maze_map_t map;
+    uint16_t savedFlags = 0u;
+    uint16_t flags = 0u;
+    bool hasSaved = FALSE;
+    unsigned int seed = 0u;
+    unsigned int i = 0u;
+    unsigned int j = 0u;
+    uint16_t swap = 0u;
+
+    for (seed = 0u; seed < BENCH_MAZE_COUNT; seed++)
+    {
+        bench_GenerateMaze(&benchMaze, BENCH_RANDOM_SEED + seed);
+        bench_FlashInit();
+        algo_MazeMapClear(&map);
+        hasSaved = FALSE;
+
+        for (i = 0u; i < ALGO_MAZE_CELL_COUNT; i++)
+            benchCells[i] = (uint16_t)i;
+        for (i = ALGO_MAZE_CELL_COUNT - 1u; i > 0u; i--)
+        {
+            j = (unsigned int)rand() % (i + 1u);
+            swap = benchCells[i];
+            benchCells[i] = benchCells[j];
+            benchCells[j] = swap;
+        }
+
+        for (i = 0u; i < ALGO_MAZE_CELL_COUNT; i++)
+        {
+            bench_RevealCell(&map, benchCells[i]);
+            if (((i + 1u) % BENCH_SAVE_INTERVAL != 0u)
+                && (i + 1u != ALGO_MAZE_CELL_COUNT))
+                continue;
+
+            flags = (i + 1u == ALGO_MAZE_CELL_COUNT)
+                ? ALGO_MAZESTORE_FLAG_EXPLORED : 0u;
+            before = *bench_FlashGetStats();
+            bench_Boot(&map, flags, 1u);
+            if (hasSaved)
+                bench_ExpectRestored(&benchSaved, savedFlags, "explore");
+            else if (benchBoot->restored)
+            {
+                printf("%ux%u store explore: restored a map before saving\n",
+                    ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT);
+                exit(1);
+            }
+            if (!benchBoot->saved)
+            {
+                printf("%ux%u store explore: save failed on maze %u\n",
+                    ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, seed);
+                exit(1);
+            }
+
+            *p_recordSize = (uint32_t)(bench_FlashGetStats()->bytesWritten
+                - before.bytesWritten);
+            p_result->saves++;
+            p_result->flashUs += bench_FlashEstimateUs(&before);
+            p_result->saveCycles += benchBoot->saveCycles;
+            p_result->restores++;
+            p_result->restoreCycles += benchBoot->restoreCycles;
+
+            benchSaved = map;
+            savedFlags = flags;
+            hasSaved = TRUE;
+        }
+
+        /* restore what was saved last, saving it again writes nothing */
+        before = *bench_FlashGetStats();
+        bench_Boot(&benchSaved, savedFlags, 1u);
+        bench_ExpectRestored(&benchSaved, savedFlags, "explore");
+        if (!benchBoot->saved
+            || bench_FlashGetStats()->bytesWritten != before.bytesWritten
+            || bench_FlashEstimateUs(&before) != 0u)
+        {
+            printf("%ux%u store explore: saving an unchanged map wrote flash\n",
+                ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT);
+            exit(1);
+        }
+        p_result->bytesRead += bench_FlashGetStats()->bytesRead
+            - before.bytesRead;
+    }
+}
+
+/**
+* Save many different maps in a row and report the page erases
+*
+* \param None
+* \retval None
+*/
+static void bench_RunWear(void)
+{
+    const bench_flash_stats_t* p_stats = NULL;
+    uint32_t minErases = UINT32_MAX;
+    uint32_t maxErases = 0u;
+    unsigned int page = 0u;
+    /* the last pages hold the cost model, the ring stops short of them */
+    uint32_t ringBytes = BENCH_FLASH_PAGE_SIZE * (BENCH_FLASH_PAGE_COUNT
+        - algo_CostModelGetStorePages(BENCH_FLASH_PAGE_SIZE));
+    unsigned int ringPages = 0u;
+
+    bench_GenerateMaze(&benchMaze, BENCH_RANDOM_SEED);
+    bench_FlashInit();
+    bench_Boot(&benchMaze, 0u, BENCH_WEAR_SAVES);
+    if (!benchBoot->saved)
+    {
+        printf("%ux%u store wear: save failed\n",
+            ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT);
+        exit(1);
+    }
+
+    /* and short of a page left over after its last whole slot */
+    ringBytes -= ringBytes % benchBoot->slotSize;
+    ringPages = (ringBytes + BENCH_FLASH_PAGE_SIZE - 1u)
+        / BENCH_FLASH_PAGE_SIZE;
+
+    p_stats = bench_FlashGetStats();
+    for (page = 0u; page < ringPages; page++)
+    {
+        if (p_stats->erases[page] < minErases)
+            minErases = p_stats->erases[page];
+        if (p_stats->erases[page] > maxErases)
+            maxErases = p_stats->erases[page];
+    }
+
+    /* the ring wraps page by page, no page may get ahead by more than one */
+    if (maxErases - minErases > 1u)
+    {
+        printf("%ux%u store wear: page erases from %u to %u\n",
+            ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, minErases, maxErases);
+        exit(1);
+    }
+
+    printf("%ux%u store wear %u saves %5u to %5u erases/page "
+        "%5.1f saves/erase\n", ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT,
+        BENCH_WEAR_SAVES, minErases, maxErases,
+        (double)BENCH_WEAR_SAVES / ((double)maxErases * ringPages));
+}
+
+/**
+* Cut the power part way through a save at every BENCH_CUT_STEP bytes
+*
+* \param[in] recordSize Bytes written by a save
+* \retval None
+*/
+static void bench_RunPowerCut(uint32_t recordSize)
+{
+    static algo_maze_map_t before;
+    static algo_maze_map_t after;
+    unsigned int cuts = 0u;
+    uint32_t cut = 0u;
+    int status = 0;
+
+    bench_GenerateMaze(&benchMaze, BENCH_RANDOM_SEED + 1u);
+
+    for (cut = 0u; cut < recordSize; cut += BENCH_CUT_STEP)
+    {
+        before = benchMaze;
+        before.visited[0] ^= ALGO_MAZE_ROW_BIT(0u);
+        after = benchMaze;
+        after.visited[1] ^= ALGO_MAZE_ROW_BIT(0u);
+
+        /* land the cut on a different slot of the ring each time */
+        bench_FlashInit();
+        bench_Boot(&benchMaze, 0u, 1u + cuts % 11u);
+        bench_Boot(&before, 0u, 1u);
+
+        bench_FlashCutPowerAfter((int64_t)cut);
+        status = bench_Boot(&benchMaze, ALGO_MAZESTORE_FLAG_EXPLORED, 1u);
+        bench_FlashCutPowerAfter(-1);
+        if (status != BENCH_FLASH_POWER_CUT_EXIT)
+        {
+            printf("%ux%u store cut: power cut after %u bytes missed the save\n",
+                ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, cut);
+            exit(1);
+        }
+
+        /* the half written record is dropped, saving carries on past it */
+        bench_Boot(&after, 0u, 1u);
+        bench_ExpectRestored(&before, 0u, "cut");
+        if (!benchBoot->saved)
+        {
+            printf("%ux%u store cut: save after a cut at %u bytes failed\n",
+                ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, cut);
+            exit(1);
+        }
+        bench_Boot(NULL, 0u, 0u);
+        bench_ExpectRestored(&after, 0u, "cut");
+        cuts++;
+    }
+
+    printf("%ux%u store cut %u power cuts all recovered\n",
+        ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, cuts);
+}
+
+/**
+* Boot the mouse in a child process: restore, then save if asked to
+*
+* \param[in] p_save    Map to save, NULL to only restore
+* \param[in] flags     Flags to save
+* \param[in] saveCount Saves, each after the first w/ a different map
+* \retval Exit status of the child
+*/
+static int bench_Boot(const algo_maze_map_t* p_save, uint16_t flags,
+    unsigned int saveCount)
+{
+    pid_t child = 0;
+    int status = 0;
+
+    benchBoot->save = (p_save != NULL);
+    if (p_save != NULL)
+        benchBoot->map = *p_save;
+    benchBoot->flags = flags;
+    benchBoot->saveCount = saveCount;
+
+    fflush(stdout);
+    child = fork();
+    if (child < 0)
+    {
+        perror("bench boot");
+        exit(1);
+    }
+    if (child == 0)
+    {
+        bench_BootChild();
+        _exit(0);
+    }
+
+    if (waitpid(child, &status, 0) < 0 || !WIFEXITED(status))
+    {
+        printf("%ux%u store: boot did not exit\n",
+            ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT);
+        exit(1);
+    }
+
+    return WEXITSTATUS(status);
+}
+
+/**
+* What a boot runs in the child, the store has not been used yet
+*
+* \param None
+* \retval None
+*/
+static void bench_BootChild(void)
+{
+    uint64_t start = 0u;
+    unsigned int i = 0u;
+
+    start = bench_Now();
+    benchBoot->restored = algo_MazeStoreRestore(&benchBoot->restoredMap,
+        &benchBoot->restoredFlags);
+    benchBoot->restoreCycles = bench_Now() - start;
+    benchBoot->slotSize = algo_MazeStoreGetSlotSize();
+
+    benchBoot->saved = TRUE;
+    if (!benchBoot->save)
+        return;
+
+    for (i = 0u; i < benchBoot->saveCount; i++)
+    {
+        if (i > 0u)
+            benchBoot->map.visited[i % ALGO_MAZE_HEIGHT] ^=
+                ALGO_MAZE_ROW_BIT((i / ALGO_MAZE_HEIGHT) % ALGO_MAZE_WIDTH);
+        start = bench_Now();
+        if (!algo_MazeStoreSave(&benchBoot->map, benchBoot->flags))
+            benchBoot->saved = FALSE;
+        benchBoot->saveCycles = bench_Now() - start;
+    }
+}
+
+/**
+* Stop the benchmark unless the last boot restored the given map
+*
+* \param[in] p_map  Map expected
+* \param[in] flags  Flags expected
+* \param[in] p_what Test name for the error
+* \retval None
+*/
+static void bench_ExpectRestored(const algo_maze_map_t* p_map, uint16_t flags,
+    const char* p_what)
+{
+    if (!benchBoot->restored
+        || memcmp(&benchBoot->restoredMap, p_map, sizeof(*p_map)) != 0
+        || benchBoot->restoredFlags != flags)
+    {
+        printf("%ux%u store %s: boot did not restore the last saved map\n",
+            ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, p_what);
+        exit(1);
+    }
+}
+
+/**
+* Copy the walls of a cell from the maze and mark it visited
+*
+* \param[in,out] p_map Map being explored
+* \param[in]     idx   Cell index
+* \retval None
+*/
+static void bench_RevealCell(algo_maze_map_t* p_map, unsigned int idx)
+{
+    MazeCell walls;
+    unsigned int x = ALGO_MAZE_IDX_X(idx);
+    unsigned int y = ALGO_MAZE_IDX_Y(idx);
+
+    algo_MazeMapGetCellWalls(&benchMaze, x, y, &walls);
+    algo_MazeMapSetCellWalls(p_map, x, y, &walls);
+    algo_MazeMapSetVisited(p_map, x, y);
+}
@@ -0,0 +1,296 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : odometry_benchmark.c
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : host benchmark
+*
+* Runs the pose of mouse_control_interface/odometry_mci.c at the control
+* loop rate through the wheel edges of moves the mouse makes: a loop of
+* four squares and turns in place, a square w/ a search turn arc in the
+* middle, 16 squares straight, and a diagonal off a 45 degree turn. The
+* edge counts start just short of wrapping, as the encoders are never
+* cleared.
+*
+* Prints one CSV line per path:
+*   ticks      - control ticks the path takes
+*   x_mm       - pose at the end
+*   y_mm
+*   heading    - degrees clockwise
+*   err_mm     - off the same edges integrated in floating point
+*   err_deg
+*   target_mm  - off the maze position the moves aim for, the edges are
+*                whole and calibrated, so this is how far the moves miss
+*   cyc_update - host CPU cycles per update
+* Every path has to end w/in BENCH_MAX_ERR_MM and BENCH_MAX_ERR_DEG of the
+* floating point pose.
+*
+* Built once per maze configuration w/ -DALGO_MAZE_CONFIG=n, see the
+* Makefile, the pose does not depend on it.
+*-----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "algo/algo.h"
+#include "micromouse_dimensions.h"
+#include "mouse_hardware_interface/interrupts_mhi.h"
+#include "mouse_control_interface/walldetection_mci.h"
+#include "mouse_control_interface/movement_mci.h"
+#include "mouse_control_interface/odometry_mci.h"
+#include "bench_maze.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+#define BENCH_RATE_HZ           (1000u)
+#define BENCH_SQUARE_MM         (MCI_MAZE_WALL_LENGTH_MM + MCI_MAZE_PILLAR_WIDTH_MM)
+/* edges per second of each wheel, about 400 mm/s */
+#define BENCH_EDGES_PER_S       (160)
+/* the edge counts start this far short of wrapping */
+#define BENCH_WRAP_EDGES        (300u)
+#define BENCH_MAX_ERR_MM        (1.0)
+#define BENCH_MAX_ERR_DEG       (0.1)
+#define BENCH_MAX_MOVES         (8u)
+
+/* wheel edges of a square, a half square and the turns, as movement_mci.c */
+/* drives them */
+#define BENCH_SQUARE_EDGES      (MCI_WHEEL_MOTOR_EDGES_PER_MAZE_SQUARE)
+#define BENCH_HALF_EDGES        (MCI_MM_TO_EDGES(BENCH_SQUARE_MM / 2))
+#define BENCH_TURN_EDGES        (MCI_WHEEL_MOTOR_EDGES_PER_90_DEGREE_TURN_RIGHT_PID)
+#define BENCH_ARC_EDGES         (MCI_MM_TO_EDGES(MCI_SEARCH_TURN_ARC_MM) * 2)
+#define BENCH_ARC_APART \
+    ((int32_t)(((int64_t)BENCH_ARC_EDGES * MCI_SEARCH_TURN_CURVATURE_Q16) >> 17))
+#define BENCH_DIAGONAL_EDGES    (MCI_WHEEL_MOTOR_EDGES_PER_DIAGONAL_HALF_STEP * 2)
+
+/* edges each wheel drives in one move */
+typedef struct
+{
+    int32_t left;
+    int32_t right;
+} bench_odometry_move_t;
+
+/* moves from the centre of a square facing ahead, and where they go to */
+typedef struct
+{
+    const char* p_name;
+    bench_odometry_move_t moves[BENCH_MAX_MOVES];
+    unsigned int moveCount;
+    double targetXMm;
+    double targetYMm;
+} bench_odometry_path_t;
+
+/* the same edges integrated in floating point */
+typedef struct
+{
+    double xMm;
+    double yMm;
+    double heading;         /* radians clockwise */
+} bench_odometry_pose_t;
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+static const bench_odometry_path_t benchPaths[] =
+{
+    {
+        "square_loop",
+        {
+            { BENCH_SQUARE_EDGES, BENCH_SQUARE_EDGES },
+            { BENCH_TURN_EDGES, -BENCH_TURN_EDGES },
+            { BENCH_SQUARE_EDGES, BENCH_SQUARE_EDGES },
+            { BENCH_TURN_EDGES, -BENCH_TURN_EDGES },
+            { BENCH_SQUARE_EDGES, BENCH_SQUARE_EDGES },
+            { BENCH_TURN_EDGES, -BENCH_TURN_EDGES },
+            { BENCH_SQUARE_EDGES, BENCH_SQUARE_EDGES },
+            { BENCH_TURN_EDGES, -BENCH_TURN_EDGES },
+        },
+        8u, 0.0, 0.0,
+    },
+    {
+        "search_turn",
+        {
+            { BENCH_HALF_EDGES, BENCH_HALF_EDGES },
+            { (BENCH_ARC_EDGES / 2) + BENCH_ARC_APART,
+              (BENCH_ARC_EDGES / 2) - BENCH_ARC_APART },
+            { BENCH_HALF_EDGES, BENCH_HALF_EDGES },
+        },
+        3u, BENCH_SQUARE_MM, BENCH_SQUARE_MM,
+    },
+    {
+        "straight_16",
+        {
+            { 16 * BENCH_SQUARE_EDGES, 16 * BENCH_SQUARE_EDGES },
+        },
+        1u, 0.0, 16.0 * BENCH_SQUARE_MM,
+    },
+    {
+        "diagonal",
+        {
+            { BENCH_HALF_EDGES, BENCH_HALF_EDGES },
+            { BENCH_TURN_EDGES / 2, -(BENCH_TURN_EDGES / 2) },
+            { BENCH_DIAGONAL_EDGES, BENCH_DIAGONAL_EDGES },
+        },
+        3u, BENCH_SQUARE_MM, 1.5 * BENCH_SQUARE_MM,
+    },
+};
+
+/*----------------------------------------------------------------------------*/
+/*                    Private (Static) Function Prototype                     */
+/*----------------------------------------------------------------------------*/
+static bool bench_RunPath(const bench_odometry_path_t* p_path);
+static void bench_StepPose(bench_odometry_pose_t* p_pose, int32_t left,
+    int32_t right);
+static double bench_HeadingDeg(uint32_t heading);
+
+/*----------------------------------------------------------------------------*/
+/*                                    Main                                    */
+/*----------------------------------------------------------------------------*/
+int main(void)
+{
+    unsigned int i = 0u;
+
+    printf("config,path,ticks,x_mm,y_mm,heading,err_mm,err_deg,target_mm,"
+        "cyc_update\n");
+
+    for (i = 0u; i < sizeof(benchPaths) / sizeof(benchPaths[0]); i++)
+        if (!bench_RunPath(&benchPaths[i]))
+            return 1;
+
+    return 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/*                        Stand-ins for the mhi layer                         */
+/*----------------------------------------------------------------------------*/
+/* the host has no control tick to hold off */
+void mhi_DisableGlobalInterrupts(void)
+{
+}
+
+void mhi_EnableGlobalInterrupts(void)
+{
+}
+
+/*----------------------------------------------------------------------------*/
+/*                         Private (Static) Functions                         */
+/*----------------------------------------------------------------------------*/
+/**
+* Drive the wheels through a path a tick at a time, each move at
+* BENCH_EDGES_PER_S on the wheel w/ further to go
+*
+* \param[in] p_path Path to drive
+* \retval TRUE if the pose kept to the floating point one
+*/
+static bool bench_RunPath(const bench_odometry_path_t* p_path)
+{
+    bench_odometry_pose_t reference = { 0.0, 0.0, 0.0 };
+    mci_pose_t pose;
+    uint32_t encoder1 = 0u - BENCH_WRAP_EDGES;
+    uint32_t encoder2 = 0u - BENCH_WRAP_EDGES;
+    uint32_t ticks = 0u;
+    uint64_t cycles = 0u;
+    uint64_t start = 0u;
+    int32_t moveTicks = 0;
+    int32_t left = 0;
+    int32_t right = 0;
+    int32_t tick = 0;
+    double errMm = 0.0;
+    double errDeg = 0.0;
+    double targetMm = 0.0;
+    unsigned int i = 0u;
+
+    mci_InitOdometry(encoder1, encoder2);
+
+    for (i = 0u; i < p_path->moveCount; i++)
+    {
+        moveTicks = (abs(p_path->moves[i].left) > abs(p_path->moves[i].right))
+            ? abs(p_path->moves[i].left) : abs(p_path->moves[i].right);
+        moveTicks = (moveTicks * (int32_t)BENCH_RATE_HZ) / BENCH_EDGES_PER_S;
+
+        for (tick = 1; tick <= moveTicks; tick++)
+        {
+            /* edges of the wheels so far into the move, whole ones only */
+            left = (p_path->moves[i].left * tick) / moveTicks
+                - (p_path->moves[i].left * (tick - 1)) / moveTicks;
+            right = (p_path->moves[i].right * tick) / moveTicks
+                - (p_path->moves[i].right * (tick - 1)) / moveTicks;
+            encoder1 += (uint32_t)left;
+            encoder2 += (uint32_t)right;
+
+            start = bench_Now();
+            mci_UpdateOdometry(encoder1, encoder2);
+            cycles += bench_Now() - start;
+            ticks++;
+
+            bench_StepPose(&reference, left, right);
+        }
+    }
+
+    mci_GetPose(&pose);
+    errMm = hypot((pose.xUm / 1000.0) - reference.xMm,
+        (pose.yUm / 1000.0) - reference.yMm);
+    errDeg = remainder(bench_HeadingDeg(pose.heading)
+        - (reference.heading * 180.0 / M_PI), 360.0);
+    targetMm = hypot((pose.xUm / 1000.0) - p_path->targetXMm,
+        (pose.yUm / 1000.0) - p_path->targetYMm);
+
+    printf("%ux%u,%s,%u,%.1f,%.1f,%.2f,%.3f,%.4f,%.1f,%.0f\n",
+        ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, p_path->p_name,
+        (unsigned int)ticks, pose.xUm / 1000.0, pose.yUm / 1000.0,
+        bench_HeadingDeg(pose.heading), errMm, errDeg, targetMm,
+        (double)cycles / ticks);
+
+    if ((errMm > BENCH_MAX_ERR_MM) || (fabs(errDeg) > BENCH_MAX_ERR_DEG))
+    {
+        printf("%ux%u odometry: %s is off the floating point pose\n",
+            ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, p_path->p_name);
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+* Move the floating point pose on by a tick's edges, along the arc the
+* wheels drive, w/ the exact calibration the fixed point one rounds
+*
+* \param[in,out] p_pose Pose
+* \param[in]     left   Left wheel edges
+* \param[in]     right  Right wheel edges
+* \retval None
+*/
+static void bench_StepPose(bench_odometry_pose_t* p_pose, int32_t left,
+    int32_t right)
+{
+    const double mmPerEdge = (double)BENCH_SQUARE_MM
+        / MCI_WHEEL_MOTOR_EDGES_PER_MAZE_SQUARE;
+    const double trackMm = (4.0 * MCI_WHEEL_MOTOR_EDGES_PER_90_DEGREE_TURN_RIGHT_PID
+        * mmPerEdge) / M_PI;
+    double distance = ((left + right) * mmPerEdge) / 2.0;
+    double turn = ((left - right) * mmPerEdge) / trackMm;
+    double chord = distance;
+
+    if (turn != 0.0)
+        chord = (2.0 * distance / turn) * sin(turn / 2.0);
+
+    p_pose->xMm += chord * sin(p_pose->heading + (turn / 2.0));
+    p_pose->yMm += chord * cos(p_pose->heading + (turn / 2.0));
+    p_pose->heading += turn;
+}
+
+/**
+* Binary heading in degrees, -180 to 180
+*
+* \param[in] heading 2^32 to the turn
+* \retval Degrees clockwise
+*/
+static double bench_HeadingDeg(uint32_t heading)
+{
+    return (double)(int32_t)heading * (360.0 / 4294967296.0);
+}
@@ -0,0 +1,323 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : profile_benchmark.c
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : host benchmark
+*
+* Steps the motion profiles of mouse_control_interface/profile_mci.c at the
+* control loop rate, in mm, through moves the mouse makes: single squares,
+* long straights, trapezoids and S-curves, a move too short to get up to
+* speed and a chain of squares that never stops in between. Then a turn
+* into the square at the side while exploring, both ways the moves of
+* mouse_control_interface/movement_mci.c drive it, w/ their limits: a
+* square, a turn in place, the wait after it and a square, all stopping in
+* between, or a half square up to the forward speed, a search turn arc and
+* a half square to rest.
+*
+* Prints one CSV line per move:
+*   time_ms    - steps the profile takes, at BENCH_RATE_HZ
+*   ideal_ms   - time of the ideal trapezoid w/o jerk
+*   max_v      - highest velocity setpoint, mm/s
+*   max_a      - highest acceleration setpoint, mm/s^2
+*   end_v      - velocity at the end, mm/s
+* Every move has to end on its distance at its end velocity w/o going over
+* its max velocity or acceleration, and the chained squares have to beat
+* the same squares stopped in between, and the search turn the turn in
+* place. Settling at rest after a move is not in the times, so the turn in
+* place loses another two settles on top.
+*
+* Built once per maze configuration w/ -DALGO_MAZE_CONFIG=n, see the
+* Makefile, the profiles do not depend on it.
+*-----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "algo/algo.h"
+#include "micromouse_dimensions.h"
+#include "mouse_control_interface/profile_mci.h"
+#include "mouse_control_interface/control_mci.h"
+#include "mouse_control_interface/walldetection_mci.h"
+#include "mouse_control_interface/movement_mci.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+#define BENCH_RATE_HZ           (1000u)
+#define BENCH_SQUARE_MM         (192)
+#define BENCH_CHAIN_SQUARES     (4)
+/* setpoints are integer, allow for rounding */
+#define BENCH_VELOCITY_SLACK    (1)
+#define BENCH_ACCEL_SLACK       (1.02)
+
+/* mm/s of a PWM, as mci_ControlSpeedToVelocity() works it out in edges */
+#define BENCH_SPEED_MM_S(speed) \
+    (((((speed) - MCI_CONTROL_SPEED_OFFSET) * 256) \
+    / MCI_CONTROL_VELOCITY_FF_Q8) * BENCH_SQUARE_MM \
+    / MCI_WHEEL_MOTOR_EDGES_PER_MAZE_SQUARE)
+/* wheel travel of the turn in place */
+#define BENCH_TURN_MM \
+    ((MCI_WHEEL_MOTOR_EDGES_PER_90_DEGREE_TURN_RIGHT_PID * BENCH_SQUARE_MM) \
+    / MCI_WHEEL_MOTOR_EDGES_PER_MAZE_SQUARE)
+/* algo.c waited this long after the turn in place */
+#define BENCH_TURN_WAIT_MS      (100u)
+
+typedef struct
+{
+    const char* p_name;
+    mci_profile_params_t params;
+} bench_profile_case_t;
+
+typedef struct
+{
+    uint32_t steps;
+    int32_t maxVelocity;
+    double maxAcceleration;
+    int32_t endVelocity;
+    int32_t endPosition;
+} bench_profile_result_t;
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+static const bench_profile_case_t benchCases[] =
+{
+    { "square_trapezoid", { BENCH_SQUARE_MM, 400, 2000, 0, 0, 0 } },
+    { "square_scurve", { BENCH_SQUARE_MM, 400, 2000, 40000, 0, 0 } },
+    { "straight_16", { 16 * BENCH_SQUARE_MM, 1500, 3000, 60000, 0, 0 } },
+    { "too_short", { 20, 1500, 3000, 60000, 0, 0 } },
+    { "onto_turn", { BENCH_SQUARE_MM, 800, 3000, 60000, 0, 300 } },
+    { "off_turn", { BENCH_SQUARE_MM, 800, 3000, 60000, 300, 0 } },
+};
+
+/*----------------------------------------------------------------------------*/
+/*                    Private (Static) Function Prototype                     */
+/*----------------------------------------------------------------------------*/
+static bool bench_RunProfile(const char* p_name,
+    const mci_profile_params_t* p_params, bench_profile_result_t* p_result);
+static double bench_IdealMs(const mci_profile_params_t* p_params);
+static bool bench_RunSearchTurn(void);
+
+/*----------------------------------------------------------------------------*/
+/*                                    Main                                    */
+/*----------------------------------------------------------------------------*/
+int main(void)
+{
+    bench_profile_result_t result;
+    mci_profile_params_t params;
+    uint32_t chainedSteps = 0u;
+    uint32_t stoppedSteps = 0u;
+    int32_t velocity = 0;
+    unsigned int i = 0u;
+
+    printf("config,move,time_ms,ideal_ms,max_v,max_a,end_v\n");
+
+    for (i = 0u; i < sizeof(benchCases) / sizeof(benchCases[0]); i++)
+        if (!bench_RunProfile(benchCases[i].p_name, &benchCases[i].params,
+            &result))
+            return 1;
+
+    /* squares back to back, the velocity carried from one to the next */
+    params = benchCases[1].params;
+    for (i = 0u; i < BENCH_CHAIN_SQUARES; i++)
+    {
+        params.startVelocity = velocity;
+        params.endVelocity = (i + 1u < BENCH_CHAIN_SQUARES)
+            ? params.maxVelocity : 0;
+        if (!bench_RunProfile("chained_square", &params, &result))
+            return 1;
+        chainedSteps += result.steps;
+        velocity = result.endVelocity;
+    }
+    stoppedSteps = BENCH_CHAIN_SQUARES
+        * mci_ProfileGetSteps(&benchCases[1].params, BENCH_RATE_HZ);
+
+    printf("%ux%u profile: %d squares chained %u ms, stopped in between "
+        "%u ms\n", ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, BENCH_CHAIN_SQUARES,
+        (unsigned int)((chainedSteps * 1000u) / BENCH_RATE_HZ),
+        (unsigned int)((stoppedSteps * 1000u) / BENCH_RATE_HZ));
+    if (chainedSteps >= stoppedSteps)
+    {
+        printf("%ux%u profile: chaining is no faster\n",
+            ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT);
+        return 1;
+    }
+
+    if (!bench_RunSearchTurn())
+        return 1;
+
+    return 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/*                         Private (Static) Functions                         */
+/*----------------------------------------------------------------------------*/
+/**
+* Step a profile to its end, checking every setpoint on the way
+*
+* \param[in]  p_name   Move to print
+* \param[in]  p_params Move to profile
+* \param[out] p_result What the profile did
+* \retval TRUE if it kept to its limits and ended where it should
+*/
+static bool bench_RunProfile(const char* p_name,
+    const mci_profile_params_t* p_params, bench_profile_result_t* p_result)
+{
+    mci_profile_t profile;
+    int32_t prevVelocity = p_params->startVelocity;
+    int32_t velocity = 0;
+    double acceleration = 0.0;
+
+    p_result->steps = 0u;
+    p_result->maxVelocity = 0;
+    p_result->maxAcceleration = 0.0;
+
+    mci_ProfileStart(&profile, p_params, BENCH_RATE_HZ);
+    while (!mci_ProfileIsDone(&profile) && (p_result->steps < 60u * BENCH_RATE_HZ))
+    {
+        mci_ProfileStep(&profile);
+        p_result->steps++;
+
+        velocity = mci_ProfileGetVelocity(&profile);
+        acceleration = fabs((double)(velocity - prevVelocity)) * BENCH_RATE_HZ;
+        prevVelocity = velocity;
+        if (velocity > p_result->maxVelocity)
+            p_result->maxVelocity = velocity;
+        /* the last step snaps to the end velocity */
+        if (!mci_ProfileIsDone(&profile)
+            && (acceleration > p_result->maxAcceleration))
+            p_result->maxAcceleration = acceleration;
+    }
+    p_result->endVelocity = mci_ProfileGetVelocity(&profile);
+    p_result->endPosition = mci_ProfileGetPosition(&profile);
+
+    printf("%ux%u,%s,%u,%.0f,%d,%.0f,%d\n", ALGO_MAZE_WIDTH,
+        ALGO_MAZE_HEIGHT, p_name,
+        (unsigned int)((p_result->steps * 1000u) / BENCH_RATE_HZ),
+        bench_IdealMs(p_params), (int)p_result->maxVelocity,
+        p_result->maxAcceleration, (int)p_result->endVelocity);
+
+    if (!mci_ProfileIsDone(&profile)
+        || (p_result->endPosition != p_params->distance))
+    {
+        printf("%ux%u profile: %s ended at %d of %d\n", ALGO_MAZE_WIDTH,
+            ALGO_MAZE_HEIGHT, p_name, (int)p_result->endPosition,
+            (int)p_params->distance);
+        return FALSE;
+    }
+    if ((p_result->maxVelocity > p_params->maxVelocity + BENCH_VELOCITY_SLACK)
+        || (p_result->maxAcceleration
+        > p_params->acceleration * BENCH_ACCEL_SLACK))
+    {
+        printf("%ux%u profile: %s over its limits\n", ALGO_MAZE_WIDTH,
+            ALGO_MAZE_HEIGHT, p_name);
+        return FALSE;
+    }
+    if (p_result->endVelocity > p_params->endVelocity)
+    {
+        printf("%ux%u profile: %s ended too fast, %d for %d\n",
+            ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, p_name,
+            (int)p_result->endVelocity, (int)p_params->endVelocity);
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+* Turn into the square at the side, stopping to turn in place and as a
+* search turn, and print what the search turn saves
+*
+* \param None
+* \retval TRUE if both kept to their limits and the search turn is faster
+*/
+static bool bench_RunSearchTurn(void)
+{
+    const int32_t forward = BENCH_SPEED_MM_S(MCI_FORWARD_FAST_SPEED);
+    const mci_profile_params_t square =
+    {
+        BENCH_SQUARE_MM, forward, MCI_MOVE_ACCELERATION_MM_S2,
+        MCI_MOVE_JERK_MM_S3, 0, 0
+    };
+    const mci_profile_params_t turn =
+    {
+        BENCH_TURN_MM, BENCH_SPEED_MM_S(MCI_TURN_SPEED),
+        MCI_TURN_ACCELERATION_MM_S2, MCI_TURN_JERK_MM_S3, 0, 0
+    };
+    mci_profile_params_t params = square;
+    bench_profile_result_t result;
+    uint32_t stopMs = 0u;
+    uint32_t arcMs = 0u;
+
+    /* turn in place between two squares */
+    if (!bench_RunProfile("stop_square", &square, &result))
+        return FALSE;
+    stopMs += (2u * result.steps * 1000u) / BENCH_RATE_HZ;
+    if (!bench_RunProfile("stop_turn", &turn, &result))
+        return FALSE;
+    stopMs += ((result.steps * 1000u) / BENCH_RATE_HZ) + BENCH_TURN_WAIT_MS;
+
+    /* the arc at the forward speed, the half squares either side of it */
+    params.distance = BENCH_SQUARE_MM / 2;
+    params.endVelocity = forward;
+    if (!bench_RunProfile("arc_in", &params, &result))
+        return FALSE;
+    arcMs += (result.steps * 1000u) / BENCH_RATE_HZ;
+    params.distance = MCI_SEARCH_TURN_ARC_MM;
+    params.startVelocity = result.endVelocity;
+    if (!bench_RunProfile("arc", &params, &result))
+        return FALSE;
+    arcMs += (result.steps * 1000u) / BENCH_RATE_HZ;
+    params.distance = BENCH_SQUARE_MM / 2;
+    params.startVelocity = result.endVelocity;
+    params.endVelocity = 0;
+    if (!bench_RunProfile("arc_out", &params, &result))
+        return FALSE;
+    arcMs += (result.steps * 1000u) / BENCH_RATE_HZ;
+
+    printf("%ux%u profile: turn into the side square stopping %u ms, "
+        "search turn %u ms, %d ms saved per turn\n", ALGO_MAZE_WIDTH,
+        ALGO_MAZE_HEIGHT, (unsigned int)stopMs, (unsigned int)arcMs,
+        (int)stopMs - (int)arcMs);
+    if (arcMs >= stopMs)
+    {
+        printf("%ux%u profile: the search turn is no faster\n",
+            ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT);
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+* Time of the ideal trapezoid of a move, no jerk and no creeping
+*
+* \param[in] p_params Move
+* \retval ms
+*/
+static double bench_IdealMs(const mci_profile_params_t* p_params)
+{
+    double d = p_params->distance;
+    double v = p_params->maxVelocity;
+    double a = p_params->acceleration;
+    double v0 = p_params->startVelocity;
+    double v1 = p_params->endVelocity;
+    double accelD = ((v * v) - (v0 * v0)) / (2.0 * a);
+    double brakeD = ((v * v) - (v1 * v1)) / (2.0 * a);
+
+    /* never gets to the max velocity, peaks where the two meet */
+    if (accelD + brakeD > d)
+    {
+        v = sqrt((2.0 * a * d + (v0 * v0) + (v1 * v1)) / 2.0);
+        return 1000.0 * (((v - v0) / a) + ((v - v1) / a));
+    }
+
+    return 1000.0 * (((v - v0) / a) + ((v - v1) / a)
+        + ((d - accelD - brakeD) / v));
+}
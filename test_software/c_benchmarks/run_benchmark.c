@@ -0,0 +1,172 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : run_benchmark.c
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : host benchmark
+*
+* Runs whole competition runs w/ the run manager of algo/runmanager_algo.h
+* on the virtual mouse of bench_mouse.c, over the competition mazes of
+* solver_benchmark.c: explore from a blank map, drive back, then speed runs
+* until the time limit, w/ the competition clock on the estimated drive
+* time.
+*
+* Each maze is run twice, once as is and once w/ the mouse slipping on some
+* drive calls at the faster speed profiles. A slip or a crash is reported to
+* the run manager as lost, and the benchmark plays the operator: it puts
+* the mouse back in the start cell and presses the config button.
+*
+* Prints one CSV line per maze and pass:
+*   slip        - drive calls slipping per mille at BENCH_SLIP_SPEED or up
+*   explore_s   - competition time when exploring was done, 0 if it was not
+*   speed_runs  - speed runs that ended in the goal
+*   lost        - times the mouse was lost and put back
+*   best_s      - fastest speed run
+*   top_profile - fastest speed profile still allowed at the end
+*
+* Every maze explored in the first half of the time limit has to get a
+* speed run in, and w/o slips the mouse must never get lost. The large
+* configurations may run out of time exploring, the drive time model has
+* the cells of the full size maze.
+*
+* Built once per maze configuration w/ -DALGO_MAZE_CONFIG=n, see the
+* Makefile.
+*-----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "algo/algo.h"
+#include "algo/mazemap_algo.h"
+#include "algo/runmanager_algo.h"
+#include "bench_maze.h"
+#include "bench_flash.h"
+#include "bench_mouse.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+#define BENCH_MAZE_COUNT      (20u)
+#define BENCH_RANDOM_SEED     (101u)
+#define BENCH_SLIP_SEED       (4001u)
+#define BENCH_SLIP_SPEED      (200u)
+#define BENCH_SLIP_PM         (40u)
+/* run manager steps, each at least one exploring step or 10 ms of waiting */
+#define BENCH_MAX_STEPS       (ALGO_RUN_TIME_LIMIT_MS / 10u \
+                               + 8u * ALGO_MAZE_CELL_COUNT)
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+static algo_maze_map_t benchMaze;
+static jmp_buf benchCrashTrap;
+
+/*----------------------------------------------------------------------------*/
+/*                    Private (Static) Function Prototype                     */
+/*----------------------------------------------------------------------------*/
+static void bench_RunMaze(unsigned int maze, unsigned int slipPerMille);
+static bool bench_RunStep(void);
+
+/*----------------------------------------------------------------------------*/
+/*                                    Main                                    */
+/*----------------------------------------------------------------------------*/
+int main(void)
+{
+    unsigned int maze = 0u;
+
+    bench_FlashInit();
+    printf("config,maze,slip,explore_s,speed_runs,lost,best_s,top_profile\n");
+
+    for (maze = 0u; maze < BENCH_MAZE_COUNT; maze++)
+    {
+        bench_GenerateCompetitionMaze(&benchMaze, BENCH_RANDOM_SEED + maze);
+        bench_RunMaze(maze, 0u);
+        bench_RunMaze(maze, BENCH_SLIP_PM);
+    }
+
+    return 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/*                         Private (Static) Functions                         */
+/*----------------------------------------------------------------------------*/
+/**
+* Run benchMaze from a blank map until the run manager is done, and print
+* the CSV line; exits if the run goes wrong
+*
+* \param[in] maze         Corpus index
+* \param[in] slipPerMille Drive calls slipping at the faster profiles
+* \retval None
+*/
+static void bench_RunMaze(unsigned int maze, unsigned int slipPerMille)
+{
+    const algo_run_stats_t* p_stats = NULL;
+    bench_mouse_noise_t noise;
+    unsigned int steps = 0u;
+
+    memset(&noise, 0, sizeof(noise));
+    noise.slipSpeed = BENCH_SLIP_SPEED;
+    noise.slipPerMille = slipPerMille;
+    noise.seed = BENCH_SLIP_SEED + maze;
+    bench_MouseReset(&benchMaze);
+    bench_MouseSetNoise(&noise);
+    algo_RunStart(ALGO_RUN_MODE_NEW_MAZE);
+
+    for (steps = 0u; bench_RunStep(); steps++)
+    {
+        if (steps == BENCH_MAX_STEPS)
+        {
+            printf("%ux%u run: maze %u still running after %u steps\n",
+                ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, maze, steps);
+            exit(1);
+        }
+
+        /* the operator puts the mouse back and presses the button */
+        if (algo_RunGetState() == ALGO_RUN_STATE_LOST)
+        {
+            bench_MouseCarryToStart();
+            bench_MousePressButton();
+        }
+    }
+
+    p_stats = algo_RunGetStats();
+    printf("%ux%u,%u,%u,%.1f,%u,%u,%.1f,%u\n", ALGO_MAZE_WIDTH,
+        ALGO_MAZE_HEIGHT, maze, slipPerMille, p_stats->exploreMs / 1e3,
+        p_stats->speedRuns, p_stats->lost, p_stats->bestRunMs / 1e3,
+        p_stats->topProfile);
+
+    if (((p_stats->speedRuns == 0u) && (p_stats->exploreMs != 0u)
+            && (p_stats->exploreMs <= ALGO_RUN_TIME_LIMIT_MS / 2u))
+        || ((slipPerMille == 0u) && (p_stats->lost != 0u)))
+    {
+        printf("%ux%u run: maze %u w/ %u speed runs, lost %u times\n",
+            ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, maze, p_stats->speedRuns,
+            p_stats->lost);
+        exit(1);
+    }
+}
+
+/**
+* One run manager step, a crash or slip on the way reported as lost
+*
+* \param None
+* \retval FALSE once the run is done
+*/
+static bool bench_RunStep(void)
+{
+    bool running = TRUE;
+
+    bench_MouseSetCrashTrap(&benchCrashTrap);
+    if (setjmp(benchCrashTrap) == 0)
+        running = algo_RunStep();
+    else
+        algo_RunReportLost();
+    bench_MouseSetCrashTrap(NULL);
+
+    return running;
+}
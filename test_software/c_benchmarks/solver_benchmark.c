@@ -0,0 +1,314 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : solver_benchmark.c
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : host benchmark
+*
+* Runs the firmware solver, algo/algo.c itself w/ every switch as it is on
+* the mouse, on the virtual mouse of bench_mouse.c over a corpus of mazes
+* that follow the competition rules, then over the mazes of the maze file
+* corpus that have the size of the configuration:
+*
+*   explore - call traverseCell() until it returns TRUE, checking after
+*             every step that algo.c and the mouse agree where it is
+*   run     - carry the mouse back to the start, then planSpeedRun() and
+*             runSpeedRun(), which must end in the goal
+*
+* Exploring must find the true shortest route of every maze. Each solver
+* step runs on a stack of its own, painted beforehand, to find the most
+* stack the solver needs; its static RAM, the planner arena included, is
+* in make ramreport, read from the map this benchmark links w/.
+*
+* Prints one CSV line per maze for tracking regressions:
+*   maze        - corpus index, the maze seed is BENCH_RANDOM_SEED + maze,
+*                 or the maze file name
+*   cells       - cells whose walls the mouse read while exploring
+*   moves       - drive calls while exploring
+*   turns       - turns in place while exploring
+*   arcs        - turns taken as arcs w/o stopping while exploring
+*   driven      - half squares driven while exploring
+*   steps       - traverseCell() calls
+*   cyc_step    - host CPU cycles per step, average and worst
+*   cyc_max
+*   read_ahead  - cells whose walls were read and planned for while the
+*                 mouse drove into them
+*   hidden_us   - host time planning while driving, per cell read
+*   exposed_us  - host time planning w/ the mouse standing, per cell read
+*   stack       - most stack bytes any step or the speed run planner used
+*   run_moves   - drive and turn calls of the speed run
+*   run_ms      - speed run time estimated by the planner
+*
+* Built once per maze configuration w/ -DALGO_MAZE_CONFIG=n, see the
+* Makefile. algo.c keeps the map in flash as it goes, which runs on the
+* simulated flash of bench_flash.c.
+*-----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ucontext.h>
+#include "algo/algo.h"
+#include "algo/mazemap_algo.h"
+#include "algo/floodfill_algo.h"
+#include "algo/primitive_algo.h"
+#include "algo/arena_algo.h"
+#include "bench_maze.h"
+#include "bench_flash.h"
+#include "bench_mouse.h"
+#include "bench_mazefile.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+#define BENCH_MAZE_COUNT      (20u)
+#define BENCH_RANDOM_SEED     (101u)
+#define BENCH_FILE_MAX        (64u)
+#define BENCH_LABEL_SIZE      (BENCH_MAZEFILE_NAME_SIZE)
+#define BENCH_STACK_SIZE      (256u * 1024u)
+#define BENCH_STACK_PAINT     (0xA5u)
+/* a proven route never takes more steps than a few laps of the maze */
+#define BENCH_MAX_STEPS       (8u * ALGO_MAZE_CELL_COUNT)
+
+typedef enum
+{
+    BENCH_CALL_TRAVERSE = 0u,
+    BENCH_CALL_PLAN
+} bench_call_t;
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+/* algo.c state, the firmware keeps it global */
+extern unsigned int x;
+extern unsigned int y;
+extern unsigned int curDir;
+extern uint32_t planHiddenUs;
+extern uint32_t planExposedUs;
+extern unsigned int planCells;
+extern unsigned int planCellsHidden;
+
+static algo_maze_map_t benchMaze;
+static bench_mazefile_t benchFiles[BENCH_FILE_MAX];
+static uint16_t benchFlood[ALGO_MAZE_CELL_COUNT];
+static uint8_t benchStack[BENCH_STACK_SIZE];
+static ucontext_t benchMainContext;
+static ucontext_t benchStepContext;
+static bench_call_t benchCall;
+static bool benchCallResult;
+static uint64_t benchCallCycles;
+
+/*----------------------------------------------------------------------------*/
+/*                    Private (Static) Function Prototype                     */
+/*----------------------------------------------------------------------------*/
+static void bench_RunMaze(const char* p_label);
+static bool bench_Call(bench_call_t call);
+static void bench_CallOnStack(void);
+static unsigned int bench_StackUsed(void);
+static unsigned int bench_ShortestRoute(const algo_maze_map_t* p_map,
+    bool knownOnly);
+
+/*----------------------------------------------------------------------------*/
+/*                                    Main                                    */
+/*----------------------------------------------------------------------------*/
+int main(void)
+{
+    char label[BENCH_LABEL_SIZE];
+    unsigned int fileCount = 0u;
+    unsigned int maze = 0u;
+
+    bench_FlashInit();
+    printf("config,maze,cells,moves,turns,arcs,driven,steps,cyc_step,cyc_max,"
+        "read_ahead,hidden_us,exposed_us,stack,run_moves,run_ms\n");
+
+    for (maze = 0u; maze < BENCH_MAZE_COUNT; maze++)
+    {
+        bench_GenerateCompetitionMaze(&benchMaze, BENCH_RANDOM_SEED + maze);
+        snprintf(label, sizeof(label), "%u", maze);
+        bench_RunMaze(label);
+    }
+
+    fileCount = bench_MazeFileLoadDir(BENCH_MAZEFILE_DIR, benchFiles,
+        BENCH_FILE_MAX);
+    for (maze = 0u; maze < fileCount; maze++)
+    {
+        if (bench_MazeFileToMap(&benchFiles[maze], &benchMaze))
+            bench_RunMaze(benchFiles[maze].name);
+    }
+
+    return 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/*                         Private (Static) Functions                         */
+/*----------------------------------------------------------------------------*/
+/**
+* Explore benchMaze w/ the solver, then make the speed run, and print the
+* CSV line; exits if the solver goes wrong
+*
+* \param[in] p_label Maze column of the CSV line
+* \retval None
+*/
+static void bench_RunMaze(const char* p_label)
+{
+    bench_mouse_stats_t explore;
+    const bench_mouse_stats_t* p_stats = NULL;
+    unsigned long long cycles = 0u;
+    uint64_t maxCycles = 0u;
+    unsigned int steps = 0u;
+    unsigned int mouseX = 0u;
+    unsigned int mouseY = 0u;
+    unsigned int mouseDir = 0u;
+    unsigned int readAhead = 0u;
+    double hiddenUs = 0.0;
+    double exposedUs = 0.0;
+    bool done = FALSE;
+
+    bench_MouseReset(&benchMaze);
+    forgetMaze();
+    memset(benchStack, BENCH_STACK_PAINT, sizeof(benchStack));
+
+    cycles = 0u;
+    maxCycles = 0u;
+    for (steps = 0u, done = FALSE; !done; steps++)
+    {
+        if (steps == BENCH_MAX_STEPS)
+        {
+            printf("%ux%u solver: maze %s not explored after %u steps\n",
+                ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, p_label, steps);
+            exit(1);
+        }
+
+        done = bench_Call(BENCH_CALL_TRAVERSE);
+        cycles += benchCallCycles;
+        if (benchCallCycles > maxCycles)
+            maxCycles = benchCallCycles;
+
+        if (!bench_MouseGetCell(&mouseX, &mouseY, &mouseDir)
+            || mouseX != x || mouseY != y || mouseDir != curDir)
+        {
+            printf("%ux%u solver: maze %s step %u, algo.c is in (%u, %u) "
+                "heading %u, the mouse is not\n", ALGO_MAZE_WIDTH,
+                ALGO_MAZE_HEIGHT, p_label, steps, x, y, curDir);
+            exit(1);
+        }
+    }
+    explore = *bench_MouseGetStats();
+    readAhead = planCellsHidden;
+    hiddenUs = (double)planHiddenUs / planCells;
+    exposedUs = (double)planExposedUs / planCells;
+
+    if (bench_ShortestRoute(&algoArena.mazeMap, TRUE)
+        != bench_ShortestRoute(&benchMaze, FALSE))
+    {
+        printf("%ux%u solver: maze %s explored w/o proving the shortest "
+            "route\n", ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, p_label);
+        exit(1);
+    }
+
+    /* algo.c does not drive back to the start on its own yet */
+    bench_MouseCarryToStart();
+    if (!bench_Call(BENCH_CALL_PLAN))
+    {
+        printf("%ux%u solver: maze %s has no speed run\n",
+            ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, p_label);
+        exit(1);
+    }
+    runSpeedRun();
+    if (!bench_MouseGetCell(&mouseX, &mouseY, &mouseDir)
+        || !ALGO_MAZE_IS_GOAL(mouseX, mouseY))
+    {
+        printf("%ux%u solver: maze %s speed run missed the goal\n",
+            ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, p_label);
+        exit(1);
+    }
+    p_stats = bench_MouseGetStats();
+
+    printf("%ux%u,%s,%u,%llu,%llu,%llu,%llu,%u,%llu,%llu,%u,%.1f,%.1f,%u,%llu,"
+        "%lu\n", ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, p_label,
+        explore.cellsSensed, explore.moves, explore.turns,
+        explore.searchTurns, explore.halfSquares, steps, cycles / steps,
+        (unsigned long long)maxCycles, readAhead, hiddenUs, exposedUs,
+        bench_StackUsed(),
+        (p_stats->moves - explore.moves) + (p_stats->turns - explore.turns),
+        (unsigned long)(algoArena.speedRunPrims.estimatedTimeUs / 1000u));
+}
+
+/**
+* Call into algo.c on the painted stack
+*
+* \param[in] call Function to call
+* \retval What it returned
+*/
+static bool bench_Call(bench_call_t call)
+{
+    benchCall = call;
+    getcontext(&benchStepContext);
+    benchStepContext.uc_stack.ss_sp = benchStack;
+    benchStepContext.uc_stack.ss_size = sizeof(benchStack);
+    benchStepContext.uc_link = &benchMainContext;
+    makecontext(&benchStepContext, bench_CallOnStack, 0);
+    if (swapcontext(&benchMainContext, &benchStepContext) != 0)
+    {
+        perror("solver step");
+        exit(1);
+    }
+
+    return benchCallResult;
+}
+
+/**
+* Body of bench_Call() on the painted stack
+*
+* \param None
+* \retval None
+*/
+static void bench_CallOnStack(void)
+{
+    uint64_t start = bench_Now();
+
+    if (benchCall == BENCH_CALL_TRAVERSE)
+        benchCallResult = traverseCell();
+    else
+        benchCallResult = planSpeedRun(0u);
+    benchCallCycles = bench_Now() - start;
+}
+
+/**
+* Stack bytes written since the stack was painted, it grows down
+*
+* \param None
+* \retval Bytes used
+*/
+static unsigned int bench_StackUsed(void)
+{
+    unsigned int untouched = 0u;
+
+    while ((untouched < sizeof(benchStack))
+        && (benchStack[untouched] == BENCH_STACK_PAINT))
+        untouched++;
+
+    return (unsigned int)sizeof(benchStack) - untouched;
+}
+
+/**
+* Cells on the shortest route from the start to the goal
+*
+* \param[in] p_map     Maze map
+* \param[in] knownOnly TRUE to go through walls known to be open only
+* \retval Flood value of the start cell
+*/
+static unsigned int bench_ShortestRoute(const algo_maze_map_t* p_map,
+    bool knownOnly)
+{
+    if (knownOnly)
+        algo_FloodFillKnown(p_map, benchFlood);
+    else
+        algo_FloodFill(p_map, benchFlood);
+
+    return benchFlood[ALGO_MAZE_IDX(ALGO_MAZE_START_X, ALGO_MAZE_START_Y)];
+}
@@ -0,0 +1,339 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : speedrun_benchmark.c
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : host benchmark
+*
+* Compares the speed run planner against following the flood map, which
+* gives a route w/ the fewest cells, and the diagonal planner against both.
+* All routes are timed w/ the same motion model on a set of fully discovered
+* random mazes, once as generated ("random") and once w/ extra walls knocked
+* out for more loops ("loopy"), and on a maze that is one long staircase from
+* the start to the goal ("stairs").
+*
+* For each maze the benchmark checks the planned route is never slower than
+* the flood route and the diagonal route never slower than the planned one,
+* then reports legs or primitives and estimated run time of every route and
+* how long planning took.
+*
+* The flood route is also compiled from its cell path into primitives, which
+* must keep the same estimated time, and the number of movement calls is
+* compared w/ driving it a cell at a time.
+*
+* Built once per maze configuration w/ -DALGO_MAZE_CONFIG=n, see the
+* Makefile.
+*-----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "algo/algo.h"
+#include "algo/mazemap_algo.h"
+#include "algo/floodfill_algo.h"
+#include "algo/speedrun_algo.h"
+#include "bench_maze.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+#define BENCH_MAZE_COUNT      (8u)
+#define BENCH_ITERATIONS      (50)
+#define BENCH_LOOPY_OPENINGS  (ALGO_MAZE_CELL_COUNT / 4u)
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+static algo_maze_map_t benchMaze;
+static uint16_t benchFlood[ALGO_MAZE_CELL_COUNT];
+static algo_speedrun_route_t benchPlanned;
+static algo_speedrun_route_t benchFloodRoute;
+static algo_prim_list_t benchDiagonal;
+static algo_prim_list_t benchCompiled;
+static uint8_t benchMoves[ALGO_MAZE_CELL_COUNT];
+
+/*----------------------------------------------------------------------------*/
+/*                    Private (Static) Function Prototype                     */
+/*----------------------------------------------------------------------------*/
+static void bench_Run(const char* p_caseName, unsigned int openings,
+    bool staircase);
+static void bench_FollowFlood(algo_speedrun_route_t* p_route);
+static void bench_BuildStaircase(algo_maze_map_t* p_maze);
+static unsigned int bench_RouteMoves(const algo_speedrun_route_t* p_route,
+    unsigned int* p_calls);
+
+/*----------------------------------------------------------------------------*/
+/*                                    Main                                    */
+/*----------------------------------------------------------------------------*/
+int main(void)
+{
+    bench_Run("random", 0u, FALSE);
+    bench_Run("loopy", BENCH_LOOPY_OPENINGS, FALSE);
+    bench_Run("stairs", 0u, TRUE);
+
+    return 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/*                         Private (Static) Functions                         */
+/*----------------------------------------------------------------------------*/
+/**
+* Plan and time both routes on every maze and print the averages
+*
+* \param[in] p_caseName Name of the maze case for the report
+* \param[in] openings   Extra walls to knock out of each maze
+* \param[in] staircase  TRUE to run the staircase maze instead of random ones
+* \retval None
+*/
+static void bench_Run(const char* p_caseName, unsigned int openings,
+    bool staircase)
+{
+    algo_speedrun_model_t model;
+    uint64_t start = 0u;
+    uint64_t planTime = 0u;
+    uint64_t diagonalTime = 0u;
+    uint64_t plannedUs = 0u;
+    uint64_t floodUs = 0u;
+    uint64_t diagonalUs = 0u;
+    unsigned int plannedLegs = 0u;
+    unsigned int floodLegs = 0u;
+    unsigned int diagonalPrims = 0u;
+    unsigned int compiledPrims = 0u;
+    unsigned int cellCalls = 0u;
+    unsigned int calls = 0u;
+    unsigned int moveCount = 0u;
+    unsigned int seed = 0u;
+    unsigned int n = 0u;
+    int i = 0;
+
+    algo_SpeedRunGetDefaultModel(&model);
+
+    for (seed = 1u; seed <= BENCH_MAZE_COUNT; seed++)
+    {
+        if (staircase)
+            bench_BuildStaircase(&benchMaze);
+        else
+            bench_GenerateMaze(&benchMaze, seed);
+        for (n = 0u; n < openings; n++)
+            algo_MazeMapSetWall(&benchMaze,
+                (unsigned int)rand() % ALGO_MAZE_WIDTH,
+                (unsigned int)rand() % ALGO_MAZE_HEIGHT,
+                (unsigned int)rand() % 4u, FALSE);
+
+        start = bench_Now();
+        for (i = 0; i < BENCH_ITERATIONS; i++)
+            if (!algo_SpeedRunPlan(&benchMaze, &model, &benchPlanned))
+            {
+                printf("%ux%u %s seed %u: planner found no route\n",
+                    ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, p_caseName, seed);
+                exit(1);
+            }
+        planTime += (bench_Now() - start) / BENCH_ITERATIONS;
+
+        algo_FloodFill(&benchMaze, benchFlood);
+        bench_FollowFlood(&benchFloodRoute);
+        benchFloodRoute.estimatedTimeUs =
+            algo_SpeedRunEstimateUs(&model, &benchFloodRoute);
+
+        moveCount = bench_RouteMoves(&benchFloodRoute, &calls);
+        if (!algo_PrimCompilePath(ALGO_MAZE_START_HEADING, benchMoves,
+            moveCount, &benchCompiled)
+            || (algo_SpeedRunEstimatePrimsUs(&model, &benchCompiled)
+                != benchFloodRoute.estimatedTimeUs))
+        {
+            printf("%ux%u %s seed %u: MISMATCH compiled flood route %lu us, flood route %lu us\n",
+                ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, p_caseName, seed,
+                (unsigned long)algo_SpeedRunEstimatePrimsUs(&model, &benchCompiled),
+                (unsigned long)benchFloodRoute.estimatedTimeUs);
+            exit(1);
+        }
+        compiledPrims += benchCompiled.count;
+        cellCalls += calls;
+
+        if ((benchPlanned.estimatedTimeUs
+                != algo_SpeedRunEstimateUs(&model, &benchPlanned))
+            || (benchPlanned.estimatedTimeUs > benchFloodRoute.estimatedTimeUs))
+        {
+            printf("%ux%u %s seed %u: MISMATCH planned %lu us, flood route %lu us\n",
+                ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, p_caseName, seed,
+                (unsigned long)benchPlanned.estimatedTimeUs,
+                (unsigned long)benchFloodRoute.estimatedTimeUs);
+            exit(1);
+        }
+
+        start = bench_Now();
+        for (i = 0; i < BENCH_ITERATIONS; i++)
+            if (!algo_SpeedRunPlanDiagonal(&benchMaze, &model, &benchDiagonal))
+            {
+                printf("%ux%u %s seed %u: diagonal planner found no route\n",
+                    ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, p_caseName, seed);
+                exit(1);
+            }
+        diagonalTime += (bench_Now() - start) / BENCH_ITERATIONS;
+
+        if ((benchDiagonal.estimatedTimeUs
+                != algo_SpeedRunEstimatePrimsUs(&model, &benchDiagonal))
+            || (benchDiagonal.estimatedTimeUs > benchPlanned.estimatedTimeUs))
+        {
+            printf("%ux%u %s seed %u: MISMATCH diagonal %lu us (primitives %lu us), planned %lu us\n",
+                ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, p_caseName, seed,
+                (unsigned long)benchDiagonal.estimatedTimeUs,
+                (unsigned long)algo_SpeedRunEstimatePrimsUs(&model, &benchDiagonal),
+                (unsigned long)benchPlanned.estimatedTimeUs);
+            exit(1);
+        }
+
+        plannedUs += benchPlanned.estimatedTimeUs;
+        diagonalUs += benchDiagonal.estimatedTimeUs;
+        diagonalPrims += benchDiagonal.count;
+        floodUs += benchFloodRoute.estimatedTimeUs;
+        plannedLegs += benchPlanned.legCount;
+        floodLegs += benchFloodRoute.legCount;
+    }
+
+    printf("%ux%u %-6s speedrun flood route: %4u legs %8llu ms estimated\n",
+        ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, p_caseName,
+        floodLegs / BENCH_MAZE_COUNT,
+        (unsigned long long)(floodUs / BENCH_MAZE_COUNT / 1000u));
+    printf("%ux%u %-6s speedrun flood route: %4u calls cell by cell %4u prims compiled\n",
+        ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, p_caseName,
+        cellCalls / BENCH_MAZE_COUNT, compiledPrims / BENCH_MAZE_COUNT);
+    printf("%ux%u %-6s speedrun planned:     %4u legs %8llu ms estimated "
+        "%10llu cycles planning\n",
+        ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, p_caseName,
+        plannedLegs / BENCH_MAZE_COUNT,
+        (unsigned long long)(plannedUs / BENCH_MAZE_COUNT / 1000u),
+        (unsigned long long)(planTime / BENCH_MAZE_COUNT));
+    printf("%ux%u %-6s speedrun diagonal:    %4u prims %7llu ms estimated "
+        "%10llu cycles planning\n",
+        ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, p_caseName,
+        diagonalPrims / BENCH_MAZE_COUNT,
+        (unsigned long long)(diagonalUs / BENCH_MAZE_COUNT / 1000u),
+        (unsigned long long)(diagonalTime / BENCH_MAZE_COUNT));
+}
+
+/**
+* Follow the flood map downhill from the start, keeping the heading on ties
+*
+* \param[out] p_route Route w/ the fewest cells
+* \retval None
+*/
+static void bench_FollowFlood(algo_speedrun_route_t* p_route)
+{
+    unsigned int x = ALGO_MAZE_START_X;
+    unsigned int y = ALGO_MAZE_START_Y;
+    unsigned int heading = ALGO_MAZE_START_HEADING;
+    unsigned int next = 0u;
+    unsigned int dir = 0u;
+    unsigned int nx = 0u;
+    unsigned int ny = 0u;
+    unsigned int i = 0u;
+
+    p_route->startX = ALGO_MAZE_START_X;
+    p_route->startY = ALGO_MAZE_START_Y;
+    p_route->startHeading = ALGO_MAZE_START_HEADING;
+    p_route->legCount = 0u;
+
+    while (benchFlood[ALGO_MAZE_IDX(x, y)] > 0u)
+    {
+        /* try the current heading first, then the rest in order */
+        next = 4u;
+        for (i = 0u; (i < 5u) && (next == 4u); i++)
+        {
+            dir = (i == 0u) ? heading : (i - 1u);
+            if (algo_MazeMapHasWall(&benchMaze, x, y, dir))
+                continue;
+            nx = x + ((dir == EAST) ? 1u : 0u) - ((dir == WEST) ? 1u : 0u);
+            ny = y + ((dir == NORTH) ? 1u : 0u) - ((dir == SOUTH) ? 1u : 0u);
+            if (benchFlood[ALGO_MAZE_IDX(nx, ny)] + 1u
+                == benchFlood[ALGO_MAZE_IDX(x, y)])
+                next = dir;
+        }
+
+        if ((p_route->legCount > 0u)
+            && (p_route->legs[p_route->legCount - 1u].heading == next))
+            p_route->legs[p_route->legCount - 1u].cells++;
+        else
+        {
+            p_route->legs[p_route->legCount].heading = (uint8_t)next;
+            p_route->legs[p_route->legCount].cells = 1u;
+            p_route->legCount++;
+        }
+
+        x = x + ((next == EAST) ? 1u : 0u) - ((next == WEST) ? 1u : 0u);
+        y = y + ((next == NORTH) ? 1u : 0u) - ((next == SOUTH) ? 1u : 0u);
+        heading = next;
+    }
+}
+
+/**
+* Build a maze w/ every wall up except a staircase from the start to the goal
+*
+* The staircase takes turns going north and east until it is level w/ the
+* goal on one axis, then goes straight for the rest.
+*
+* \param[out] p_maze Maze w/ every wall known
+* \retval None
+*/
+static void bench_BuildStaircase(algo_maze_map_t* p_maze)
+{
+    unsigned int x = ALGO_MAZE_START_X;
+    unsigned int y = ALGO_MAZE_START_Y;
+    unsigned int dir = NORTH;
+    unsigned int i = 0u;
+
+    algo_MazeMapClear(p_maze);
+    for (i = 0u; i < ALGO_MAZE_CELL_COUNT; i++)
+        for (dir = NORTH; dir <= WEST; dir++)
+            algo_MazeMapSetWall(p_maze, ALGO_MAZE_IDX_X(i), ALGO_MAZE_IDX_Y(i),
+                dir, TRUE);
+
+    dir = NORTH;
+    while (!ALGO_MAZE_IS_GOAL(x, y))
+    {
+        if (y >= ALGO_MAZE_GOAL_Y_MIN)
+            dir = EAST;
+        else if (x >= ALGO_MAZE_GOAL_X_MIN)
+            dir = NORTH;
+        algo_MazeMapSetWall(p_maze, x, y, dir, FALSE);
+        if (dir == NORTH)
+            y++;
+        else
+            x++;
+        dir = (dir == NORTH) ? EAST : NORTH;
+    }
+}
+
+/**
+* Expand the legs of a route into a cell path
+*
+* \param[in]  p_route Route to expand
+* \param[out] p_calls Movement calls driving it a cell at a time, one per
+*                     cell plus one per turn in place
+* \retval Number of moves written to benchMoves
+*/
+static unsigned int bench_RouteMoves(const algo_speedrun_route_t* p_route,
+    unsigned int* p_calls)
+{
+    unsigned int heading = p_route->startHeading;
+    unsigned int moveCount = 0u;
+    unsigned int i = 0u;
+    unsigned int n = 0u;
+
+    *p_calls = 0u;
+    for (i = 0u; i < p_route->legCount; i++)
+    {
+        if (p_route->legs[i].heading != heading)
+            *p_calls += ((p_route->legs[i].heading ^ 1u) == heading) ? 2u : 1u;
+        heading = p_route->legs[i].heading;
+
+        for (n = 0u; n < p_route->legs[i].cells; n++)
+            benchMoves[moveCount++] = (uint8_t)heading;
+        *p_calls += p_route->legs[i].cells;
+    }
+
+    return moveCount;
+}
@@ -0,0 +1,220 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : strategy_benchmark.c
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : host benchmark
+*
+* Runs every exploration strategy of algo/strategy_algo.h through
+* traverseCell() in algo/algo.c, on the virtual mouse of bench_mouse.c, over
+* the same mazes: the competition mazes of solver_benchmark.c, then the
+* maze file corpus mazes that have the size of the configuration.
+*
+* Prints one CSV line per strategy:
+*   mazes       - mazes explored
+*   goal        - mazes where the mouse got into the goal while exploring
+*   proven      - mazes where the walls found prove the shortest route
+*   cells       - cells whose walls the mouse read, average
+*   explore_s   - exploring time on the mouse, average and worst, estimated
+*   explore_max   w/ the speed run model from every movement call and wait
+*   cyc_step    - host CPU cycles per traverseCell() call, average
+*
+* The flood fill strategy has to prove the route in every maze; the wall
+* followers are allowed to miss the goal, that is what they are here to
+* show.
+*
+* Built once per maze configuration w/ -DALGO_MAZE_CONFIG=n, see the
+* Makefile.
+*-----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "algo/algo.h"
+#include "algo/mazemap_algo.h"
+#include "algo/floodfill_algo.h"
+#include "algo/strategy_algo.h"
+#include "algo/arena_algo.h"
+#include "bench_maze.h"
+#include "bench_flash.h"
+#include "bench_mouse.h"
+#include "bench_mazefile.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+#define BENCH_MAZE_COUNT      (20u)
+#define BENCH_RANDOM_SEED     (101u)
+#define BENCH_FILE_MAX        (64u)
+#define BENCH_MAZE_MAX        (BENCH_MAZE_COUNT + BENCH_FILE_MAX)
+/* a wall follower goes round each wall at most once from each side */
+#define BENCH_MAX_STEPS       (8u * ALGO_MAZE_CELL_COUNT)
+
+typedef struct
+{
+    unsigned int mazes;
+    unsigned int goal;
+    unsigned int proven;
+    unsigned long long cells;
+    unsigned long long timeUs;
+    unsigned long long maxTimeUs;
+    unsigned long long cycles;
+    unsigned long long steps;
+} bench_strategy_stats_t;
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+/* algo.c state, the firmware keeps it global */
+extern unsigned int x;
+extern unsigned int y;
+extern unsigned int curDir;
+
+static algo_maze_map_t benchMazes[BENCH_MAZE_MAX];
+static bench_mazefile_t benchFiles[BENCH_FILE_MAX];
+static uint16_t benchFlood[ALGO_MAZE_CELL_COUNT];
+
+/*----------------------------------------------------------------------------*/
+/*                    Private (Static) Function Prototype                     */
+/*----------------------------------------------------------------------------*/
+static void bench_Explore(const algo_maze_map_t* p_maze,
+    const algo_strategy_t* p_strategy, bench_strategy_stats_t* p_stats);
+static unsigned int bench_ShortestRoute(const algo_maze_map_t* p_map,
+    bool knownOnly);
+
+/*----------------------------------------------------------------------------*/
+/*                                    Main                                    */
+/*----------------------------------------------------------------------------*/
+int main(void)
+{
+    bench_strategy_stats_t stats;
+    const algo_strategy_t* p_strategy = NULL;
+    unsigned int mazeCount = 0u;
+    unsigned int fileCount = 0u;
+    unsigned int maze = 0u;
+    unsigned int id = 0u;
+
+    for (maze = 0u; maze < BENCH_MAZE_COUNT; maze++)
+        bench_GenerateCompetitionMaze(&benchMazes[mazeCount++],
+            BENCH_RANDOM_SEED + maze);
+    fileCount = bench_MazeFileLoadDir(BENCH_MAZEFILE_DIR, benchFiles,
+        BENCH_FILE_MAX);
+    for (maze = 0u; maze < fileCount; maze++)
+        if (bench_MazeFileToMap(&benchFiles[maze], &benchMazes[mazeCount]))
+            mazeCount++;
+
+    bench_FlashInit();
+    printf("config,strategy,mazes,goal,proven,cells,explore_s,explore_max,"
+        "cyc_step\n");
+
+    for (id = 0u; id < ALGO_STRATEGY_COUNT; id++)
+    {
+        p_strategy = algo_StrategyGet((algo_strategy_id_t)id);
+        algo_StrategySelect((algo_strategy_id_t)id);
+        memset(&stats, 0, sizeof(stats));
+        for (maze = 0u; maze < mazeCount; maze++)
+            bench_Explore(&benchMazes[maze], p_strategy, &stats);
+
+        if ((id == ALGO_STRATEGY_FLOOD_FILL) && (stats.proven != stats.mazes))
+        {
+            printf("%ux%u strategy: %s proved %u of %u routes\n",
+                ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, p_strategy->p_name,
+                stats.proven, stats.mazes);
+            return 1;
+        }
+
+        printf("%ux%u,%s,%u,%u,%u,%llu,%.1f,%.1f,%llu\n", ALGO_MAZE_WIDTH,
+            ALGO_MAZE_HEIGHT, p_strategy->p_name, stats.mazes, stats.goal,
+            stats.proven, stats.cells / stats.mazes,
+            (double)stats.timeUs / stats.mazes / 1e6,
+            (double)stats.maxTimeUs / 1e6, stats.cycles / stats.steps);
+    }
+
+    return 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/*                         Private (Static) Functions                         */
+/*----------------------------------------------------------------------------*/
+/**
+* Explore a maze from a blank map w/ the selected strategy
+*
+* \param[in]     p_maze     Maze w/ every wall known
+* \param[in]     p_strategy Selected strategy, for messages
+* \param[in,out] p_stats    Strategy totals to add to
+* \retval None
+*/
+static void bench_Explore(const algo_maze_map_t* p_maze,
+    const algo_strategy_t* p_strategy, bench_strategy_stats_t* p_stats)
+{
+    const bench_mouse_stats_t* p_mouse = NULL;
+    uint64_t start = 0u;
+    unsigned int steps = 0u;
+    unsigned int mouseX = 0u;
+    unsigned int mouseY = 0u;
+    unsigned int mouseDir = 0u;
+    bool goal = FALSE;
+    bool done = FALSE;
+
+    bench_MouseReset(p_maze);
+    forgetMaze();
+
+    for (steps = 0u; !done; steps++)
+    {
+        if (steps == BENCH_MAX_STEPS)
+        {
+            printf("%ux%u strategy: %s still exploring after %u steps\n",
+                ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT, p_strategy->p_name, steps);
+            exit(1);
+        }
+
+        start = bench_Now();
+        done = traverseCell();
+        p_stats->cycles += bench_Now() - start;
+
+        if (!bench_MouseGetCell(&mouseX, &mouseY, &mouseDir)
+            || mouseX != x || mouseY != y || mouseDir != curDir)
+        {
+            printf("%ux%u strategy: %s step %u, algo.c is in (%u, %u) "
+                "heading %u, the mouse is not\n", ALGO_MAZE_WIDTH,
+                ALGO_MAZE_HEIGHT, p_strategy->p_name, steps, x, y, curDir);
+            exit(1);
+        }
+        goal = goal || ALGO_MAZE_IS_GOAL(mouseX, mouseY);
+    }
+
+    p_mouse = bench_MouseGetStats();
+    p_stats->mazes++;
+    p_stats->steps += steps;
+    p_stats->cells += p_mouse->cellsSensed;
+    p_stats->timeUs += p_mouse->timeUs;
+    if (p_mouse->timeUs > p_stats->maxTimeUs)
+        p_stats->maxTimeUs = p_mouse->timeUs;
+    if (goal)
+        p_stats->goal++;
+    if (bench_ShortestRoute(&algoArena.mazeMap, TRUE)
+        == bench_ShortestRoute(p_maze, FALSE))
+        p_stats->proven++;
+}
+
+/**
+* Cells on the shortest route from the start to the goal
+*
+* \param[in] p_map     Maze map
+* \param[in] knownOnly TRUE to go through walls known to be open only
+* \retval Flood value of the start cell
+*/
+static unsigned int bench_ShortestRoute(const algo_maze_map_t* p_map,
+    bool knownOnly)
+{
+    if (knownOnly)
+        algo_FloodFillKnown(p_map, benchFlood);
+    else
+        algo_FloodFill(p_map, benchFlood);
+
+    return benchFlood[ALGO_MAZE_IDX(ALGO_MAZE_START_X, ALGO_MAZE_START_Y)];
+}
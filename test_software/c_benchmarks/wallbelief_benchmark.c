@@ -0,0 +1,348 @@
+/*-------------------------------- FILE INFO -----------------------------------
+* Filename        : wallbelief_benchmark.c
+* Author          : Team Kirbo
+* Revision        : 1.0
+* Updated         : 2026-10-17
+* Purpose         : host benchmark
+*
+* Explores the competition mazes of solver_benchmark.c w/ algo/algo.c on the
+* virtual mouse of bench_mouse.c, w/ noise on the wall readings, once
+* taking every wall from a single reading and once w/ the default wall
+* belief thresholds of algo/wallbelief_algo.h.
+*
+* Exploring faster is modelled as more noise on the side walls latched
+* driving into a square: the sensors get less time on each wall. Readings
+* w/ the mouse standing in a cell keep the same, lower, noise at every speed,
+* and each one takes BENCH_REST_READ_US.
+*
+* Prints one CSV line per thresholds and speed:
+*   speed       - 1 to BENCH_SPEED_COUNT, latched readings flipped per mille
+*   flip_pm       is BENCH_APPROACH_PM times the speed
+*   mazes       - mazes explored
+*   crashed     - mazes where exploring drove into a wall
+*   unproven    - mazes explored w/o proving the true shortest route
+*   map_errors  - walls known to the map that are wrong, all mazes
+*   run_failed  - speed runs that crashed, missed the goal or had no route
+*   explore_s   - exploring time on the mouse, average over the mazes that
+*                 did not crash, readings standing included
+*
+* The belief thresholds have to end up w/ fewer crashes and map errors than
+* single readings at the highest speed.
+*
+* Before that, every open wall on the shortest route of every maze is in
+* turn left as a guessed wall on an otherwise fully known map. Where that
+* makes the known route longer, the route must not count as proven: a
+* guess may not hide a shorter route from the proof or the pruning.
+*
+* Built once per maze configuration w/ -DALGO_MAZE_CONFIG=n, see the
+* Makefile.
+*-----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*                               Include Files                                */
+/*----------------------------------------------------------------------------*/
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "algo/algo.h"
+#include "algo/mazemap_algo.h"
+#include "algo/floodfill_algo.h"
+#include "algo/explore_algo.h"
+#include "algo/prune_algo.h"
+#include "algo/wallbelief_algo.h"
+#include "algo/arena_algo.h"
+#include "bench_maze.h"
+#include "bench_flash.h"
+#include "bench_mouse.h"
+
+/*----------------------------------------------------------------------------*/
+/*                                Definitions                                 */
+/*----------------------------------------------------------------------------*/
+#define BENCH_MAZE_COUNT      (20u)
+#define BENCH_RANDOM_SEED     (101u)
+#define BENCH_NOISE_SEED      (7919u)
+#define BENCH_SPEED_COUNT     (4u)
+#define BENCH_APPROACH_PM     (30u)
+#define BENCH_REST_PM         (10u)
+#define BENCH_REST_READ_US    (1000u)
+/* a proven route never takes more steps than a few laps of the maze */
+#define BENCH_MAX_STEPS       (8u * ALGO_MAZE_CELL_COUNT)
+
+typedef struct
+{
+    unsigned int mazes;
+    unsigned int crashed;
+    unsigned int unproven;
+    unsigned int mapErrors;
+    unsigned int runFailed;
+    unsigned long long timeUs;
+} bench_belief_stats_t;
+
+/*----------------------------------------------------------------------------*/
+/*                              Global Variables                              */
+/*----------------------------------------------------------------------------*/
+static algo_maze_map_t benchMazes[BENCH_MAZE_COUNT];
+static uint16_t benchFlood[ALGO_MAZE_CELL_COUNT];
+static uint16_t benchRouteFlood[ALGO_MAZE_CELL_COUNT];
+static algo_maze_map_t benchGuessed;
+static jmp_buf benchCrashTrap;
+
+/*----------------------------------------------------------------------------*/
+/*                    Private (Static) Function Prototype                     */
+/*----------------------------------------------------------------------------*/
+static void bench_Explore(const algo_maze_map_t* p_maze,
+    bench_belief_stats_t* p_stats);
+static unsigned int bench_MapErrors(const algo_maze_map_t* p_maze);
+static unsigned int bench_ShortestRoute(const algo_maze_map_t* p_map,
+    bool knownOnly);
+static unsigned int bench_GuessRouteWalls(const algo_maze_map_t* p_maze,
+    unsigned int* p_hidden);
+
+/*----------------------------------------------------------------------------*/
+/*                                    Main                                    */
+/*----------------------------------------------------------------------------*/
+int main(void)
+{
+    static const char* const p_names[2] = { "single", "belief" };
+    bench_belief_stats_t stats[2];
+    algo_wallbelief_config_t configs[2];
+    bench_mouse_noise_t noise;
+    unsigned int config = 0u;
+    unsigned int speed = 0u;
+    unsigned int maze = 0u;
+    unsigned int hidden = 0u;
+    unsigned int proven = 0u;
+
+    for (maze = 0u; maze < BENCH_MAZE_COUNT; maze++)
+        bench_GenerateCompetitionMaze(&benchMazes[maze],
+            BENCH_RANDOM_SEED + maze);
+
+    for (maze = 0u; maze < BENCH_MAZE_COUNT; maze++)
+        proven += bench_GuessRouteWalls(&benchMazes[maze], &hidden);
+    printf("%ux%u wall belief: %u guessed walls hide the shortest route, "
+        "%u of them proven anyway\n", ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT,
+        hidden, proven);
+    if ((hidden == 0u) || (proven != 0u))
+        return 1;
+
+    configs[0].commit = 1u;
+    configs[0].maxReads = 1u;
+    configs[0].limit = 1u;
+    algo_WallBeliefGetDefaultConfig(&configs[1]);
+
+    bench_FlashInit();
+    printf("config,thresholds,speed,flip_pm,mazes,crashed,unproven,"
+        "map_errors,run_failed,explore_s\n");
+
+    for (speed = 1u; speed <= BENCH_SPEED_COUNT; speed++)
+    {
+        for (config = 0u; config < 2u; config++)
+        {
+            algo_WallBeliefSetConfig(&configs[config]);
+            noise.approachPerMille = BENCH_APPROACH_PM * speed;
+            noise.restPerMille = BENCH_REST_PM;
+            noise.restReadUs = BENCH_REST_READ_US;
+            memset(&stats[config], 0, sizeof(stats[config]));
+            for (maze = 0u; maze < BENCH_MAZE_COUNT; maze++)
+            {
+                /* same flips for both thresholds as far as they read alike */
+                noise.seed = BENCH_NOISE_SEED + 101u * speed + maze;
+                bench_MouseSetNoise(&noise);
+                bench_Explore(&benchMazes[maze], &stats[config]);
+            }
+
+            printf("%ux%u,%s,%u,%u,%u,%u,%u,%u,%u,%.1f\n", ALGO_MAZE_WIDTH,
+                ALGO_MAZE_HEIGHT, p_names[config], speed,
+                noise.approachPerMille, stats[config].mazes,
+                stats[config].crashed, stats[config].unproven,
+                stats[config].mapErrors, stats[config].runFailed,
+                (stats[config].mazes > stats[config].crashed)
+                    ? (double)stats[config].timeUs
+                        / (stats[config].mazes - stats[config].crashed) / 1e6
+                    : 0.0);
+        }
+    }
+
+    noise.approachPerMille = 0u;
+    noise.restPerMille = 0u;
+    noise.restReadUs = 0u;
+    bench_MouseSetNoise(&noise);
+    algo_WallBeliefSetConfig(&configs[1]);
+
+    if ((stats[1].crashed + stats[1].mapErrors)
+        >= (stats[0].crashed + stats[0].mapErrors))
+    {
+        printf("%ux%u wall belief: %u crashes and %u map errors at speed %u, "
+            "single readings %u and %u\n", ALGO_MAZE_WIDTH, ALGO_MAZE_HEIGHT,
+            stats[1].crashed, stats[1].mapErrors, BENCH_SPEED_COUNT,
+            stats[0].crashed, stats[0].mapErrors);
+        return 1;
+    }
+
+    return 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/*                         Private (Static) Functions                         */
+/*----------------------------------------------------------------------------*/
+/**
+* Explore a maze from a blank map, then make the speed run, counting what
+* went wrong
+*
+* \param[in]     p_maze  Maze w/ every wall known
+* \param[in,out] p_stats Totals to add to
+* \retval None
+*/
+static void bench_Explore(const algo_maze_map_t* p_maze,
+    bench_belief_stats_t* p_stats)
+{
+    unsigned int steps = 0u;
+    unsigned int mouseX = 0u;
+    unsigned int mouseY = 0u;
+    unsigned int mouseDir = 0u;
+    bool done = FALSE;
+
+    bench_MouseReset(p_maze);
+    forgetMaze();
+    p_stats->mazes++;
+
+    bench_MouseSetCrashTrap(&benchCrashTrap);
+    if (setjmp(benchCrashTrap) != 0)
+    {
+        bench_MouseSetCrashTrap(NULL);
+        p_stats->crashed++;
+        p_stats->mapErrors += bench_MapErrors(p_maze);
+        return;
+    }
+    for (steps = 0u; !done && (steps < BENCH_MAX_STEPS); steps++)
+        done = traverseCell();
+    p_stats->timeUs += bench_MouseGetStats()->timeUs;
+    p_stats->mapErrors += bench_MapErrors(p_maze);
+    if (!done || (bench_ShortestRoute(&algoArena.mazeMap, TRUE)
+        != bench_ShortestRoute(p_maze, FALSE)))
+        p_stats->unproven++;
+
+    if (setjmp(benchCrashTrap) != 0)
+    {
+        bench_MouseSetCrashTrap(NULL);
+        p_stats->runFailed++;
+        return;
+    }
+    bench_MouseCarryToStart();
+    if (planSpeedRun(0u))
+        runSpeedRun();
+    if (!bench_MouseGetCell(&mouseX, &mouseY, &mouseDir)
+        || !ALGO_MAZE_IS_GOAL(mouseX, mouseY))
+        p_stats->runFailed++;
+    bench_MouseSetCrashTrap(NULL);
+}
+
+/**
+* Walls inside the maze the map knows, but gets wrong
+*
+* \param[in] p_maze Maze w/ every wall known
+* \retval Wrong walls
+*/
+static unsigned int bench_MapErrors(const algo_maze_map_t* p_maze)
+{
+    unsigned int errors = 0u;
+    unsigned int cellX = 0u;
+    unsigned int cellY = 0u;
+
+    for (cellY = 0u; cellY < ALGO_MAZE_HEIGHT; cellY++)
+    {
+        for (cellX = 0u; cellX < ALGO_MAZE_WIDTH; cellX++)
+        {
+            if (algo_MazeMapIsWallKnown(&algoArena.mazeMap, cellX, cellY, NORTH)
+                && (algo_MazeMapHasWall(&algoArena.mazeMap, cellX, cellY, NORTH)
+                    != algo_MazeMapHasWall(p_maze, cellX, cellY, NORTH)))
+                errors++;
+            if (algo_MazeMapIsWallKnown(&algoArena.mazeMap, cellX, cellY, EAST)
+                && (algo_MazeMapHasWall(&algoArena.mazeMap, cellX, cellY, EAST)
+                    != algo_MazeMapHasWall(p_maze, cellX, cellY, EAST)))
+                errors++;
+        }
+    }
+
+    return errors;
+}
+
+/**
+* Guess each open wall on the shortest route closed in turn, on a map that
+* knows every other wall, and check the route is not proven when the guess
+* makes the known route longer
+*
+* \param[in]     p_maze   Maze w/ every wall known
+* \param[in,out] p_hidden Guesses that made the known route longer, added to
+* \retval Guesses of those the route was proven w/
+*/
+static unsigned int bench_GuessRouteWalls(const algo_maze_map_t* p_maze,
+    unsigned int* p_hidden)
+{
+    static const int stepX[4] = { 0, 0, 1, -1 };    /* NORTH, SOUTH, EAST, */
+    static const int stepY[4] = { 1, -1, 0, 0 };    /* WEST */
+    unsigned int shortest = 0u;
+    unsigned int proven = 0u;
+    unsigned int cellX = ALGO_MAZE_START_X;
+    unsigned int cellY = ALGO_MAZE_START_Y;
+    unsigned int nextX = 0u;
+    unsigned int nextY = 0u;
+    unsigned int dir = 0u;
+
+    algo_FloodFill(p_maze, benchRouteFlood);
+    shortest = benchRouteFlood[ALGO_MAZE_IDX(cellX, cellY)];
+
+    while (benchRouteFlood[ALGO_MAZE_IDX(cellX, cellY)] != 0u)
+    {
+        /* the next cell one closer to the goal */
+        for (dir = 0u; dir < 4u; dir++)
+        {
+            nextX = (unsigned int)((int)cellX + stepX[dir]);
+            nextY = (unsigned int)((int)cellY + stepY[dir]);
+            if (!algo_MazeMapHasWall(p_maze, cellX, cellY, dir)
+                && (benchRouteFlood[ALGO_MAZE_IDX(nextX, nextY)] + 1u
+                    == benchRouteFlood[ALGO_MAZE_IDX(cellX, cellY)]))
+                break;
+        }
+
+        benchGuessed = *p_maze;
+        algo_MazeMapGuessWall(&benchGuessed, cellX, cellY, dir, TRUE);
+        if (bench_ShortestRoute(&benchGuessed, TRUE) > shortest)
+        {
+            /* as floodInit() in algo.c sets the map up */
+            (*p_hidden)++;
+            algo_PruneClear();
+            algo_PruneUpdate(&benchGuessed);
+            algo_FloodFillWithin(&benchGuessed, benchFlood,
+                algo_PruneGetKeptCells());
+            algo_ExploreUpdate(&benchGuessed, benchFlood);
+            if (algo_ExploreIsRouteProven())
+                proven++;
+        }
+
+        cellX = nextX;
+        cellY = nextY;
+    }
+
+    return proven;
+}
+
+/**
+* Cells on the shortest route from the start to the goal
+*
+* \param[in] p_map     Maze map
+* \param[in] knownOnly TRUE to go through walls known to be open only
+* \retval Flood value of the start cell
+*/
+static unsigned int bench_ShortestRoute(const algo_maze_map_t* p_map,
+    bool knownOnly)
+{
+    if (knownOnly)
+        algo_FloodFillKnown(p_map, benchFlood);
+    else
+        algo_FloodFill(p_map, benchFlood);
+
+    return benchFlood[ALGO_MAZE_IDX(ALGO_MAZE_START_X, ALGO_MAZE_START_Y)];
+}
@@ -23,6 +23,7 @@ This file contains class and method definitions for the maze class.
 #------------------------------------------------------------------------------#
 from mouse import *
 from obstacle import *
+from mazefile import *
 
 #------------------------------------------------------------------------------#
 #                                  Definitions                                 #
@@ -448,6 +449,29 @@ class Maze:
             current_row += 1
             current_column = 0
 
+    @classmethod
+    def from_file(cls, file_path, wall_length, wall_width, post_size):
+        """
+        Build a maze from a text maze file, see mazefile.py.
+
+        Args:
+            file_path   (str): Path of the maze file
+            wall_length (float): Long side of wall in mm
+            wall_width  (float): Short side of wall in mm
+            post_size   (float): Side length of post in mm
+
+        Returns:
+            (Maze): Maze w/ the walls of the file
+        """
+        row_count, column_count, vertical_wall_matrix, horizontal_wall_matrix = \
+            load_maze_file(file_path)
+
+        return cls(
+            row_count, column_count,
+            wall_length, wall_width, post_size,
+            vertical_wall_matrix, horizontal_wall_matrix
+        )
+
     def plot_maze(self):
         """
         Display the maze and mouse on xy plane w/ matplotlib
@@ -0,0 +1,265 @@
+#---------------------------------- FILE INFO ---------------------------------#
+#                                                                              #
+# Project       : Micromouse Simulation                                        #
+# Filename      : mazefile.py                                                  #
+# Author        : Team Kirbo                                                   #
+# Revision      : 1.0                                                          #
+# Updated       : 2026-10-17                                                   #
+#                                                                              #
+# Reads text maze files into the wall matrices the maze class takes.           #
+#                                                                              #
+#-------------------------------- END FILE INFO -------------------------------#
+
+#----------------------------- SPHINX FILE HEADER -----------------------------#
+"""
+mazefile.py
+
+This file reads text maze files into the wall matrices the maze class takes.
+
+Maze files are the ASCII art most micromouse maze collections use, north at
+the top, a post at every corner and a wall character between posts::
+
+    o---o---o---o
+    |       |   |
+    o   o---o   o
+    |   |       |
+    o---o---o---o
+
+Any character other than a space in a wall's place is a wall, and the post
+spacing is taken from the first line. The host benchmarks read the same
+files w/ test_software/c_benchmarks/bench_mazefile.c; both print the same
+digest of a maze, so ``make run`` there checks the two readers agree.
+
+Run on its own to print digests or time a bulk load::
+
+    python3 mazefile.py --digest ../mazes/*.txt
+    python3 mazefile.py --time ../mazes
+"""
+#--------------------------- END SPHINX FILE HEADER ---------------------------#
+
+#------------------------------------------------------------------------------#
+#                                Import Files                                  #
+#------------------------------------------------------------------------------#
+import os
+import re
+import sys
+import time
+
+#------------------------------------------------------------------------------#
+#                                  Definitions                                 #
+#------------------------------------------------------------------------------#
+__all__ = [
+    'MazeFileError',
+    'parse_maze_text', 'load_maze_file', 'load_maze_dir', 'wall_map_digest'
+]
+
+# Largest maze side the benchmarks take, in squares
+MAZE_FILE_MAX_SIZE = 32
+
+# Mazes to load when timing a bulk load
+MAZE_FILE_TIME_COUNT = 500
+
+#------------------------------------------------------------------------------#
+#                               Global Variables                               #
+#------------------------------------------------------------------------------#
+_wall_pattern = re.compile('[^ ]')
+
+#------------------------------------------------------------------------------#
+#                      Private Exceptions (DO NOT EXPORT)                      #
+#------------------------------------------------------------------------------#
+# None
+
+#------------------------------------------------------------------------------#
+#                               Public Exceptions                              #
+#------------------------------------------------------------------------------#
+class MazeFileError(ValueError):
+    """
+    Text is not a maze.
+    """
+
+#------------------------------------------------------------------------------#
+#                        Private Classes (DO NOT EXPORT)                       #
+#------------------------------------------------------------------------------#
+# None
+
+#------------------------------------------------------------------------------#
+#                                Public Classes                                #
+#------------------------------------------------------------------------------#
+# None
+
+#------------------------------------------------------------------------------#
+#                       Private Functions (DO NOT EXPORT)                      #
+#------------------------------------------------------------------------------#
+def _wall_chars(line, start, pitch, count, wall):
+    """
+    Pick every pitch-th character of a line and mark the walls.
+
+    Args:
+        line  (str): Line of the maze file
+        start (int): Character of the first wall
+        pitch (int): Characters from post to post
+        count (int): Walls on the line
+        wall  (str): Character to mark a wall w/
+
+    Returns:
+        (str): One character per wall, the wall character or a space
+    """
+    chars = line[start::pitch][:count].ljust(count)
+    return _wall_pattern.sub(wall, chars)
+
+#------------------------------------------------------------------------------#
+#                                Public Functions                              #
+#------------------------------------------------------------------------------#
+def parse_maze_text(text):
+    """
+    Read the walls of a maze from its text.
+
+    Args:
+        text (str): Maze file contents
+
+    Returns:
+        (Tuple): row_count, column_count, vertical_wall_matrix and
+        horizontal_wall_matrix as the Maze class takes them, row 0 at the top
+
+    Raises:
+        MazeFileError: The text is not a maze
+    """
+    lines = [line[:-1] if line.endswith('\r') else line
+             for line in text.split('\n')]
+
+    # Drop blank lines before and after the maze
+    first = 0
+    while first < len(lines) and lines[first] == '':
+        first += 1
+    last = len(lines)
+    while last > first and lines[last - 1] == '':
+        last -= 1
+    lines = lines[first:last]
+
+    if (len(lines) < 3) or (len(lines) % 2 == 0) or (lines[0][0] == ' '):
+        raise MazeFileError('not a maze')
+
+    # Post spacing from the first two posts of the top line
+    pitch = lines[0].find(lines[0][0], 1)
+    if (pitch < 2) or ((len(lines[0]) - 1) % pitch != 0):
+        raise MazeFileError('posts are not evenly spaced')
+
+    column_count = (len(lines[0]) - 1) // pitch
+    row_count = (len(lines) - 1) // 2
+    if (column_count > MAZE_FILE_MAX_SIZE) or (row_count > MAZE_FILE_MAX_SIZE):
+        raise MazeFileError('maze is larger than the benchmarks take')
+
+    horizontal_wall_matrix = [
+        _wall_chars(line, 1, pitch, column_count, '-') for line in lines[0::2]
+    ]
+    vertical_wall_matrix = [
+        _wall_chars(line, 0, pitch, column_count + 1, '|')
+        for line in lines[1::2]
+    ]
+
+    return row_count, column_count, vertical_wall_matrix, horizontal_wall_matrix
+
+def load_maze_file(file_path):
+    """
+    Read a maze file.
+
+    Args:
+        file_path (str): Path of the maze file
+
+    Returns:
+        (Tuple): As parse_maze_text()
+
+    Raises:
+        MazeFileError: The file is not a maze
+    """
+    # Bytes as they are, like the C reader
+    with open(file_path, 'rb') as maze_file:
+        return parse_maze_text(maze_file.read().decode('latin-1'))
+
+def load_maze_dir(dir_path):
+    """
+    Read every .txt maze file in a directory, sorted by name.
+
+    Args:
+        dir_path (str): Directory
+
+    Returns:
+        (List(Tuple)): File name and parse_maze_text() result of each maze,
+        files that are not mazes are skipped
+    """
+    mazes = []
+    for file_name in sorted(os.listdir(dir_path)):
+        if not file_name.endswith('.txt') or len(file_name) < 5:
+            continue
+        try:
+            mazes.append(
+                (file_name, load_maze_file(os.path.join(dir_path, file_name)))
+            )
+        except (MazeFileError, OSError):
+            pass
+
+    return mazes
+
+def wall_map_digest(row_count, column_count,
+                    vertical_wall_matrix, horizontal_wall_matrix):
+    """
+    Text that is the same for two mazes exactly when their walls are.
+
+    bench_MazeFileDigest() in the C benchmarks makes the same text.
+
+    Args:
+        row_count    (int): Number of rows in the maze
+        column_count (int): Number of columns in the maze
+        vertical_wall_matrix (List(str)): Matrix of vertical walls
+        horizontal_wall_matrix (List(str)): Matrix of horizontal walls
+
+    Returns:
+        (str): "WxH " then a hex digit of wall bits per square, north 1,
+        east 2, south 4 and west 8, bottom row first
+    """
+    digits = []
+    for row in range(row_count - 1, -1, -1):
+        for column in range(column_count):
+            walls = 0
+            if horizontal_wall_matrix[row][column] != ' ':
+                walls |= 1
+            if vertical_wall_matrix[row][column + 1] != ' ':
+                walls |= 2
+            if horizontal_wall_matrix[row + 1][column] != ' ':
+                walls |= 4
+            if vertical_wall_matrix[row][column] != ' ':
+                walls |= 8
+            digits.append('0123456789abcdef'[walls])
+
+    return '%ux%u %s' % (column_count, row_count, ''.join(digits))
+
+#------------------------------------------------------------------------------#
+#                                     MAIN                                     #
+#------------------------------------------------------------------------------#
+def main():
+    if (len(sys.argv) > 2) and (sys.argv[1] == '--digest'):
+        # One line per file, bench_mazefile.c prints the same
+        for file_path in sys.argv[2:]:
+            try:
+                digest = wall_map_digest(*load_maze_file(file_path))
+            except (MazeFileError, OSError):
+                digest = '-'
+            print('%s %s' % (os.path.basename(file_path), digest))
+    elif (len(sys.argv) == 3) and (sys.argv[1] == '--time'):
+        # Load the directory over and over until MAZE_FILE_TIME_COUNT mazes
+        maze_count = 0
+        start = time.perf_counter()
+        while maze_count < MAZE_FILE_TIME_COUNT:
+            loaded = len(load_maze_dir(sys.argv[2]))
+            if loaded == 0:
+                sys.exit('no mazes in %s' % sys.argv[2])
+            maze_count += loaded
+        seconds = time.perf_counter() - start
+        print('python mazefile: %u mazes in %.1f ms, %.1f us per maze'
+              % (maze_count, seconds * 1e3, seconds * 1e6 / maze_count))
+    else:
+        sys.exit('usage: mazefile.py --digest FILE... | --time DIR')
+
+# Example usage
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,191 @@
+#---------------------------------- FILE INFO ---------------------------------#
+#                                                                              #
+# Project       : Micromouse Simulation                                        #
+# Filename      : ramreport.py                                                 #
+# Author        : Team Kirbo                                                   #
+# Revision      : 1.0                                                          #
+# Updated       : 2026-10-17                                                   #
+#                                                                              #
+# Lists the static RAM the algo layer takes from a GNU ld map file.            #
+#                                                                              #
+#-------------------------------- END FILE INFO -------------------------------#
+
+#----------------------------- SPHINX FILE HEADER -----------------------------#
+"""
+ramreport.py
+
+This file lists the static RAM the algo layer takes from a GNU ld map file.
+
+The planner keeps its maps, queues, routes and primitive lists in the arena
+of algo/arena_algo.h, so the planner RAM is the arena plus the counters and
+flags the algo objects keep for themselves. The sizes are read from the
+.data, .rodata and .bss input sections of every ``algo.o`` and ``*_algo.o``
+in the map, so it reads the map of the firmware build as well as the map of
+a host benchmark; pointers and padding make the host figures a little
+larger. The firmware links w/ read-only data in the writable data section,
+so the startup code copies constant tables and strings to RAM like any
+initialized global, and they count toward the planner RAM.
+
+``make ramreport`` in test_software/c_benchmarks runs it for every maze
+configuration::
+
+    python3 ramreport.py --ram 32768 ../c_benchmarks/build/16x16/solver_benchmark.map
+"""
+#--------------------------- END SPHINX FILE HEADER ---------------------------#
+
+#------------------------------------------------------------------------------#
+#                                Import Files                                  #
+#------------------------------------------------------------------------------#
+import os
+import re
+import sys
+
+#------------------------------------------------------------------------------#
+#                                  Definitions                                 #
+#------------------------------------------------------------------------------#
+__all__ = [
+    'MapFileError',
+    'parse_map_ram', 'planner_ram'
+]
+
+# Output sections that take RAM, .rodata is copied to RAM on the mouse
+RAM_SECTIONS = ('.data', '.rodata', '.bss', 'COMMON')
+
+#------------------------------------------------------------------------------#
+#                               Global Variables                               #
+#------------------------------------------------------------------------------#
+# Input section, its name may be on a line of its own before the rest
+_section_pattern = re.compile(
+    r'^ (\.data|\.rodata|\.bss|COMMON)(\.\S*)?\s*$|'
+    r'^ (\.data|\.rodata|\.bss|COMMON)(\.\S*)?\s+0x[0-9a-fA-F]+\s+(0x[0-9a-fA-F]+)\s+(\S+)')
+_wrapped_pattern = re.compile(r'^\s+0x[0-9a-fA-F]+\s+(0x[0-9a-fA-F]+)\s+(\S+)')
+_algo_object_pattern = re.compile(r'(^|_)algo\.o(bj)?$')
+
+#------------------------------------------------------------------------------#
+#                      Private Exceptions (DO NOT EXPORT)                      #
+#------------------------------------------------------------------------------#
+# None
+
+#------------------------------------------------------------------------------#
+#                               Public Exceptions                              #
+#------------------------------------------------------------------------------#
+class MapFileError(ValueError):
+    """
+    Text is not a linker map w/ a memory map.
+    """
+
+#------------------------------------------------------------------------------#
+#                        Private Classes (DO NOT EXPORT)                       #
+#------------------------------------------------------------------------------#
+# None
+
+#------------------------------------------------------------------------------#
+#                                Public Classes                                #
+#------------------------------------------------------------------------------#
+# None
+
+#------------------------------------------------------------------------------#
+#                       Private Functions (DO NOT EXPORT)                      #
+#------------------------------------------------------------------------------#
+def _add(sizes, object_path, section, size):
+    """
+    Add an input section to the sizes of its object.
+
+    Args:
+        sizes       (dict): Object name to [data, rodata, bss] bytes
+        object_path (str):  Object file the section comes from
+        section     (str):  Output section, one of RAM_SECTIONS
+        size        (int):  Bytes
+    """
+    name = os.path.basename(object_path)
+    entry = sizes.setdefault(name, [0, 0, 0])
+    entry[RAM_SECTIONS.index(section) if section != 'COMMON' else 2] += size
+
+#------------------------------------------------------------------------------#
+#                                Public Functions                              #
+#------------------------------------------------------------------------------#
+def parse_map_ram(text):
+    """
+    Read the RAM of every object from a linker map.
+
+    Args:
+        text (str): Map file contents
+
+    Returns:
+        (dict): Object file name to [data, rodata, bss] bytes
+    """
+    if 'Memory map' not in text and 'Linker script and memory map' not in text:
+        raise MapFileError('no memory map')
+
+    sizes = {}
+    pending = None
+    for line in text.splitlines():
+        if pending is not None:
+            match = _wrapped_pattern.match(line)
+            if match:
+                _add(sizes, match.group(2), pending, int(match.group(1), 16))
+            pending = None
+            continue
+
+        match = _section_pattern.match(line)
+        if not match:
+            continue
+        if match.group(1):
+            pending = match.group(1)
+        else:
+            _add(sizes, match.group(6), match.group(3),
+                 int(match.group(5), 16))
+
+    return sizes
+
+def planner_ram(sizes):
+    """
+    Pick the algo objects out of the sizes of a map.
+
+    Args:
+        sizes (dict): Object file name to [data, rodata, bss] bytes
+
+    Returns:
+        (list): (name, data, rodata, bss) of each algo object w/ any RAM,
+                largest first
+    """
+    rows = [(name, data, rodata, bss)
+            for name, (data, rodata, bss) in sizes.items()
+            if _algo_object_pattern.search(name) and (data + rodata + bss) > 0]
+    return sorted(rows, key=lambda row: (-sum(row[1:]), row[0]))
+
+#------------------------------------------------------------------------------#
+#                                     MAIN                                     #
+#------------------------------------------------------------------------------#
+def main():
+    ram = None
+    args = sys.argv[1:]
+    if (len(args) > 2) and (args[0] == '--ram'):
+        ram = int(args[1], 0)
+        args = args[2:]
+    if len(args) != 1:
+        sys.exit('usage: ramreport.py [--ram BYTES] MAPFILE')
+
+    try:
+        with open(args[0]) as map_file:
+            rows = planner_ram(parse_map_ram(map_file.read()))
+    except (MapFileError, OSError) as error:
+        sys.exit('%s: %s' % (args[0], error))
+
+    print('%-24s %8s %8s %8s %8s'
+          % ('object', 'data', 'rodata', 'bss', 'total'))
+    for name, data, rodata, bss in rows:
+        print('%-24s %8u %8u %8u %8u'
+              % (name, data, rodata, bss, data + rodata + bss))
+    total = sum(sum(row[1:]) for row in rows)
+    print('%-24s %8s %8s %8s %8u' % ('planner RAM', '', '', '', total))
+    if ram is not None:
+        if total > ram:
+            print('%u bytes over the %u bytes of SRAM' % (total - ram, ram))
+        else:
+            print('%u of %u bytes of SRAM left for the stack and the rest'
+                  % (ram - total, ram))
+
+# Example usage
+if __name__ == "__main__":
+    main()